@@ -0,0 +1,72 @@
+
+#include <chrono>
+#include <iostream>
+#include <triton/context.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+/*
+ * 0x1000: mov rcx, 10000
+ * 0x1007: add rax, rcx
+ * 0x100a: xor rdx, rax
+ * 0x100d: push rdx
+ * 0x100e: pop rbx
+ * 0x100f: dec rcx
+ * 0x1012: jne 0x1007
+ */
+const unsigned char code[] = "\x48\xc7\xc1\x10\x27\x00\x00\x48\x01\xc8\x48\x31\xc2\x52\x5b\x48\xff\xc9\x75\xf3";
+const triton::uint64 base  = 0x1000;
+
+
+triton::uint64 emulate(triton::Context& ctx, triton::usize& count) {
+  triton::uint64 pc = base;
+
+  ctx.setConcreteMemoryAreaValue(base, code, sizeof(code) - 1);
+  ctx.setConcreteRegisterValue(ctx.registers.x86_rsp, 0x8000);
+
+  auto start = std::chrono::steady_clock::now();
+  while (pc != base + sizeof(code) - 1) {
+    auto opcode = ctx.getConcreteMemoryAreaValue(pc, 16);
+    Instruction inst(pc, opcode.data(), static_cast<triton::uint32>(opcode.size()));
+    ctx.processing(inst);
+    pc = static_cast<triton::uint64>(ctx.getConcreteRegisterValue(ctx.registers.x86_rip));
+    count++;
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+
+int main(int ac, const char **av) {
+  triton::Context ref(ARCH_X86_64);
+  triton::Context ctx(ARCH_X86_64);
+  triton::usize nref = 0;
+  triton::usize nctx = 0;
+
+  ctx.setMode(triton::modes::NATIVE_INTERPRETER, true);
+
+  auto tref = emulate(ref, nref);
+  auto tctx = emulate(ctx, nctx);
+
+  std::cout << "Semantics:          " << nref << " instructions in " << tref << " us" << std::endl;
+  std::cout << "Native interpreter: " << nctx << " instructions in " << tctx << " us" << std::endl;
+
+  for (const auto* reg : {&ctx.registers.x86_rax, &ctx.registers.x86_rbx, &ctx.registers.x86_rcx, &ctx.registers.x86_rdx, &ctx.registers.x86_rsp, &ctx.registers.x86_zf}) {
+    if (nref != nctx || ctx.getConcreteRegisterValue(*reg) != ref.getConcreteRegisterValue(*reg)) {
+      std::cerr << "Unexpected state for " << reg->getName() << std::endl;
+      return 1;
+    }
+  }
+
+  if (ctx.getSymbolicExpressions().size() != 0) {
+    std::cerr << "Unexpected symbolic expressions" << std::endl;
+    return 1;
+  }
+
+  std::cout << "OK" << std::endl;
+  return 0;
+}
@@ -0,0 +1,83 @@
+/*
+** Sends queries which cannot be solved in time to the process pool solver
+** and checks that their workers are killed and restarted.
+**
+** Output:
+**
+**  timeout: status=TIMEOUT timeouts=1
+**  interrupt: status=UNKNOWN crashes=1
+**  restart: status=SAT x=0x1337 new pid
+**
+*/
+
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <triton/context.hpp>
+#include <triton/ast.hpp>
+#include <triton/processPoolSolver.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::engines::solver;
+
+
+
+int main(int ac, const char **av) {
+  triton::Context ctx(ARCH_X86_64);
+  auto ast = ctx.getAstContext();
+
+  /* The pool forks its spawner before any thread is started */
+  ProcessPoolSolver pool(1);
+
+  auto x = ast->variable(ctx.newSymbolicVariable(64, "x"));
+  auto y = ast->variable(ctx.newSymbolicVariable(64, "y"));
+
+  /* Factoring the product of two 64-bit primes */
+  auto n = (triton::uint128(0xffffffffffffffc5) * triton::uint128(0xffffffffffffffad));
+  auto factoring = ast->land(std::vector<triton::ast::SharedAbstractNode>{
+    ast->equal(ast->bvmul(ast->zx(64, x), ast->zx(64, y)), ast->bv(n, 128)),
+    ast->bvugt(x, ast->bv(1, 64)),
+    ast->bvugt(y, ast->bv(1, 64))
+  });
+  auto easy = ast->equal(x, ast->bv(0x1337, 64));
+  status_e status;
+
+  /* A query over its timeout is answered TIMEOUT */
+  pool.getModel(factoring, &status, 500);
+  if (status != TIMEOUT || pool.getWorkerStats()[0].timeouts != 1) {
+    std::cerr << "timeout: status=" << status << " timeouts=" << pool.getWorkerStats()[0].timeouts << std::endl;
+    return -1;
+  }
+  std::cout << "timeout: status=TIMEOUT timeouts=1" << std::endl;
+
+  /* A query without timeout is interrupted from another thread, which kills its worker */
+  pool.isSat(easy);
+  auto crashes = pool.getWorkerStats()[0].crashes;
+  auto pid = pool.getWorkerStats()[0].pid;
+  std::thread interrupter([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    pool.interrupt();
+  });
+  pool.getModel(factoring, &status);
+  interrupter.join();
+  if (status != UNKNOWN || pool.getWorkerStats()[0].crashes != crashes + 1) {
+    std::cerr << "interrupt: status=" << status << " crashes=" << pool.getWorkerStats()[0].crashes << std::endl;
+    return -1;
+  }
+  std::cout << "interrupt: status=UNKNOWN crashes=" << pool.getWorkerStats()[0].crashes - crashes << std::endl;
+
+  /* The next query is solved by a new worker */
+  pool.interrupt(false);
+  auto model = pool.getModel(easy, &status);
+  if (status != SAT || model.size() != 1 || model.begin()->second.getValue() != 0x1337 || pool.getWorkerStats()[0].pid == pid) {
+    std::cerr << "restart: status=" << status << " pid=" << pool.getWorkerStats()[0].pid << std::endl;
+    return -1;
+  }
+  std::cout << "restart: status=SAT x=0x1337 new pid" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,297 @@
+/*
+** Replays a corpus of queries recorded by Context::setSolverRecordDirectory() and prints the
+** latency percentiles of a solver.
+**
+** Usage: triton-solver-bench <directory> [z3|bitwuzla|portfolio|custom:<library>] [threads] [timeout]
+**
+** Queries are parsed by z3 and lifted back to Triton's AST, so that any SolverInterface can be
+** benchmarked. `threads` defaults to 1 and `timeout` (in ms) to 0, no timeout.
+**
+** A custom solver is loaded from a shared library which exports its factory:
+**
+**  extern "C" triton::engines::solver::SolverInterface* triton_solver_bench_new(void) {
+**    return new MySolver();
+**  }
+**
+** Output:
+**
+**  $ ./triton-solver-bench /tmp/corpus z3 4
+**  Solver:   z3
+**  Queries:  1337 (sat: 1209, unsat: 120, timeout: 8, other: 0)
+**  Mismatch: 0
+**  Wall:     5123 ms
+**  Solving:  p50 1 ms, p90 5 ms, p99 212 ms, max 5000 ms, mean 12 ms
+**  Recorded: p50 1 ms, p90 6 ms, p99 240 ms, max 5000 ms, mean 13 ms
+*/
+
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <dlfcn.h>
+#endif
+
+#include <triton/context.hpp>
+#include <triton/solverRecorder.hpp>
+#include <triton/z3ToTriton.hpp>
+#include <z3++.h>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::engines::solver;
+
+
+struct query {
+  std::string                                         path;
+  std::string                                         script;
+  std::string                                         status;
+  triton::uint32                                      time;
+  std::vector<std::pair<std::string, triton::uint32>> variables;
+};
+
+
+/* Parses a decimal argument into `value`, returns false if it is not a number or does not fit */
+bool parseNumber(const char* arg, triton::uint32& value) {
+  std::istringstream stream(arg);
+  triton::uint64     number = 0;
+
+  if (!std::isdigit(static_cast<unsigned char>(arg[0])))
+    return false;
+
+  stream >> number;
+  if (stream.fail() || !stream.eof() || number > std::numeric_limits<triton::uint32>::max())
+    return false;
+
+  value = static_cast<triton::uint32>(number);
+  return true;
+}
+
+
+/* Returns the solver built by the factory of a shared library, or nullptr. The library is never unloaded */
+SolverInterface* loadCustomSolver(const std::string& library) {
+  using factory = SolverInterface* (*)(void);
+  factory create = nullptr;
+
+  #ifdef _WIN32
+  HMODULE handle = LoadLibraryA(library.c_str());
+  if (handle == nullptr) {
+    std::cerr << "Cannot load " << library << std::endl;
+    return nullptr;
+  }
+  create = reinterpret_cast<factory>(GetProcAddress(handle, "triton_solver_bench_new"));
+  #else
+  void* handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (handle == nullptr) {
+    std::cerr << "Cannot load " << library << ": " << dlerror() << std::endl;
+    return nullptr;
+  }
+  create = reinterpret_cast<factory>(dlsym(handle, "triton_solver_bench_new"));
+  #endif
+
+  if (create == nullptr) {
+    std::cerr << library << " does not export triton_solver_bench_new()" << std::endl;
+    return nullptr;
+  }
+
+  SolverInterface* solver = create();
+  if (solver == nullptr)
+    std::cerr << "triton_solver_bench_new() of " << library << " returned no solver" << std::endl;
+
+  return solver;
+}
+
+
+bool load(const std::string& path, query& q) {
+  std::ifstream stream(path);
+  std::string   prefix(recordFormat::prefix);
+  std::string   line;
+
+  if (!stream.is_open())
+    return false;
+
+  std::ostringstream script;
+  script << stream.rdbuf();
+
+  q.path   = path;
+  q.script = script.str();
+  q.status = "unknown";
+  q.time   = 0;
+
+  std::istringstream lines(q.script);
+  while (std::getline(lines, line) && line.compare(0, prefix.size(), prefix) == 0) {
+    std::istringstream fields(line.substr(prefix.size()));
+    std::string key;
+    fields >> key;
+
+    if (key == "status:") {
+      fields >> q.status;
+    }
+    else if (key == "time:") {
+      fields >> q.time;
+    }
+    else if (key == "variable:") {
+      std::string name;
+      triton::uint32 size = 0;
+      fields >> name >> size;
+      q.variables.push_back({name, size});
+    }
+  }
+
+  return true;
+}
+
+
+/* Lifts a recorded query in `ctx`, its variables being renamed to fresh symbolic variables */
+triton::ast::SharedAbstractNode lift(triton::Context& ctx, const query& q, std::vector<triton::ast::SharedAbstractNode>& variables) {
+  z3::context     z3ctx;
+  z3::expr_vector src(z3ctx);
+  z3::expr_vector dst(z3ctx);
+
+  z3::expr_vector asserts = z3ctx.parse_string(q.script.c_str());
+  z3::expr        expr    = z3::mk_and(asserts);
+
+  for (const auto& var : q.variables) {
+    auto symVar = ctx.newSymbolicVariable(var.second);
+    variables.push_back(ctx.getAstContext()->variable(symVar));
+    src.push_back(z3ctx.bv_const(var.first.c_str(), var.second));
+    dst.push_back(z3ctx.bv_const(symVar->getName().c_str(), var.second));
+  }
+
+  triton::ast::Z3ToTriton z3ToTriton(ctx.getAstContext());
+  return z3ToTriton.convert(expr.substitute(src, dst));
+}
+
+
+std::string percentiles(std::vector<triton::uint32> times) {
+  std::ostringstream stream;
+  triton::uint64     sum = 0;
+
+  if (times.empty())
+    return "n/a";
+
+  std::sort(times.begin(), times.end());
+  for (auto t : times)
+    sum += t;
+
+  auto at = [&](double p) { return times[static_cast<triton::usize>(p * (times.size() - 1))]; };
+
+  stream << "p50 " << at(0.50) << " ms, ";
+  stream << "p90 " << at(0.90) << " ms, ";
+  stream << "p99 " << at(0.99) << " ms, ";
+  stream << "max " << times.back() << " ms, ";
+  stream << "mean " << sum / times.size() << " ms";
+
+  return stream.str();
+}
+
+
+int main(int ac, const char **av) {
+  std::vector<triton::ast::SharedAbstractNode> variables;
+  std::vector<triton::ast::SharedAbstractNode> nodes;
+  std::vector<status_e>                        status;
+  std::vector<triton::uint32>                  solving;
+  std::vector<triton::uint32>                  recorded;
+  std::vector<std::string>                     paths;
+  std::vector<query>                           queries;
+  triton::Context                              ctx(ARCH_X86_64);
+
+  if (ac < 2) {
+    std::cerr << "Usage: " << av[0] << " <directory> [z3|bitwuzla|portfolio|custom:<library>] [threads] [timeout]" << std::endl;
+    return 1;
+  }
+
+  std::string    solver  = (ac > 2) ? av[2] : "z3";
+  triton::uint32 threads = 1;
+  triton::uint32 timeout = 0;
+
+  if (ac > 3 && !parseNumber(av[3], threads)) {
+    std::cerr << "Invalid number of threads: " << av[3] << std::endl;
+    return 1;
+  }
+
+  if (ac > 4 && !parseNumber(av[4], timeout)) {
+    std::cerr << "Invalid timeout: " << av[4] << std::endl;
+    return 1;
+  }
+
+  if (solver == "z3")
+    ctx.setSolver(SOLVER_Z3);
+  #ifdef TRITON_BITWUZLA_INTERFACE
+  else if (solver == "bitwuzla")
+    ctx.setSolver(SOLVER_BITWUZLA);
+  #endif
+  else if (solver == "portfolio")
+    ctx.setSolver(SOLVER_PORTFOLIO);
+  else if (solver.compare(0, 7, "custom:") == 0) {
+    SolverInterface* custom = loadCustomSolver(solver.substr(7));
+    if (custom == nullptr)
+      return 1;
+    ctx.setCustomSolver(custom);
+  }
+  else {
+    std::cerr << "Unsupported solver: " << solver << std::endl;
+    return 1;
+  }
+
+  for (const auto& entry : std::filesystem::directory_iterator(av[1])) {
+    if (entry.path().extension() == recordFormat::extension)
+      paths.push_back(entry.path().string());
+  }
+  std::sort(paths.begin(), paths.end());
+
+  for (const auto& path : paths) {
+    query q;
+    if (!load(path, q)) {
+      std::cerr << "Cannot read " << path << std::endl;
+      return 1;
+    }
+    try {
+      nodes.push_back(lift(ctx, q, variables));
+    }
+    catch (const std::exception& e) {
+      std::cerr << "Skipping " << path << ": " << e.what() << std::endl;
+      continue;
+    }
+    recorded.push_back(q.time);
+    queries.push_back(q);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  ctx.getModels(nodes, threads, &status, timeout, &solving);
+  auto end = std::chrono::steady_clock::now();
+
+  triton::usize sat = 0, unsat = 0, timeouts = 0, other = 0, mismatch = 0;
+  for (triton::usize i = 0; i < queries.size(); i++) {
+    switch (status[i]) {
+      case SAT:     sat++;      break;
+      case UNSAT:   unsat++;    break;
+      case TIMEOUT: timeouts++; break;
+      default:      other++;    break;
+    }
+    /* A definitive answer must match the recorded one */
+    if ((status[i] == SAT && queries[i].status == "unsat") || (status[i] == UNSAT && queries[i].status == "sat")) {
+      std::cerr << "Mismatch on " << queries[i].path << std::endl;
+      mismatch++;
+    }
+  }
+
+  std::cout << "Solver:   " << ctx.getSolverInstance()->getName() << std::endl;
+  std::cout << "Queries:  " << queries.size() << " (sat: " << sat << ", unsat: " << unsat << ", timeout: " << timeouts << ", other: " << other << ")" << std::endl;
+  std::cout << "Mismatch: " << mismatch << std::endl;
+  std::cout << "Wall:     " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+  std::cout << "Solving:  " << percentiles(solving) << std::endl;
+  std::cout << "Recorded: " << percentiles(recorded) << std::endl;
+
+  return (mismatch != 0);
+}
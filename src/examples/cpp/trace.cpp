@@ -0,0 +1,93 @@
+
+#include <fstream>
+#include <iostream>
+#include <triton/context.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/traceReader.hpp>
+#include <triton/traceReplayer.hpp>
+#include <triton/traceWriter.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::engines::trace;
+
+
+struct op {
+  unsigned int addr;
+  const void*  inst;
+  unsigned int size;
+};
+
+struct op trace[] = {
+  {0x400000, "\x48\x8b\x03",     3}, /* mov rax, QWORD PTR [rbx] */
+  {0x400003, "\x48\x01\xc8",     3}, /* add rax, rcx             */
+  {0x400006, "\x48\x89\x02",     3}, /* mov QWORD PTR [rdx], rax */
+  {0x400009, "\x48\x8b\x32",     3}, /* mov rsi, QWORD PTR [rdx] */
+  {0x40000c, "\x48\x31\xf6",     3}, /* xor rsi, rsi             */
+  {0x000000, nullptr,            0}
+};
+
+
+int main(int ac, const char **av) {
+  const char* path = "trace.bin";
+
+  /* Record the trace from an emulated run */
+  {
+    triton::Context ctx(ARCH_X86_64);
+    TraceWriter writer(path, ctx.getArchitecture());
+
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rbx, 0x1000);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rcx, 0x22);
+    ctx.setConcreteRegisterValue(ctx.registers.x86_rdx, 0x2000);
+    ctx.setConcreteMemoryValue(MemoryAccess(0x1000, 8), 0x1100);
+
+    for (unsigned int i = 0; trace[i].inst; i++) {
+      Instruction inst(trace[i].addr, trace[i].inst, trace[i].size);
+      ctx.processing(inst);
+      writer.write(inst);
+    }
+  }
+
+  /* Replay it in a fresh context, with rcx symbolized */
+  triton::Context ctx(ARCH_X86_64);
+  TraceReader reader(path);
+  TraceReplayer replayer(ctx);
+
+  ctx.symbolizeRegister(ctx.registers.x86_rcx);
+  if (replayer.replay(reader) != NO_FAULT) {
+    std::cerr << "Replay failed" << std::endl;
+    return 1;
+  }
+
+  if (ctx.getConcreteMemoryValue(MemoryAccess(0x2000, 8)) != 0x1122 || !ctx.isMemorySymbolized(MemoryAccess(0x2000, 8))) {
+    std::cerr << "Unexpected state after the replay" << std::endl;
+    return 1;
+  }
+
+  /* Chunks can be replayed on their own, concretely */
+  auto chunks = reader.split(2);
+  if (chunks.size() != 3 || chunks[2].first != 4 || chunks[2].count != 1) {
+    std::cerr << "Unexpected chunks" << std::endl;
+    return 1;
+  }
+
+  replayer.replayConcrete(reader, chunks[0]);
+  if (ctx.isMemorySymbolized(MemoryAccess(0x2000, 8)) || replayer.getNumberOfConcreteRecords() != 2) {
+    std::cerr << "Unexpected state after the concrete replay" << std::endl;
+    return 1;
+  }
+
+  /* A trace shorter than its header is rejected */
+  std::ofstream("truncated.bin", std::ios::binary).write(path, 4);
+  try {
+    TraceReader truncated("truncated.bin");
+    std::cerr << "Truncated trace accepted" << std::endl;
+    return 1;
+  }
+  catch (const triton::exceptions::Trace&) {
+  }
+
+  std::cout << "OK" << std::endl;
+  return 0;
+}
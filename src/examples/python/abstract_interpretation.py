@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+## -*- coding: utf-8 -*-
+##
+## Counts the solver calls spared by the ABSTRACT_INTERPRETATION mode on the
+## traces of proving_opaque_predicates.py. A query whose known bits and
+## intervals already make it true or false is decided without the solver.
+##
+## Output:
+##
+##  $ python3 src/examples/python/abstract_interpretation.py
+##  ABSTRACT_INTERPRETATION=False 5 queries, 0 decided, 5 sent to the solver
+##  ABSTRACT_INTERPRETATION=True  5 queries, 2 decided, 3 sent to the solver
+##
+
+import sys
+
+from triton import ARCH, MODE, Instruction, TritonContext
+
+traces = [
+    [
+        b"\x31\xC0",                  # xor eax, eax
+        b"\x0F\x80\x01\x00\x00\x00",  # jo 7
+    ],
+    [
+        b"\x31\xC0",                  # xor eax, eax
+        b"\x0F\x84\x01\x00\x00\x00",  # je 7
+    ],
+    [
+        b"\x31\xD8",                  # xor eax, ebx
+        b"\x0F\x84\x01\x00\x00\x00",  # je 7
+    ],
+    [
+        b"\x25\xff\xff\xff\x3f",      # and eax, 0x3fffffff
+        b"\x81\xe3\xff\xff\xff\x3f",  # and ebx, 0x3fffffff
+        b"\x31\xd1",                  # xor ecx, edx
+        b"\x31\xfa",                  # xor edx, edi
+        b"\x01\xd8",                  # add eax, ebx
+        b"\x0f\x80\x10\x00\x00\x00",  # jo 27
+    ],
+    [
+        b"\x25\xff\xff\xff\x3f",      # and eax, 0x3fffffff
+        b"\x81\xe3\xff\xff\xff\x3f",  # and ebx, 0x3fffffff
+        b"\x31\xd1",                  # xor ecx, edx
+        b"\x31\xfa",                  # xor edx, edi
+        b"\x31\xD8",                  # xor eax, ebx
+        b"\x0F\x84\x10\x00\x00\x00",  # je 16
+    ],
+]
+
+
+def run(enabled):
+    queries = 0
+    decided = 0
+
+    for trace in traces:
+        ctx = TritonContext(ARCH.X86)
+        ctx.setMode(MODE.ABSTRACT_INTERPRETATION, enabled)
+        for reg in (ctx.registers.eax, ctx.registers.ebx, ctx.registers.ecx, ctx.registers.edx):
+            ctx.symbolizeRegister(reg)
+
+        for opcode in trace:
+            inst = Instruction(opcode)
+            ctx.processing(inst)
+            if inst.isBranch():
+                # Is the other direction reachable?
+                ctx.getModel(ctx.getAstContext().lnot(ctx.getPathPredicate()))
+                queries += 1
+
+        decided += ctx.getSolverStats()["decided"]
+
+    return queries, decided
+
+
+def main():
+    for enabled in (False, True):
+        queries, decided = run(enabled)
+        print("ABSTRACT_INTERPRETATION=%-5s %d queries, %d decided, %d sent to the solver" % (enabled, queries, decided, queries - decided))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+## -*- coding: utf-8 -*-
+##
+## Measures the hit rate of the DECODE_CACHE mode and the number of
+## processed instructions per second with and without it, on a hot loop.
+##
+## Usage:
+##
+##  $ python3 src/examples/python/decode_cache.py [iterations]
+##
+
+import sys
+import time
+
+from triton import ARCH, MODE, Instruction, TritonContext
+
+# 0x1000: mov rcx, <iterations>
+# 0x1007: add rax, rcx
+# 0x100a: xor rax, rbx
+# 0x100d: dec rcx
+# 0x1010: jne 0x1007
+BASE = 0x1000
+
+
+def code(iterations):
+    return b"\x48\xc7\xc1" + iterations.to_bytes(4, "little") + b"\x48\x01\xc8\x48\x31\xd8\x48\xff\xc9\x75\xf5"
+
+
+def run(cached, iterations):
+    ctx = TritonContext(ARCH.X86_64)
+    ctx.setMode(MODE.DECODE_CACHE, cached)
+    ctx.setConcreteMemoryAreaValue(BASE, code(iterations))
+    ctx.symbolizeRegister(ctx.registers.rbx)
+
+    count = 0
+    end = BASE + len(code(iterations))
+    pc = BASE
+    start = time.perf_counter()
+    while pc != end:
+        ctx.processing(Instruction(pc, ctx.getConcreteMemoryAreaValue(pc, 16)))
+        pc = ctx.getConcreteRegisterValue(ctx.registers.rip)
+        count += 1
+    elapsed = time.perf_counter() - start
+
+    return count, elapsed, ctx.getDecodeCacheStats()
+
+
+def main():
+    iterations = int(sys.argv[1]) if len(sys.argv) > 1 else 10000
+
+    for cached in (False, True):
+        count, elapsed, stats = run(cached, iterations)
+        lookups = stats["hits"] + stats["misses"]
+        rate = 100.0 * stats["hits"] / lookups if lookups else 0.0
+        print("DECODE_CACHE=%-5s %d instructions in %.3fs, %.0f instructions/s, hit rate %.2f%%" % (cached, count, elapsed, count / elapsed, rate))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -675,13 +675,15 @@ namespace triton {
            * Create the semantic.
            * nf = MSB(result)
            */
-          auto node = this->astCtxt->extract(high, high, this->astCtxt->reference(parent));
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, nf, "Negative flag");
+          auto node = [=](void) {
+            return this->astCtxt->extract(high, high, this->astCtxt->reference(parent));
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(nf, parent->isTainted);
+          bool tainted = this->taintEngine->setTaintRegister(nf, parent->isTainted);
+
+          /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+          this->symbolicEngine->createSymbolicFlagExpression(inst, node, nf, "Negative flag", tainted);
         }
 
 
@@ -722,20 +724,22 @@ namespace triton {
            * Create the semantic.
            * zf = 0 == result
            */
-          auto node = this->astCtxt->ite(
-                        this->astCtxt->equal(
-                          this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                          this->astCtxt->bv(0, bvSize)
-                        ),
-                        this->astCtxt->bv(1, 1),
-                        this->astCtxt->bv(0, 1)
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, zf, "Zero flag");
+          auto node = [=](void) {
+            return this->astCtxt->ite(
+                     this->astCtxt->equal(
+                       this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
+                       this->astCtxt->bv(0, bvSize)
+                     ),
+                     this->astCtxt->bv(1, 1),
+                     this->astCtxt->bv(0, 1)
+                   );
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(zf, parent->isTainted);
+          bool tainted = this->taintEngine->setTaintRegister(zf, parent->isTainted);
+
+          /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+          this->symbolicEngine->createSymbolicFlagExpression(inst, node, zf, "Zero flag", tainted);
         }
 
 
@@ -787,23 +791,25 @@ namespace triton {
            * Create the semantic.
            * cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ result) & (op1 ^ op2)));
            */
-          auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                        this->astCtxt->bvxor(
-                          this->astCtxt->bvand(op1, op2),
-                          this->astCtxt->bvand(
-                            this->astCtxt->bvxor(
-                              this->astCtxt->bvxor(op1, op2),
-                              this->astCtxt->extract(high, low, this->astCtxt->reference(parent))
-                            ),
-                          this->astCtxt->bvxor(op1, op2))
-                        )
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, cf, "Carry flag");
+          auto node = [=](void) {
+            return this->astCtxt->extract(bvSize-1, bvSize-1,
+                     this->astCtxt->bvxor(
+                       this->astCtxt->bvand(op1, op2),
+                       this->astCtxt->bvand(
+                         this->astCtxt->bvxor(
+                           this->astCtxt->bvxor(op1, op2),
+                           this->astCtxt->extract(high, low, this->astCtxt->reference(parent))
+                         ),
+                       this->astCtxt->bvxor(op1, op2))
+                     )
+                   );
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(cf, parent->isTainted);
+          bool tainted = this->taintEngine->setTaintRegister(cf, parent->isTainted);
+
+          /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+          this->symbolicEngine->createSymbolicFlagExpression(inst, node, cf, "Carry flag", tainted);
         }
 
 
@@ -822,24 +828,26 @@ namespace triton {
            * Create the semantic.
            * cf = (MSB(((op1 ^ op2 ^ result) ^ ((op1 ^ result) & (op1 ^ op2))))) ^ 1
            */
-          auto node = this->astCtxt->bvxor(
-                        this->astCtxt->extract(bvSize-1, bvSize-1,
-                          this->astCtxt->bvxor(
-                            this->astCtxt->bvxor(op1, this->astCtxt->bvxor(op2, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))),
-                            this->astCtxt->bvand(
-                              this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent))),
-                              this->astCtxt->bvxor(op1, op2)
-                            )
-                          )
-                        ),
-                        this->astCtxt->bvtrue()
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, cf, "Carry flag");
+          auto node = [=](void) {
+            return this->astCtxt->bvxor(
+                     this->astCtxt->extract(bvSize-1, bvSize-1,
+                       this->astCtxt->bvxor(
+                         this->astCtxt->bvxor(op1, this->astCtxt->bvxor(op2, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))),
+                         this->astCtxt->bvand(
+                           this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent))),
+                           this->astCtxt->bvxor(op1, op2)
+                         )
+                       )
+                     ),
+                     this->astCtxt->bvtrue()
+                   );
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(cf, parent->isTainted);
+          bool tainted = this->taintEngine->setTaintRegister(cf, parent->isTainted);
+
+          /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+          this->symbolicEngine->createSymbolicFlagExpression(inst, node, cf, "Carry flag", tainted);
         }
 
 
@@ -900,18 +908,20 @@ namespace triton {
            * Create the semantic.
            * vf = MSB((op1 ^ ~op2) & (op1 ^ result))
            */
-          auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                        this->astCtxt->bvand(
-                          this->astCtxt->bvxor(op1, this->astCtxt->bvnot(op2)),
-                          this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                        )
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, vf, "Overflow flag");
+          auto node = [=](void) {
+            return this->astCtxt->extract(bvSize-1, bvSize-1,
+                     this->astCtxt->bvand(
+                       this->astCtxt->bvxor(op1, this->astCtxt->bvnot(op2)),
+                       this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
+                     )
+                   );
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(vf, parent->isTainted);
+          bool tainted = this->taintEngine->setTaintRegister(vf, parent->isTainted);
+
+          /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+          this->symbolicEngine->createSymbolicFlagExpression(inst, node, vf, "Overflow flag", tainted);
         }
 
 
@@ -930,18 +940,20 @@ namespace triton {
            * Create the semantic.
            * vf = MSB((op1 ^ op2) & (op1 ^ result))
            */
-          auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                        this->astCtxt->bvand(
-                          this->astCtxt->bvxor(op1, op2),
-                          this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                        )
-                      );
-
-          /* Create the symbolic expression */
-          auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, vf, "Overflow flag");
+          auto node = [=](void) {
+            return this->astCtxt->extract(bvSize-1, bvSize-1,
+                     this->astCtxt->bvand(
+                       this->astCtxt->bvxor(op1, op2),
+                       this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
+                     )
+                   );
+          };
 
           /* Spread the taint from the parent to the child */
-          expr->isTainted = this->taintEngine->setTaintRegister(vf, parent->isTainted);
+          bool tainted = this->taintEngine->setTaintRegister(vf, parent->isTainted);
+
+          /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+          this->symbolicEngine->createSymbolicFlagExpression(inst, node, vf, "Overflow flag", tainted);
         }
 
 
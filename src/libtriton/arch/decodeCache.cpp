@@ -0,0 +1,117 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+
+#include <triton/exceptions.hpp>
+#include <triton/decodeCache.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    DecodeCache::DecodeCache(triton::arch::Architecture* architecture, triton::usize capacity) {
+      if (architecture == nullptr)
+        throw triton::exceptions::Architecture("DecodeCache::DecodeCache(): The architecture API must be defined.");
+
+      this->architecture = architecture;
+      this->capacity     = capacity;
+    }
+
+
+    const triton::arch::Instruction* DecodeCache::lookup(const triton::arch::Instruction& inst) const {
+      /* The address is resolved from the program counter by the CPU */
+      if (!inst.getAddress())
+        return nullptr;
+
+      auto it = this->entries.find(inst.getAddress());
+      if (it == this->entries.end())
+        return nullptr;
+
+      const triton::arch::Instruction& cached = it->second;
+
+      /* The same bytes decode differently in Arm and Thumb mode */
+      if (cached.isThumb() != this->architecture->isThumb())
+        return nullptr;
+
+      /* Self-modifying code, or another mapping at the same address */
+      if (inst.getSize() < cached.getSize() || std::memcmp(inst.getOpcode(), cached.getOpcode(), cached.getSize()) != 0)
+        return nullptr;
+
+      return &cached;
+    }
+
+
+    void DecodeCache::disassembly(triton::arch::Instruction& inst) {
+      const triton::arch::Instruction* cached = this->lookup(inst);
+
+      if (cached) {
+        triton::uint32 tid = inst.getThreadId();
+        inst = *cached;
+        inst.setThreadId(tid);
+        this->stats.hits++;
+        return;
+      }
+
+      this->architecture->disassembly(inst);
+      this->stats.misses++;
+
+      if (!inst.getAddress())
+        return;
+
+      if (this->entries.size() >= this->capacity && this->entries.find(inst.getAddress()) == this->entries.end()) {
+        this->entries.clear();
+        this->stats.flushes++;
+      }
+
+      /* Only the decoded part of the instruction is kept */
+      triton::arch::Instruction& entry = this->entries[inst.getAddress()];
+      entry = inst;
+      entry.setThreadId(0);
+      entry.setConditionTaken(false);
+      entry.setTaint(false);
+      entry.symbolicExpressions.clear();
+      entry.getLoadAccess().clear();
+      entry.getReadImmediates().clear();
+      entry.getReadRegisters().clear();
+      entry.getStoreAccess().clear();
+      entry.getUndefinedRegisters().clear();
+      entry.getWrittenRegisters().clear();
+    }
+
+
+    void DecodeCache::disassembly(triton::arch::BasicBlock& block, triton::uint64 addr) {
+      for (auto& inst : block.getInstructions()) {
+        inst.setAddress(addr);
+        this->disassembly(inst);
+        addr += inst.getSize();
+      }
+    }
+
+
+    void DecodeCache::clear(void) {
+      this->entries.clear();
+    }
+
+
+    triton::usize DecodeCache::size(void) const {
+      return this->entries.size();
+    }
+
+
+    const triton::arch::DecodeCacheStats& DecodeCache::getStats(void) const {
+      return this->stats;
+    }
+
+
+    void DecodeCache::clearStats(void) {
+      this->stats = triton::arch::DecodeCacheStats();
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -87,6 +87,7 @@ namespace triton {
       this->storeAccess         = other.storeAccess;
       this->symbolicExpressions = other.symbolicExpressions;
       this->tainted             = other.tainted;
+      this->thumb               = other.thumb;
       this->tid                 = other.tid;
       this->type                = other.type;
       this->undefinedRegisters  = other.undefinedRegisters;
@@ -525,6 +526,7 @@ namespace triton {
       this->prefix          = triton::arch::x86::ID_PREFIX_INVALID;
       this->size            = 0;
       this->tainted         = false;
+      this->thumb           = false;
       this->tid             = 0;
       this->type            = 0;
       this->updateFlag      = false;
@@ -6,6 +6,7 @@
 */
 
 #include <new>
+#include <vector>
 
 #include <triton/aarch64Semantics.hpp>
 #include <triton/arm32Semantics.hpp>
@@ -26,7 +27,8 @@ namespace triton {
                          const triton::modes::SharedModes& modes,
                          const triton::ast::SharedAstContext& astCtxt,
                          triton::engines::symbolic::SymbolicEngine* symbolicEngine,
-                         triton::engines::taint::TaintEngine* taintEngine)
+                         triton::engines::taint::TaintEngine* taintEngine,
+                         triton::engines::symbolic::FunctionSummaries* summaries)
       : modes(modes), astCtxt(astCtxt) {
 
       if (architecture == nullptr)
@@ -41,13 +43,15 @@ namespace triton {
       this->architecture         = architecture;
       this->symbolicEngine       = symbolicEngine;
       this->taintEngine          = taintEngine;
+      this->summaries            = summaries;
       this->aarch64Isa           = new(std::nothrow) triton::arch::arm::aarch64::AArch64Semantics(architecture, symbolicEngine, taintEngine, astCtxt);
       this->arm32Isa             = new(std::nothrow) triton::arch::arm::arm32::Arm32Semantics(architecture, symbolicEngine, taintEngine, astCtxt);
       this->riscvIsa             = new(std::nothrow) triton::arch::riscv::riscvSemantics(architecture, symbolicEngine, taintEngine, modes, astCtxt);
       this->x86Isa               = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine, modes, astCtxt);
+      this->interpreter          = new(std::nothrow) triton::arch::x86::x8664Interpreter(architecture, symbolicEngine, taintEngine, modes);
 
       if (this->x86Isa == nullptr || this->aarch64Isa == nullptr || this->arm32Isa == nullptr
-        || this->riscvIsa == nullptr
+        || this->riscvIsa == nullptr || this->interpreter == nullptr
       )
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): Not enough memory.");
     }
@@ -58,6 +62,7 @@ namespace triton {
       delete this->arm32Isa;
       delete this->riscvIsa;
       delete this->x86Isa;
+      delete this->interpreter;
     }
 
 
@@ -68,6 +73,20 @@ namespace triton {
       if (arch == triton::arch::ARCH_INVALID)
         throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): You must define an architecture.");
 
+      /* Pre IR processing */
+      this->preIrInit(inst);
+
+      bool summarized = (this->summaries != nullptr && this->summaries->isSummarized(inst.getAddress()));
+
+      /*
+       * Concrete instructions are executed natively, without building their semantics. With
+       * ONLY_ON_SYMBOLIZED, their expressions would be removed by postIrInit() anyway.
+       */
+      bool native = this->modes->isModeEnabled(triton::modes::NATIVE_INTERPRETER) || this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED);
+      if (!summarized && native && this->interpreter->execute(inst)) {
+        return triton::arch::NO_FAULT;
+      }
+
       /* Initialize the target address of memory operands */
       for (auto& operand : inst.operands) {
         if (operand.getType() == triton::arch::OP_MEM) {
@@ -75,32 +94,34 @@ namespace triton {
         }
       }
 
-      /* Pre IR processing */
-      this->preIrInit(inst);
-
       /* Processing */
-      switch (arch) {
-        case triton::arch::ARCH_AARCH64:
-          ret = this->aarch64Isa->buildSemantics(inst);
-          break;
-
-        case triton::arch::ARCH_ARM32:
-          ret = this->arm32Isa->buildSemantics(inst);
-          break;
-
-        case triton::arch::ARCH_X86:
-        case triton::arch::ARCH_X86_64:
-          ret = this->x86Isa->buildSemantics(inst);
-          break;
-
-        case triton::arch::ARCH_RV64:
-        case triton::arch::ARCH_RV32:
-          ret = this->riscvIsa->buildSemantics(inst);
-          break;
-
-        default:
-          throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): Architecture not supported.");
-          break;
+      if (summarized) {
+        ret = this->summaries->apply(inst);
+      }
+      else {
+        switch (arch) {
+          case triton::arch::ARCH_AARCH64:
+            ret = this->aarch64Isa->buildSemantics(inst);
+            break;
+
+          case triton::arch::ARCH_ARM32:
+            ret = this->arm32Isa->buildSemantics(inst);
+            break;
+
+          case triton::arch::ARCH_X86:
+          case triton::arch::ARCH_X86_64:
+            ret = this->x86Isa->buildSemantics(inst);
+            break;
+
+          case triton::arch::ARCH_RV64:
+          case triton::arch::ARCH_RV32:
+            ret = this->riscvIsa->buildSemantics(inst);
+            break;
+
+          default:
+            throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): Architecture not supported.");
+            break;
+        }
       }
 
       /* Post IR processing */
@@ -114,15 +135,45 @@ namespace triton {
       triton::arch::exception_e ret = triton::arch::NO_FAULT;
       triton::usize count = block.getSize();
 
-      for (auto& inst : block.getInstructions()) {
-        ret = this->buildSemantics(inst);
-        if (ret != triton::arch::NO_FAULT) {
-          return ret;
+      /*
+       * The ASTs of the flags are only built when they are read or when the
+       * block ends, so a flag overwritten later in the block without being
+       * read is never built. The LAZY_FLAGS mode already defers every flag,
+       * and the ONLY_ON_* modes filter the expressions of each instruction
+       * right after it is built.
+       */
+      bool deferred = this->modes->isModeEnabled(triton::modes::DEAD_FLAG_ELIMINATION) &&
+                      !this->modes->isModeEnabled(triton::modes::LAZY_FLAGS) &&
+                      !this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) &&
+                      !this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED);
+
+      if (deferred) {
+        this->symbolicEngine->deferFlags(true);
+      }
+
+      try {
+        for (auto& inst : block.getInstructions()) {
+          ret = this->buildSemantics(inst);
+          if (ret != triton::arch::NO_FAULT) {
+            break;
+          }
+          count--;
+          if (inst.isControlFlow() && count) {
+            throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): Do not add instructions in a block after a branch instruction.");
+          }
         }
-        count--;
-        if (inst.isControlFlow() && count) {
-          throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): Do not add instructions in a block after a branch instruction.");
+      }
+      catch (...) {
+        if (deferred) {
+          this->symbolicEngine->deferFlags(false);
         }
+        throw;
+      }
+
+      /* Builds the flags live at the block exit */
+      if (deferred) {
+        this->symbolicEngine->deferFlags(false);
+        this->astCtxt->garbage();
       }
 
       return ret;
@@ -0,0 +1,845 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+
+#include <triton/archEnums.hpp>
+#include <triton/callbacks.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/x86Specifications.hpp>
+#include <triton/x8664Interpreter.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+
+      x8664Interpreter::x8664Interpreter(triton::arch::Architecture* architecture,
+                                         triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                         triton::engines::taint::TaintEngine* taintEngine,
+                                         const triton::modes::SharedModes& modes) : modes(modes) {
+
+        this->architecture    = architecture;
+        this->symbolicEngine  = symbolicEngine;
+        this->taintEngine     = taintEngine;
+        this->cpu             = nullptr;
+
+        if (architecture == nullptr)
+          throw triton::exceptions::Semantics("x8664Interpreter::x8664Interpreter(): The architecture API must be defined.");
+
+        if (this->symbolicEngine == nullptr)
+          throw triton::exceptions::Semantics("x8664Interpreter::x8664Interpreter(): The symbolic engine API must be defined.");
+
+        if (this->taintEngine == nullptr)
+          throw triton::exceptions::Semantics("x8664Interpreter::x8664Interpreter(): The taint engines API must be defined.");
+      }
+
+
+      bool x8664Interpreter::execute(triton::arch::Instruction& inst) {
+        if (this->architecture->getArchitecture() != triton::arch::ARCH_X86_64)
+          return false;
+
+        /* Prefixed instructions are repeated or atomic */
+        if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID)
+          return false;
+
+        /* Loads and stores are symbolic in the memory array model */
+        if (this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY))
+          return false;
+
+        this->cpu = static_cast<triton::arch::x86::x8664Cpu*>(this->architecture->getCpuInstance());
+
+        /* Register callbacks are triggered by each register access of the semantics */
+        if (this->cpu->callbacks != nullptr) {
+          if (this->cpu->callbacks->isDefined(triton::callbacks::GET_CONCRETE_REGISTER_VALUE) ||
+              this->cpu->callbacks->isDefined(triton::callbacks::SET_CONCRETE_REGISTER_VALUE))
+            return false;
+        }
+
+        switch (inst.getType()) {
+          case ID_INS_ADD:
+          case ID_INS_CMP:
+          case ID_INS_DEC:
+          case ID_INS_INC:
+          case ID_INS_SUB:
+            return this->arith_n(inst);
+
+          case ID_INS_AND:
+          case ID_INS_OR:
+          case ID_INS_TEST:
+          case ID_INS_XOR:
+            return this->logic_n(inst);
+
+          case ID_INS_SAL:
+          case ID_INS_SAR:
+          case ID_INS_SHL:
+          case ID_INS_SHR:
+            return this->shift_n(inst);
+
+          case ID_INS_MOV:
+          case ID_INS_MOVABS:
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+            return this->mov_n(inst);
+
+          case ID_INS_JA:
+          case ID_INS_JAE:
+          case ID_INS_JB:
+          case ID_INS_JBE:
+          case ID_INS_JE:
+          case ID_INS_JG:
+          case ID_INS_JGE:
+          case ID_INS_JL:
+          case ID_INS_JLE:
+          case ID_INS_JNE:
+          case ID_INS_JNO:
+          case ID_INS_JNP:
+          case ID_INS_JNS:
+          case ID_INS_JO:
+          case ID_INS_JP:
+          case ID_INS_JS:
+            return this->jcc_n(inst);
+
+          case ID_INS_CALL:   return this->call_n(inst);
+          case ID_INS_JMP:    return this->jmp_n(inst);
+          case ID_INS_LEA:    return this->lea_n(inst);
+          case ID_INS_NOP:    return this->nop_n(inst);
+          case ID_INS_POP:    return this->pop_n(inst);
+          case ID_INS_PUSH:   return this->push_n(inst);
+          case ID_INS_RET:    return this->ret_n(inst);
+
+          default:
+            return false;
+        }
+      }
+
+
+      triton::uint64 x8664Interpreter::mask(triton::uint32 bits) {
+        if (bits >= triton::bitsize::qword)
+          return static_cast<triton::uint64>(-1);
+        return (static_cast<triton::uint64>(1) << bits) - 1;
+      }
+
+
+      triton::uint64 x8664Interpreter::signExtend(triton::uint64 value, triton::uint32 bits) {
+        if (bits >= triton::bitsize::qword)
+          return value;
+        if ((value >> (bits - 1)) & 1)
+          return value | ~x8664Interpreter::mask(bits);
+        return value & x8664Interpreter::mask(bits);
+      }
+
+
+      triton::uint32 x8664Interpreter::getFlagBit(triton::arch::register_e id) {
+        switch (id) {
+          case triton::arch::ID_REG_X86_CF: return 0;
+          case triton::arch::ID_REG_X86_PF: return 2;
+          case triton::arch::ID_REG_X86_AF: return 4;
+          case triton::arch::ID_REG_X86_ZF: return 6;
+          case triton::arch::ID_REG_X86_SF: return 7;
+          case triton::arch::ID_REG_X86_OF: return 11;
+          default:
+            throw triton::exceptions::Semantics("x8664Interpreter::getFlagBit(): Invalid flag.");
+        }
+      }
+
+
+      triton::uint8* x8664Interpreter::getStorage(const triton::arch::Register& reg) const {
+        /* The parity flag of a high byte register is not computed on its own bits */
+        if (reg.getLow() != 0)
+          return nullptr;
+
+        switch (reg.getParent()) {
+          case triton::arch::ID_REG_X86_RAX: return this->cpu->rax;
+          case triton::arch::ID_REG_X86_RBX: return this->cpu->rbx;
+          case triton::arch::ID_REG_X86_RCX: return this->cpu->rcx;
+          case triton::arch::ID_REG_X86_RDX: return this->cpu->rdx;
+          case triton::arch::ID_REG_X86_RDI: return this->cpu->rdi;
+          case triton::arch::ID_REG_X86_RSI: return this->cpu->rsi;
+          case triton::arch::ID_REG_X86_RBP: return this->cpu->rbp;
+          case triton::arch::ID_REG_X86_RSP: return this->cpu->rsp;
+          case triton::arch::ID_REG_X86_RIP: return this->cpu->rip;
+          case triton::arch::ID_REG_X86_R8:  return this->cpu->r8;
+          case triton::arch::ID_REG_X86_R9:  return this->cpu->r9;
+          case triton::arch::ID_REG_X86_R10: return this->cpu->r10;
+          case triton::arch::ID_REG_X86_R11: return this->cpu->r11;
+          case triton::arch::ID_REG_X86_R12: return this->cpu->r12;
+          case triton::arch::ID_REG_X86_R13: return this->cpu->r13;
+          case triton::arch::ID_REG_X86_R14: return this->cpu->r14;
+          case triton::arch::ID_REG_X86_R15: return this->cpu->r15;
+          default:
+            return nullptr;
+        }
+      }
+
+
+      bool x8664Interpreter::isConcreteRegister(const triton::arch::Register& reg) const {
+        if (this->getStorage(reg) == nullptr)
+          return false;
+
+        return !this->symbolicEngine->isRegisterSymbolized(reg) && !this->taintEngine->isRegisterTainted(reg);
+      }
+
+
+      bool x8664Interpreter::isConcreteAddress(triton::arch::MemoryAccess& mem) {
+        const triton::arch::Register& base  = mem.getConstBaseRegister();
+        const triton::arch::Register& index = mem.getConstIndexRegister();
+        bool pointers                       = this->modes->isModeEnabled(triton::modes::TAINT_THROUGH_POINTERS);
+        bool hasBase                        = this->architecture->isRegisterValid(base);
+        bool hasIndex                       = this->architecture->isRegisterValid(index);
+        triton::uint64 address              = 0;
+        triton::uint32 bitSize              = 0;
+
+        if (this->architecture->isRegisterValid(mem.getConstSegmentRegister()))
+          return false;
+
+        /* The base is not read for a pc-relative access */
+        if (hasBase && !mem.getPcRelative()) {
+          if (this->getStorage(base) == nullptr || this->symbolicEngine->isRegisterSymbolized(base))
+            return false;
+          if (pointers && this->taintEngine->isRegisterTainted(base))
+            return false;
+        }
+
+        if (hasIndex) {
+          if (this->getStorage(index) == nullptr || this->symbolicEngine->isRegisterSymbolized(index))
+            return false;
+          if (pointers && this->taintEngine->isRegisterTainted(index))
+            return false;
+        }
+
+        /* Same computation as SymbolicEngine::initLeaAst() -> ((pc + base) + (index * scale) + disp) */
+        bitSize = (hasBase ? base.getBitSize() :
+                    (hasIndex ? index.getBitSize() :
+                      (mem.getConstDisplacement().getBitSize() ? mem.getConstDisplacement().getBitSize() :
+                        this->architecture->gprBitSize()
+                      )
+                    )
+                  );
+
+        address = mem.getPcRelative() ? mem.getPcRelative() : (hasBase ? this->readRegister(base) : 0);
+        address += (hasIndex ? this->readRegister(index) : 0) * mem.getConstScale().getValue();
+        address += mem.getConstDisplacement().getValue();
+
+        if (mem.getBitSize() >= triton::bitsize::byte)
+          mem.setAddress(address & this->mask(bitSize));
+
+        return true;
+      }
+
+
+      bool x8664Interpreter::isConcreteRead(triton::arch::OperandWrapper& op) {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM:
+            return true;
+
+          case triton::arch::OP_REG:
+            return this->isConcreteRegister(op.getConstRegister());
+
+          case triton::arch::OP_MEM: {
+            triton::arch::MemoryAccess& mem = op.getMemory();
+            /* Checks the size and initializes the address */
+            if (!this->isConcreteWrite(op))
+              return false;
+            if (this->symbolicEngine->isMemorySymbolized(mem.getAddress(), mem.getSize()))
+              return false;
+            return !this->taintEngine->isMemoryTainted(mem);
+          }
+
+          default:
+            return false;
+        }
+      }
+
+
+      bool x8664Interpreter::isConcreteWrite(triton::arch::OperandWrapper& op) {
+        switch (op.getType()) {
+          case triton::arch::OP_REG: {
+            const triton::arch::Register& reg = op.getConstRegister();
+            if (this->getStorage(reg) == nullptr)
+              return false;
+            /* Byte and word registers are inserted into their parent */
+            if (reg.getSize() < triton::size::dword)
+              return !this->symbolicEngine->isRegisterSymbolized(reg);
+            return true;
+          }
+
+          case triton::arch::OP_MEM: {
+            triton::arch::MemoryAccess& mem = op.getMemory();
+            switch (mem.getSize()) {
+              case triton::size::byte:
+              case triton::size::word:
+              case triton::size::dword:
+              case triton::size::qword:
+                return this->isConcreteAddress(mem);
+              default:
+                return false;
+            }
+          }
+
+          default:
+            return false;
+        }
+      }
+
+
+      bool x8664Interpreter::isConcreteFlag(triton::arch::register_e id) {
+        const triton::arch::Register& flag = this->architecture->getRegister(id);
+
+        /* A pending flag must synchronize its concrete value first */
+        this->symbolicEngine->materializeLazyFlag(flag);
+
+        return !this->symbolicEngine->isRegisterSymbolized(flag) && !this->taintEngine->isRegisterTainted(flag);
+      }
+
+
+      bool x8664Interpreter::isPathConstraintSkipped(void) const {
+        return this->modes->isModeEnabled(triton::modes::PC_TRACKING_SYMBOLIC) || this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED);
+      }
+
+
+      triton::uint64 x8664Interpreter::read(const triton::arch::OperandWrapper& op) const {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM: return op.getConstImmediate().getValue() & this->mask(op.getBitSize());
+          case triton::arch::OP_MEM: return this->readMemory(op.getConstMemory());
+          case triton::arch::OP_REG: return this->readRegister(op.getConstRegister());
+          default:
+            throw triton::exceptions::Semantics("x8664Interpreter::read(): Invalid operand.");
+        }
+      }
+
+
+      triton::uint64 x8664Interpreter::readRegister(const triton::arch::Register& reg) const {
+        triton::uint64 value = 0;
+        std::memcpy(&value, this->getStorage(reg), sizeof(triton::uint64));
+        return value & this->mask(reg.getBitSize());
+      }
+
+
+      triton::uint64 x8664Interpreter::readMemory(const triton::arch::MemoryAccess& mem) const {
+        triton::uint64 addr  = mem.getAddress();
+        triton::uint64 value = 0;
+
+        if (this->cpu->callbacks)
+          this->cpu->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
+
+        for (triton::sint32 i = mem.getSize()-1; i >= 0; i--) {
+          auto it = this->cpu->memory.find(addr+i);
+          value = (value << triton::bitsize::byte) | (it != this->cpu->memory.end() ? it->second : 0x00);
+        }
+
+        return value;
+      }
+
+
+      bool x8664Interpreter::readFlag(triton::arch::register_e id) const {
+        triton::uint64 flags = 0;
+        std::memcpy(&flags, this->cpu->eflags, sizeof(triton::uint64));
+        return (flags >> this->getFlagBit(id)) & 1;
+      }
+
+
+      void x8664Interpreter::write(const triton::arch::OperandWrapper& op, triton::uint64 value) {
+        switch (op.getType()) {
+          case triton::arch::OP_MEM: this->writeMemory(op.getConstMemory(), value); break;
+          case triton::arch::OP_REG: this->writeRegister(op.getConstRegister(), value); break;
+          default:
+            throw triton::exceptions::Semantics("x8664Interpreter::write(): Invalid operand.");
+        }
+      }
+
+
+      void x8664Interpreter::writeRegister(const triton::arch::Register& reg, triton::uint64 value) {
+        triton::uint8* storage = this->getStorage(reg);
+        triton::uint64 rmask   = this->mask(reg.getBitSize());
+        triton::uint64 full    = 0;
+
+        /* Writing a dword zero-extends the parent register, bytes and words are inserted */
+        if (reg.getSize() < triton::size::dword)
+          std::memcpy(&full, storage, sizeof(triton::uint64));
+
+        full = (full & ~rmask) | (value & rmask);
+        std::memcpy(storage, &full, sizeof(triton::uint64));
+
+        this->symbolicEngine->concretizeOverwrittenRegister(reg);
+        this->taintEngine->untaintRegister(reg);
+      }
+
+
+      void x8664Interpreter::writeMemory(const triton::arch::MemoryAccess& mem, triton::uint64 value) {
+        triton::uint64 addr = mem.getAddress();
+        triton::uint32 size = mem.getSize();
+
+        value &= this->mask(mem.getBitSize());
+
+        this->symbolicEngine->concretizeMemory(mem, false);
+
+        if (this->cpu->callbacks)
+          this->cpu->callbacks->processCallbacks(triton::callbacks::SET_CONCRETE_MEMORY_VALUE, mem, value);
+
+        for (triton::uint32 i = 0; i < size; i++) {
+          this->cpu->memory[addr+i] = static_cast<triton::uint8>(value & 0xff);
+          value >>= triton::bitsize::byte;
+        }
+
+        this->taintEngine->untaintMemory(mem);
+      }
+
+
+      void x8664Interpreter::writeFlag(triton::arch::register_e id, bool value) {
+        const triton::arch::Register& flag = this->architecture->getRegister(id);
+        triton::uint64 bit   = static_cast<triton::uint64>(1) << this->getFlagBit(id);
+        triton::uint64 flags = 0;
+
+        std::memcpy(&flags, this->cpu->eflags, sizeof(triton::uint64));
+        flags = value ? (flags | bit) : (flags & ~bit);
+        std::memcpy(this->cpu->eflags, &flags, sizeof(triton::uint64));
+
+        this->symbolicEngine->concretizeOverwrittenRegister(flag);
+        this->taintEngine->untaintRegister(flag);
+      }
+
+
+      void x8664Interpreter::undefinedFlag(triton::arch::register_e id) {
+        const triton::arch::Register& flag = this->architecture->getRegister(id);
+
+        /* Same as x86Semantics::undefined_s(), the concrete value is unchanged */
+        if (this->modes->isModeEnabled(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS))
+          this->symbolicEngine->concretizeRegister(flag);
+
+        this->taintEngine->untaintRegister(flag);
+      }
+
+
+      void x8664Interpreter::writeResultFlags(triton::uint64 result, triton::uint32 bits) {
+        /* The parity flag only covers the least significant byte */
+        triton::uint8 parity = static_cast<triton::uint8>(result);
+        parity ^= parity >> 4;
+        parity ^= parity >> 2;
+        parity ^= parity >> 1;
+
+        this->writeFlag(triton::arch::ID_REG_X86_PF, !(parity & 1));
+        this->writeFlag(triton::arch::ID_REG_X86_SF, (result >> (bits - 1)) & 1);
+        this->writeFlag(triton::arch::ID_REG_X86_ZF, (result & this->mask(bits)) == 0);
+      }
+
+
+      void x8664Interpreter::controlFlow(const triton::arch::Instruction& inst) {
+        this->writeRegister(this->architecture->getProgramCounter(), inst.getNextAddress());
+      }
+
+
+      bool x8664Interpreter::arith_n(triton::arch::Instruction& inst) {
+        triton::uint32 type = inst.getType();
+        bool unary          = (type == ID_INS_INC || type == ID_INS_DEC);
+        bool sub            = (type == ID_INS_SUB || type == ID_INS_CMP || type == ID_INS_DEC);
+
+        if (inst.operands.size() != (unary ? 1 : 2))
+          return false;
+
+        auto& dst = inst.operands[0];
+
+        /* The destination is read, which also checks that it can be written */
+        if (!this->isConcreteRead(dst))
+          return false;
+
+        if (!unary) {
+          auto& src = inst.operands[1];
+          if (!this->isConcreteRead(src))
+            return false;
+          if (type != ID_INS_CMP && src.getBitSize() != dst.getBitSize())
+            return false;
+        }
+
+        triton::uint32 bits  = dst.getBitSize();
+        triton::uint32 msb   = bits - 1;
+        triton::uint64 op1   = this->read(dst);
+        triton::uint64 op2   = unary ? 1 : this->read(inst.operands[1]);
+
+        if (type == ID_INS_CMP)
+          op2 = this->signExtend(op2, inst.operands[1].getBitSize()) & this->mask(bits);
+
+        triton::uint64 res = (sub ? op1 - op2 : op1 + op2) & this->mask(bits);
+
+        /* Same formulas as x86Semantics::af_s(), cfAdd_s(), cfSub_s(), ofAdd_s() and ofSub_s() */
+        bool af = ((res ^ op1 ^ op2) & 0x10) != 0;
+        bool cf = sub ? (((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2))) >> msb) & 1
+                      : (((op1 & op2) ^ ((op1 ^ op2 ^ res) & (op1 ^ op2))) >> msb) & 1;
+        bool of = sub ? (((op1 ^ op2) & (op1 ^ res)) >> msb) & 1
+                      : (((op1 ^ ~op2) & (op1 ^ res)) >> msb) & 1;
+
+        if (type != ID_INS_CMP)
+          this->write(dst, res);
+
+        this->writeFlag(triton::arch::ID_REG_X86_AF, af);
+        if (!unary)
+          this->writeFlag(triton::arch::ID_REG_X86_CF, cf);
+        this->writeFlag(triton::arch::ID_REG_X86_OF, of);
+        this->writeResultFlags(res, bits);
+
+        this->controlFlow(inst);
+        return true;
+      }
+
+
+      bool x8664Interpreter::logic_n(triton::arch::Instruction& inst) {
+        triton::uint32 type = inst.getType();
+
+        if (inst.operands.size() != 2)
+          return false;
+
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        if (!this->isConcreteRead(dst) || !this->isConcreteRead(src) || src.getBitSize() != dst.getBitSize())
+          return false;
+
+        triton::uint32 bits = dst.getBitSize();
+        triton::uint64 op1  = this->read(dst);
+        triton::uint64 op2  = this->read(src);
+        triton::uint64 res  = 0;
+
+        switch (type) {
+          case ID_INS_OR:  res = op1 | op2; break;
+          case ID_INS_XOR: res = op1 ^ op2; break;
+          default:         res = op1 & op2; break;
+        }
+
+        if (type != ID_INS_TEST)
+          this->write(dst, res);
+
+        this->writeFlag(triton::arch::ID_REG_X86_CF, false);
+        this->writeFlag(triton::arch::ID_REG_X86_OF, false);
+        this->writeResultFlags(res, bits);
+        this->undefinedFlag(triton::arch::ID_REG_X86_AF);
+
+        this->controlFlow(inst);
+        return true;
+      }
+
+
+      bool x8664Interpreter::shift_n(triton::arch::Instruction& inst) {
+        triton::uint32 type = inst.getType();
+
+        if (inst.operands.size() != 2)
+          return false;
+
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        if (!this->isConcreteRead(dst) || !this->isConcreteRead(src) || src.getBitSize() > dst.getBitSize())
+          return false;
+
+        triton::uint32 bits  = dst.getBitSize();
+        triton::uint32 msb   = bits - 1;
+        triton::uint64 op1   = this->read(dst);
+        triton::uint64 count = this->read(src) & (bits == triton::bitsize::qword ? triton::bitsize::qword-1 : triton::bitsize::dword-1);
+        triton::uint64 res   = 0;
+        bool cf              = false;
+        bool of              = false;
+
+        /* Same semantics as x86Semantics::shl_s(), shr_s() and sar_s() */
+        switch (type) {
+          case ID_INS_SAR: {
+            triton::sint64 sop1 = static_cast<triton::sint64>(this->signExtend(op1, bits));
+            res = static_cast<triton::uint64>(sop1 >> (count >= bits ? msb : count)) & this->mask(bits);
+            cf  = (count > bits) ? ((op1 >> msb) & 1) : (count != 0 && ((op1 >> (count - 1)) & 1));
+            of  = false;
+            break;
+          }
+
+          case ID_INS_SHR: {
+            res = (count >= bits) ? 0 : (op1 >> count);
+            cf  = (count - 1 >= bits) ? false : ((op1 >> (count - 1)) & 1);
+            of  = (op1 >> msb) & 1;
+            break;
+          }
+
+          default: {
+            triton::uint64 shift = (bits - count) & this->mask(bits);
+            res = (count >= bits) ? 0 : ((op1 << count) & this->mask(bits));
+            cf  = (shift >= bits) ? false : ((op1 >> shift) & 1);
+            of  = ((op1 >> msb) ^ (op1 >> (msb - 1))) & 1;
+            break;
+          }
+        }
+
+        this->write(dst, res);
+
+        /* Flags are unchanged if the masked count is zero */
+        if (count != 0) {
+          this->writeFlag(triton::arch::ID_REG_X86_CF, cf);
+          this->writeResultFlags(res, bits);
+          this->undefinedFlag(triton::arch::ID_REG_X86_AF);
+
+          if (count == 1) {
+            this->writeFlag(triton::arch::ID_REG_X86_OF, of);
+          }
+          else {
+            /* The overflow flag keeps its value but is undefined */
+            this->symbolicEngine->materializeLazyFlag(this->architecture->getRegister(triton::arch::ID_REG_X86_OF));
+            this->undefinedFlag(triton::arch::ID_REG_X86_OF);
+          }
+        }
+
+        this->controlFlow(inst);
+        return true;
+      }
+
+
+      bool x8664Interpreter::mov_n(triton::arch::Instruction& inst) {
+        triton::uint32 type = inst.getType();
+
+        if (inst.operands.size() != 2)
+          return false;
+
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        if (!this->isConcreteRead(src) || !this->isConcreteWrite(dst))
+          return false;
+
+        triton::uint64 value = this->read(src);
+
+        switch (type) {
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+            value = this->signExtend(value, src.getBitSize());
+            break;
+
+          case ID_INS_MOVZX:
+            break;
+
+          default:
+            if (src.getBitSize() != dst.getBitSize())
+              return false;
+            break;
+        }
+
+        this->write(dst, value);
+
+        this->controlFlow(inst);
+        return true;
+      }
+
+
+      bool x8664Interpreter::lea_n(triton::arch::Instruction& inst) {
+        if (inst.operands.size() != 2 || inst.operands[0].getType() != triton::arch::OP_REG || inst.operands[1].getType() != triton::arch::OP_MEM)
+          return false;
+
+        auto& dst                           = inst.operands[0];
+        triton::arch::MemoryAccess& mem     = inst.operands[1].getMemory();
+        const triton::arch::Register& base  = mem.getConstBaseRegister();
+        const triton::arch::Register& index = mem.getConstIndexRegister();
+        bool hasBase                        = this->architecture->isRegisterValid(base);
+        bool hasIndex                       = this->architecture->isRegisterValid(index);
+
+        if (!this->isConcreteWrite(dst) || !this->isConcreteAddress(mem))
+          return false;
+
+        /* The taint of the base and the index is spread to the destination */
+        if ((hasBase && !this->isConcreteRegister(base)) || (hasIndex && !this->isConcreteRegister(index)))
+          return false;
+
+        /* Same computation as x86Semantics::lea_s() */
+        triton::uint32 leaSize = hasBase ? base.getBitSize() : (hasIndex ? index.getBitSize() : mem.getConstDisplacement().getBitSize());
+        triton::uint64 value   = mem.getConstDisplacement().getValue();
+
+        if (hasBase) {
+          value += this->readRegister(base);
+          if (base.getParent() == this->architecture->getProgramCounter().getId())
+            value += inst.getSize();
+        }
+
+        if (hasIndex)
+          value += this->readRegister(index) * mem.getConstScale().getValue();
+
+        this->write(dst, value & this->mask(leaSize));
+
+        this->controlFlow(inst);
+        return true;
+      }
+
+
+      bool x8664Interpreter::push_n(triton::arch::Instruction& inst) {
+        const triton::arch::Register& sp = this->architecture->getStackPointer();
+
+        if (inst.operands.size() != 1)
+          return false;
+
+        auto& src = inst.operands[0];
+
+        if (!this->isConcreteRead(src) || !this->isConcreteRegister(sp))
+          return false;
+
+        /* If it's an immediate source, the memory access is always based on the arch size */
+        triton::uint32 size = (src.getType() == triton::arch::OP_IMM) ? sp.getSize() : src.getSize();
+        triton::uint64 value = this->read(src);
+        triton::uint64 stack = this->readRegister(sp) - size;
+
+        this->writeRegister(sp, stack);
+        this->writeMemory(triton::arch::MemoryAccess(stack, size), value);
+
+        this->controlFlow(inst);
+        return true;
+      }
+
+
+      bool x8664Interpreter::pop_n(triton::arch::Instruction& inst) {
+        const triton::arch::Register& sp = this->architecture->getStackPointer();
+
+        /* The address of a memory destination depends on the popped stack */
+        if (inst.operands.size() != 1 || inst.operands[0].getType() != triton::arch::OP_REG)
+          return false;
+
+        auto& dst = inst.operands[0];
+
+        if (!this->isConcreteWrite(dst) || !this->isConcreteRegister(sp))
+          return false;
+
+        triton::uint64 stack = this->readRegister(sp);
+        triton::arch::MemoryAccess mem(stack, dst.getSize());
+
+        if (this->symbolicEngine->isMemorySymbolized(stack, dst.getSize()) || this->taintEngine->isMemoryTainted(mem))
+          return false;
+
+        this->write(dst, this->readMemory(mem));
+
+        /* Don't increment SP if the destination register is SP */
+        if (dst.getConstRegister().getParent() != sp.getId())
+          this->writeRegister(sp, stack + dst.getSize());
+
+        this->controlFlow(inst);
+        return true;
+      }
+
+
+      bool x8664Interpreter::call_n(triton::arch::Instruction& inst) {
+        const triton::arch::Register& sp = this->architecture->getStackPointer();
+
+        if (!this->isPathConstraintSkipped() || inst.operands.size() != 1)
+          return false;
+
+        auto& src = inst.operands[0];
+
+        if (!this->isConcreteRead(src) || !this->isConcreteRegister(sp))
+          return false;
+
+        triton::uint64 target = this->read(src);
+        triton::uint64 stack  = this->readRegister(sp) - sp.getSize();
+
+        this->writeRegister(sp, stack);
+        this->writeMemory(triton::arch::MemoryAccess(stack, sp.getSize()), inst.getNextAddress());
+        this->writeRegister(this->architecture->getProgramCounter(), target);
+
+        return true;
+      }
+
+
+      bool x8664Interpreter::ret_n(triton::arch::Instruction& inst) {
+        const triton::arch::Register& sp = this->architecture->getStackPointer();
+
+        if (!this->isPathConstraintSkipped() || inst.operands.size() > 1)
+          return false;
+
+        if (inst.operands.size() == 1 && inst.operands[0].getType() != triton::arch::OP_IMM)
+          return false;
+
+        if (!this->isConcreteRegister(sp))
+          return false;
+
+        triton::uint64 stack = this->readRegister(sp);
+        triton::arch::MemoryAccess mem(stack, sp.getSize());
+
+        if (this->symbolicEngine->isMemorySymbolized(stack, sp.getSize()) || this->taintEngine->isMemoryTainted(mem))
+          return false;
+
+        triton::uint64 target = this->readMemory(mem);
+
+        stack += sp.getSize();
+        if (inst.operands.size() == 1)
+          stack += static_cast<triton::uint32>(inst.operands[0].getConstImmediate().getValue());
+
+        this->writeRegister(sp, stack);
+        this->writeRegister(this->architecture->getProgramCounter(), target);
+
+        return true;
+      }
+
+
+      bool x8664Interpreter::jmp_n(triton::arch::Instruction& inst) {
+        if (!this->isPathConstraintSkipped() || inst.operands.size() != 1)
+          return false;
+
+        auto& src = inst.operands[0];
+
+        if (!this->isConcreteRead(src))
+          return false;
+
+        this->writeRegister(this->architecture->getProgramCounter(), this->read(src));
+        inst.setConditionTaken(true);
+
+        return true;
+      }
+
+
+      bool x8664Interpreter::jcc_n(triton::arch::Instruction& inst) {
+        bool concrete = true;
+        bool taken    = false;
+
+        if (!this->isPathConstraintSkipped() || inst.operands.size() != 1 || inst.operands[0].getType() != triton::arch::OP_IMM)
+          return false;
+
+        /* The taint of the program counter is the union of the flags of the condition */
+        auto flag = [&](triton::arch::register_e id) {
+          concrete &= this->isConcreteFlag(id);
+          return this->readFlag(id);
+        };
+
+        switch (inst.getType()) {
+          case ID_INS_JA:   taken = !flag(triton::arch::ID_REG_X86_CF) & !flag(triton::arch::ID_REG_X86_ZF); break;
+          case ID_INS_JAE:  taken = !flag(triton::arch::ID_REG_X86_CF); break;
+          case ID_INS_JB:   taken = flag(triton::arch::ID_REG_X86_CF); break;
+          case ID_INS_JBE:  taken = flag(triton::arch::ID_REG_X86_CF) | flag(triton::arch::ID_REG_X86_ZF); break;
+          case ID_INS_JE:   taken = flag(triton::arch::ID_REG_X86_ZF); break;
+          case ID_INS_JG:   taken = !flag(triton::arch::ID_REG_X86_ZF) & (flag(triton::arch::ID_REG_X86_SF) == flag(triton::arch::ID_REG_X86_OF)); break;
+          case ID_INS_JGE:  taken = (flag(triton::arch::ID_REG_X86_SF) == flag(triton::arch::ID_REG_X86_OF)); break;
+          case ID_INS_JL:   taken = (flag(triton::arch::ID_REG_X86_SF) != flag(triton::arch::ID_REG_X86_OF)); break;
+          case ID_INS_JLE:  taken = flag(triton::arch::ID_REG_X86_ZF) | (flag(triton::arch::ID_REG_X86_SF) != flag(triton::arch::ID_REG_X86_OF)); break;
+          case ID_INS_JNE:  taken = !flag(triton::arch::ID_REG_X86_ZF); break;
+          case ID_INS_JNO:  taken = !flag(triton::arch::ID_REG_X86_OF); break;
+          case ID_INS_JNP:  taken = !flag(triton::arch::ID_REG_X86_PF); break;
+          case ID_INS_JNS:  taken = !flag(triton::arch::ID_REG_X86_SF); break;
+          case ID_INS_JO:   taken = flag(triton::arch::ID_REG_X86_OF); break;
+          case ID_INS_JP:   taken = flag(triton::arch::ID_REG_X86_PF); break;
+          case ID_INS_JS:   taken = flag(triton::arch::ID_REG_X86_SF); break;
+          default:
+            return false;
+        }
+
+        if (!concrete)
+          return false;
+
+        this->writeRegister(this->architecture->getProgramCounter(), taken ? this->read(inst.operands[0]) : inst.getNextAddress());
+        if (taken)
+          inst.setConditionTaken(true);
+
+        return true;
+      }
+
+
+      bool x8664Interpreter::nop_n(triton::arch::Instruction& inst) {
+        this->controlFlow(inst);
+        return true;
+      }
+
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
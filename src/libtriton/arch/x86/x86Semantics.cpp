@@ -1273,26 +1273,28 @@ namespace triton {
          * Create the semantic.
          * af = 0x10 == (0x10 & (regDst ^ op1 ^ op2))
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        this->astCtxt->bv(0x10, bvSize),
-                        this->astCtxt->bvand(
-                          this->astCtxt->bv(0x10, bvSize),
-                          this->astCtxt->bvxor(
-                            this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                            this->astCtxt->bvxor(op1, op2)
-                          )
-                        )
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag");
+        auto node = [=](void) {
+          return this->astCtxt->ite(
+                   this->astCtxt->equal(
+                     this->astCtxt->bv(0x10, bvSize),
+                     this->astCtxt->bvand(
+                       this->astCtxt->bv(0x10, bvSize),
+                       this->astCtxt->bvxor(
+                         this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
+                         this->astCtxt->bvxor(op1, op2)
+                       )
+                     )
+                   ),
+                   this->astCtxt->bv(1, 1),
+                   this->astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag", tainted);
       }
 
 
@@ -1309,23 +1311,25 @@ namespace triton {
          * Create the semantic.
          * af = 1 if ((AL AND 0FH) > 9) or (AF = 1) then 0
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->lor(
-                        this->astCtxt->bvugt(
-                          this->astCtxt->bvand(op1, this->astCtxt->bv(0xf, bvSize)),
-                          this->astCtxt->bv(9, bvSize)
-                        ),
-                        this->astCtxt->equal(op3, this->astCtxt->bvtrue())
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag");
+        auto node = [=](void) {
+          return this->astCtxt->ite(
+                   this->astCtxt->lor(
+                     this->astCtxt->bvugt(
+                       this->astCtxt->bvand(op1, this->astCtxt->bv(0xf, bvSize)),
+                       this->astCtxt->bv(9, bvSize)
+                     ),
+                     this->astCtxt->equal(op3, this->astCtxt->bvtrue())
+                   ),
+                   this->astCtxt->bv(1, 1),
+                   this->astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag", tainted);
       }
 
 
@@ -1343,26 +1347,28 @@ namespace triton {
          * Create the semantic.
          * af = 0x10 == (0x10 & (op1 ^ regDst))
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        this->astCtxt->bv(0x10, bvSize),
-                        this->astCtxt->bvand(
-                          this->astCtxt->bv(0x10, bvSize),
-                          this->astCtxt->bvxor(
-                            op1,
-                            this->astCtxt->extract(high, low, this->astCtxt->reference(parent))
-                          )
-                        )
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag");
+        auto node = [=](void) {
+          return this->astCtxt->ite(
+                   this->astCtxt->equal(
+                     this->astCtxt->bv(0x10, bvSize),
+                     this->astCtxt->bvand(
+                       this->astCtxt->bv(0x10, bvSize),
+                       this->astCtxt->bvxor(
+                         op1,
+                         this->astCtxt->extract(high, low, this->astCtxt->reference(parent))
+                       )
+                     )
+                   ),
+                   this->astCtxt->bv(1, 1),
+                   this->astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_AF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_AF), "Adjust flag", tainted);
       }
 
 
@@ -1379,23 +1385,25 @@ namespace triton {
          * Create the semantic.
          * cf = 1 if ((AL AND 0FH) > 9) or (AF = 1) then 0
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->lor(
-                        this->astCtxt->bvugt(
-                          this->astCtxt->bvand(op1, this->astCtxt->bv(0xf, bvSize)),
-                          this->astCtxt->bv(9, bvSize)
-                        ),
-                        this->astCtxt->equal(op3, this->astCtxt->bvtrue())
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
+        auto node = [=](void) {
+          return this->astCtxt->ite(
+                   this->astCtxt->lor(
+                     this->astCtxt->bvugt(
+                       this->astCtxt->bvand(op1, this->astCtxt->bv(0xf, bvSize)),
+                       this->astCtxt->bv(9, bvSize)
+                     ),
+                     this->astCtxt->equal(op3, this->astCtxt->bvtrue())
+                   ),
+                   this->astCtxt->bv(1, 1),
+                   this->astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag", tainted);
       }
 
 
@@ -1414,23 +1422,25 @@ namespace triton {
          * Create the semantic.
          * cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ parent) & (op1 ^ op2)));
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvxor(
-                        this->astCtxt->bvand(op1, op2),
-                        this->astCtxt->bvand(
-                          this->astCtxt->bvxor(
-                            this->astCtxt->bvxor(op1, op2),
-                            this->astCtxt->extract(high, low, this->astCtxt->reference(parent))
-                          ),
-                        this->astCtxt->bvxor(op1, op2))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
+        auto node = [=](void) {
+          return this->astCtxt->extract(bvSize-1, bvSize-1,
+                   this->astCtxt->bvxor(
+                     this->astCtxt->bvand(op1, op2),
+                     this->astCtxt->bvand(
+                       this->astCtxt->bvxor(
+                         this->astCtxt->bvxor(op1, op2),
+                         this->astCtxt->extract(high, low, this->astCtxt->reference(parent))
+                       ),
+                     this->astCtxt->bvxor(op1, op2))
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag", tainted);
       }
 
 
@@ -1557,20 +1567,22 @@ namespace triton {
          * Create the semantic.
          * cf = 0 == parent
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        this->astCtxt->extract(high, low, op1),
-                        this->astCtxt->bv(0, bvSize)
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
+        auto node = [=](void) {
+          return this->astCtxt->ite(
+                   this->astCtxt->equal(
+                     this->astCtxt->extract(high, low, op1),
+                     this->astCtxt->bv(0, bvSize)
+                   ),
+                   this->astCtxt->bv(1, 1),
+                   this->astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag", tainted);
       }
 
 
@@ -1641,20 +1653,22 @@ namespace triton {
          * Create the semantic.
          * cf = 0 == regDst
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                        this->astCtxt->bv(0, bvSize)
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
+        auto node = [=](void) {
+          return this->astCtxt->ite(
+                   this->astCtxt->equal(
+                     this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
+                     this->astCtxt->bv(0, bvSize)
+                   ),
+                   this->astCtxt->bv(1, 1),
+                   this->astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag", tainted);
       }
 
 
@@ -1997,21 +2011,23 @@ namespace triton {
          * Create the semantic.
          * cf = extract(bvSize, bvSize (((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)))))
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvxor(
-                        this->astCtxt->bvxor(op1, this->astCtxt->bvxor(op2, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))),
-                        this->astCtxt->bvand(
-                          this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent))),
-                          this->astCtxt->bvxor(op1, op2)
-                        )
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
+        auto node = [=](void) {
+          return this->astCtxt->extract(bvSize-1, bvSize-1,
+                   this->astCtxt->bvxor(
+                     this->astCtxt->bvxor(op1, this->astCtxt->bvxor(op2, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))),
+                     this->astCtxt->bvand(
+                       this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent))),
+                       this->astCtxt->bvxor(op1, op2)
+                     )
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag", tainted);
       }
 
 
@@ -2059,20 +2075,22 @@ namespace triton {
          * Create the semantic.
          * cf = 0 == parent
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        this->astCtxt->extract(high, low, op1),
-                        this->astCtxt->bv(0, bvSize)
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag");
+        auto node = [=](void) {
+          return this->astCtxt->ite(
+                   this->astCtxt->equal(
+                     this->astCtxt->extract(high, low, op1),
+                     this->astCtxt->bv(0, bvSize)
+                   ),
+                   this->astCtxt->bv(1, 1),
+                   this->astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_CF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_CF), "Carry flag", tainted);
       }
 
 
@@ -2091,18 +2109,20 @@ namespace triton {
          * Create the semantic.
          * of = MSB((op1 ^ ~op2) & (op1 ^ regDst))
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvand(
-                        this->astCtxt->bvxor(op1, this->astCtxt->bvnot(op2)),
-                        this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag");
+        auto node = [=](void) {
+          return this->astCtxt->extract(bvSize-1, bvSize-1,
+                   this->astCtxt->bvand(
+                     this->astCtxt->bvxor(op1, this->astCtxt->bvnot(op2)),
+                     this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag", tainted);
       }
 
 
@@ -2174,18 +2194,20 @@ namespace triton {
          * Create the semantic.
          * of = (res & op1) >> (bvSize - 1) & 1
          */
-        auto node = this->astCtxt->extract(0, 0,
-                      this->astCtxt->bvlshr(
-                        this->astCtxt->bvand(this->astCtxt->extract(high, low, this->astCtxt->reference(parent)), op1),
-                        this->astCtxt->bvsub(this->astCtxt->bv(bvSize, bvSize), this->astCtxt->bv(1, bvSize))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag");
+        auto node = [=](void) {
+          return this->astCtxt->extract(0, 0,
+                   this->astCtxt->bvlshr(
+                     this->astCtxt->bvand(this->astCtxt->extract(high, low, this->astCtxt->reference(parent)), op1),
+                     this->astCtxt->bvsub(this->astCtxt->bv(bvSize, bvSize), this->astCtxt->bv(1, bvSize))
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag", tainted);
       }
 
 
@@ -2519,18 +2541,20 @@ namespace triton {
          * Create the semantic.
          * of = high:bool((op1 ^ op2) & (op1 ^ regDst))
          */
-        auto node = this->astCtxt->extract(bvSize-1, bvSize-1,
-                      this->astCtxt->bvand(
-                        this->astCtxt->bvxor(op1, op2),
-                        this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag");
+        auto node = [=](void) {
+          return this->astCtxt->extract(bvSize-1, bvSize-1,
+                   this->astCtxt->bvand(
+                     this->astCtxt->bvxor(op1, op2),
+                     this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(parent)))
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_OF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_OF), "Overflow flag", tainted);
       }
 
 
@@ -2548,16 +2572,19 @@ namespace triton {
          * pf is set to one if there is an even number of bit set to 1 in the least
          * significant byte of the result.
          */
-        auto node = this->astCtxt->bv(1, 1);
-        for (triton::uint32 counter = 0; counter <= triton::bitsize::byte-1; counter++) {
-          node = this->astCtxt->bvxor(node, this->astCtxt->extract(counter, counter, this->astCtxt->reference(parent)));
-        }
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_PF), "Parity flag");
+        auto node = [=](void) {
+          auto pf = this->astCtxt->bv(1, 1);
+          for (triton::uint32 counter = 0; counter <= triton::bitsize::byte-1; counter++) {
+            pf = this->astCtxt->bvxor(pf, this->astCtxt->extract(counter, counter, this->astCtxt->reference(parent)));
+          }
+          return pf;
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_PF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_PF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_PF), "Parity flag", tainted);
       }
 
 
@@ -2639,13 +2666,15 @@ namespace triton {
          * Create the semantic.
          * sf = high:bool(regDst)
          */
-        auto node = this->astCtxt->extract(high, high, this->astCtxt->reference(parent));
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_SF), "Sign flag");
+        auto node = [=](void) {
+          return this->astCtxt->extract(high, high, this->astCtxt->reference(parent));
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_SF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_SF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_SF), "Sign flag", tainted);
       }
 
 
@@ -2781,20 +2810,22 @@ namespace triton {
          * Create the semantic.
          * zf = 0 == regDst
          */
-        auto node = this->astCtxt->ite(
-                      this->astCtxt->equal(
-                        this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
-                        this->astCtxt->bv(0, bvSize)
-                      ),
-                      this->astCtxt->bv(1, 1),
-                      this->astCtxt->bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_ZF), "Zero flag");
+        auto node = [=](void) {
+          return this->astCtxt->ite(
+                   this->astCtxt->equal(
+                     this->astCtxt->extract(high, low, this->astCtxt->reference(parent)),
+                     this->astCtxt->bv(0, bvSize)
+                   ),
+                   this->astCtxt->bv(1, 1),
+                   this->astCtxt->bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_ZF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_ZF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_ZF), "Zero flag", tainted);
       }
 
 
@@ -2807,18 +2838,20 @@ namespace triton {
          * Create the semantic.
          * zf = fpisZero(regDst)
          */
-        auto node = 
-          this->astCtxt->ite(
-            this->astCtxt->fpisZero(this->astCtxt->reference(parent)),
-            this->astCtxt->bv(1, 1),
-            this->astCtxt->bv(0, 1)
-          );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, this->architecture->getRegister(ID_REG_X86_ZF), "Zero flag");
+        auto node = [=](void) {
+          return 
+       this->astCtxt->ite(
+         this->astCtxt->fpisZero(this->astCtxt->reference(parent)),
+         this->astCtxt->bv(1, 1),
+         this->astCtxt->bv(0, 1)
+       );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_ZF), parent->isTainted);
+        bool tainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(ID_REG_X86_ZF), parent->isTainted);
+
+        /* Create the symbolic expression, its AST is built on read in the LAZY_FLAGS mode */
+        this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(ID_REG_X86_ZF), "Zero flag", tainted);
       }
 
 
@@ -5278,16 +5311,10 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getFp32Ast(dst.getConstRegister());
-        std::string op1Str = triton::utils::toString(op1);
-        //std::cout << "op1: " << op1Str << std::endl;
         auto op2 = this->symbolicEngine->getFp32Ast(src.getConstRegister());
-        std::string op2Str = triton::utils::toString(op2);
-        //std::cout << "op2: " << op2Str << std::endl;
   
         /* Create the semantics */
         auto node = this->astCtxt->fpsub(op1, op2);
-        std::string nodeStr = triton::utils::toString(node);
-        //std::cout << "comiss_s node: " << nodeStr << std::endl;
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicVolatileExpression(inst, node, "COMISS operation");
@@ -5312,16 +5339,10 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getFp64Ast(dst.getConstRegister());
-        std::string op1Str = triton::utils::toString(op1);
-        //std::cout << "op1: " << op1Str << std::endl;
         auto op2 = this->symbolicEngine->getFp64Ast(src.getConstRegister());
-        std::string op2Str = triton::utils::toString(op2);
-        //std::cout << "op2: " << op2Str << std::endl;
 
         /* Create the semantics */
         auto node = this->astCtxt->fpsub(op1, op2);
-        std::string nodeStr = triton::utils::toString(node);
-        //std::cout << "comisd_s node: " << nodeStr << std::endl;
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicVolatileExpression(inst, node, "COMISD operation");
@@ -7676,20 +7697,9 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, cf);
-        std::string op1Str = triton::utils::toString(op1);
-        //std::cout << "op1Str: " << op1Str << std::endl;
-
         auto op2 = this->symbolicEngine->getOperandAst(inst, zf);
-        std::string op2Str = triton::utils::toString(op2);
-        //std::cout << "op2Str: " << op2Str << std::endl;
-        
         auto op3 = this->symbolicEngine->getOperandAst(inst, srcImm1);
-        std::string op3Str = triton::utils::toString(op3);
-        //std::cout << "op3Str: " << op3Str << std::endl;
-        
         auto op4 = this->symbolicEngine->getOperandAst(inst, srcImm2);
-        std::string op4Str = triton::utils::toString(op4);
-        //std::cout << "op4Str: " << op4Str << std::endl;
 
         /* Create the semantics */
         auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvor(op1, op2), this->astCtxt->bvtrue()), op4, op3);
@@ -7961,10 +7971,6 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->getOperandAst(inst, zf);
-
-        std::string op1Str = triton::utils::toString(op1);
-        //std::cout << "AstContext::op1: " << op1Str << std::endl;
-
         auto op2 = this->symbolicEngine->getOperandAst(inst, srcImm1);
         auto op3 = this->symbolicEngine->getOperandAst(inst, srcImm2);
 
@@ -8778,8 +8784,6 @@ namespace triton {
 
         /* Create the semantics */
         auto node = this->symbolicEngine->getOperandAst(inst, src);
-        std::string nodeStr = triton::utils::toString(node);
-        //std::cout << "node: " << nodeStr << std::endl;
 
         /*
          * Special cases:
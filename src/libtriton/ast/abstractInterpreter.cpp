@@ -0,0 +1,548 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <stack>
+#include <tuple>
+
+#include <triton/abstractInterpreter.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Returns the mask of `size` bits */
+    static triton::uint64 maskOf(triton::uint32 size) {
+      return (size >= 64) ? 0xffffffffffffffff : ((static_cast<triton::uint64>(1) << size) - 1);
+    }
+
+
+    /* Sign-extends a value of `size` bits */
+    static triton::sint64 toSigned(triton::uint64 value, triton::uint32 size) {
+      triton::uint64 sign = static_cast<triton::uint64>(1) << (size - 1);
+      return static_cast<triton::sint64>(((value & maskOf(size)) ^ sign) - sign);
+    }
+
+
+    /* Returns the number of trailing bits known to be zero */
+    static triton::uint32 trailingZeros(const AbstractValue& value) {
+      triton::uint32 count = 0;
+      while (count < value.size && (value.zeros >> count) & 1)
+        count++;
+      return count;
+    }
+
+
+    /* Returns a logical value, unknown if neither `isTrue` nor `isFalse` */
+    static AbstractValue boolean(bool isTrue, bool isFalse) {
+      if (isTrue)
+        return AbstractValue(1, 1);
+      if (isFalse)
+        return AbstractValue(0, 1);
+      return AbstractValue(1);
+    }
+
+
+    /* Computes the known bits of a + b + carry, like LLVM's KnownBits::computeForAddCarry */
+    static void addCarry(const AbstractValue& a, const AbstractValue& b, bool carry, AbstractValue& r) {
+      triton::uint64 mask = r.getMask();
+      triton::uint64 sumZero = (~a.zeros & mask) + (~b.zeros & mask) + carry;
+      triton::uint64 sumOne  = a.ones + b.ones + carry;
+      triton::uint64 carryKnownZero = ~(sumZero ^ a.zeros ^ b.zeros);
+      triton::uint64 carryKnownOne  = sumOne ^ a.ones ^ b.ones;
+      triton::uint64 known = (a.zeros | a.ones) & (b.zeros | b.ones) & (carryKnownZero | carryKnownOne);
+
+      r.zeros = ~sumZero & known & mask;
+      r.ones  = sumOne & known & mask;
+    }
+
+
+    AbstractValue::AbstractValue() {
+      this->size  = 0;
+      this->zeros = 0;
+      this->ones  = 0;
+      this->umin  = 0;
+      this->umax  = 0;
+      this->smin  = 0;
+      this->smax  = 0;
+    }
+
+
+    AbstractValue::AbstractValue(triton::uint32 size) : AbstractValue() {
+      if (size == 0 || size > 64)
+        return;
+      this->size = size;
+      this->umax = this->getMask();
+      this->smin = toSigned(static_cast<triton::uint64>(1) << (size - 1), size);
+      this->smax = toSigned(this->umax >> 1, size);
+    }
+
+
+    AbstractValue::AbstractValue(triton::uint64 value, triton::uint32 size) : AbstractValue(size) {
+      if (!this->isTracked())
+        return;
+      value &= this->getMask();
+      this->zeros = ~value & this->getMask();
+      this->ones  = value;
+      this->umin  = value;
+      this->umax  = value;
+      this->smin  = toSigned(value, size);
+      this->smax  = this->smin;
+    }
+
+
+    triton::uint64 AbstractValue::getMask(void) const {
+      return maskOf(this->size);
+    }
+
+
+    bool AbstractValue::isTracked(void) const {
+      return this->size != 0;
+    }
+
+
+    bool AbstractValue::isConstant(void) const {
+      return this->isTracked() && (this->zeros | this->ones) == this->getMask();
+    }
+
+
+    bool AbstractValue::isTrue(void) const {
+      return this->size == 1 && this->ones == 1;
+    }
+
+
+    bool AbstractValue::isFalse(void) const {
+      return this->size == 1 && this->zeros == 1;
+    }
+
+
+    void AbstractValue::refine(void) {
+      if (!this->isTracked())
+        return;
+
+      triton::uint64 mask = this->getMask();
+      triton::uint64 sign = static_cast<triton::uint64>(1) << (this->size - 1);
+
+      /* Known bits and signed interval bound the unsigned interval */
+      this->zeros &= mask;
+      this->ones  &= mask;
+      this->umin   = std::max(this->umin, this->ones);
+      this->umax   = std::min(this->umax, ~this->zeros & mask);
+
+      if (this->smin >= 0) {
+        this->umin = std::max(this->umin, static_cast<triton::uint64>(this->smin));
+        this->umax = std::min(this->umax, static_cast<triton::uint64>(this->smax));
+      }
+      else if (this->smax < 0) {
+        this->umin = std::max(this->umin, static_cast<triton::uint64>(this->smin) & mask);
+        this->umax = std::min(this->umax, static_cast<triton::uint64>(this->smax) & mask);
+      }
+
+      /* Contradictory facts only come from unreachable nodes */
+      if (this->umin > this->umax)
+        return;
+
+      /* The bits above the highest differing bit of the bounds are known */
+      triton::uint64 diff = this->umin ^ this->umax;
+      triton::uint64 prefix = mask;
+      if (diff) {
+        triton::uint32 high = 63;
+        while (((diff >> high) & 1) == 0)
+          high--;
+        prefix = ~((static_cast<triton::uint64>(2) << high) - 1) & mask;
+      }
+      this->zeros |= ~this->umin & prefix;
+      this->ones  |= this->umin & prefix;
+
+      /* The unsigned interval bounds the signed one if it does not cross the sign */
+      if (this->umax < sign) {
+        this->smin = std::max(this->smin, static_cast<triton::sint64>(this->umin));
+        this->smax = std::min(this->smax, static_cast<triton::sint64>(this->umax));
+      }
+      else if (this->umin >= sign) {
+        this->smin = std::max(this->smin, toSigned(this->umin, this->size));
+        this->smax = std::min(this->smax, toSigned(this->umax, this->size));
+      }
+    }
+
+
+    AbstractValue AbstractValue::join(const AbstractValue& a, const AbstractValue& b) {
+      AbstractValue r;
+
+      if (!a.isTracked() || a.size != b.size)
+        return r;
+
+      r.size  = a.size;
+      r.zeros = a.zeros & b.zeros;
+      r.ones  = a.ones & b.ones;
+      r.umin  = std::min(a.umin, b.umin);
+      r.umax  = std::max(a.umax, b.umax);
+      r.smin  = std::min(a.smin, b.smin);
+      r.smax  = std::max(a.smax, b.smax);
+
+      return r;
+    }
+
+
+    AbstractInterpreter::AbstractInterpreter() {
+      this->sweepThreshold = 0x10000;
+    }
+
+
+    bool AbstractInterpreter::isComputed(const triton::ast::SharedAbstractNode& node) const {
+      auto it = this->values.find(node.get());
+
+      /* A node changed in place (e.g. setChild() or a symbolized expression) is analyzed again */
+      return it != this->values.end() && !it->second.node.expired() && it->second.revision == node->getRevision();
+    }
+
+
+    const triton::ast::AbstractValue& AbstractInterpreter::get(const triton::ast::SharedAbstractNode& node) const {
+      auto it = this->values.find(node.get());
+      if (it == this->values.end())
+        throw triton::exceptions::Ast("AbstractInterpreter::get(): Node not analyzed.");
+      return it->second.value;
+    }
+
+
+    void AbstractInterpreter::sweep(void) {
+      if (this->values.size() < this->sweepThreshold)
+        return;
+
+      for (auto it = this->values.begin(); it != this->values.end();) {
+        if (it->second.node.expired())
+          it = this->values.erase(it);
+        else
+          it++;
+      }
+
+      /* Sweeping again once the live entries have doubled keeps it amortized */
+      this->sweepThreshold = std::max<triton::usize>(0x10000, this->values.size() * 2);
+    }
+
+
+    triton::ast::AbstractValue AbstractInterpreter::analyze(const triton::ast::SharedAbstractNode& node) {
+      std::stack<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
+
+      if (node == nullptr)
+        throw triton::exceptions::Ast("AbstractInterpreter::analyze(): node cannot be null.");
+
+      /* Sub-DAGs analyzed by a previous query are not visited again */
+      worklist.push({node, false});
+      while (!worklist.empty()) {
+        triton::ast::SharedAbstractNode n;
+        bool postOrder;
+        std::tie(n, postOrder) = worklist.top();
+        worklist.pop();
+
+        if (this->isComputed(n))
+          continue;
+
+        /* All children have been analyzed */
+        if (postOrder) {
+          AbstractValue value = this->transfer(n);
+          this->values.erase(n.get());
+          this->values.emplace(n.get(), Entry(n, value));
+          continue;
+        }
+
+        worklist.push({n, true});
+
+        for (const auto& child : n->getChildren()) {
+          if (!this->isComputed(child))
+            worklist.push({child, false});
+        }
+
+        /* References are unrolled */
+        if (n->getType() == triton::ast::REFERENCE_NODE) {
+          const auto& ref = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst();
+          if (!this->isComputed(ref))
+            worklist.push({ref, false});
+        }
+      }
+
+      AbstractValue value = this->get(node);
+      this->sweep();
+
+      return value;
+    }
+
+
+    triton::ast::AbstractValue AbstractInterpreter::transfer(const triton::ast::SharedAbstractNode& node) const {
+      const auto& children = node->getChildren();
+      triton::uint32 size  = node->getBitvectorSize();
+      AbstractValue r(size);
+
+      if (node->isArray() || !r.isTracked())
+        return AbstractValue();
+
+      /* Sub-trees without symbolic variables are constants */
+      if (!node->isSymbolized())
+        return AbstractValue(static_cast<triton::uint64>(node->evaluate()), size);
+
+      triton::uint64 mask = r.getMask();
+
+      switch (node->getType()) {
+        case triton::ast::REFERENCE_NODE:
+          return this->get(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst());
+
+        case triton::ast::ZX_NODE: {
+          const auto& x = this->get(children[1]);
+          if (!x.isTracked())
+            return r;
+          r.zeros = x.zeros | (mask & ~x.getMask());
+          r.ones  = x.ones;
+          r.umin  = x.umin;
+          r.umax  = x.umax;
+          break;
+        }
+
+        case triton::ast::SX_NODE: {
+          const auto& x = this->get(children[1]);
+          if (!x.isTracked())
+            return r;
+          triton::uint64 sign = static_cast<triton::uint64>(1) << (x.size - 1);
+          triton::uint64 ext  = mask & ~x.getMask();
+          r.zeros = x.zeros | ((x.zeros & sign) ? ext : 0);
+          r.ones  = x.ones | ((x.ones & sign) ? ext : 0);
+          r.smin  = x.smin;
+          r.smax  = x.smax;
+          break;
+        }
+
+        case triton::ast::EXTRACT_NODE: {
+          triton::uint32 low = static_cast<triton::uint32>(reinterpret_cast<triton::ast::IntegerNode*>(children[1].get())->getInteger());
+          const auto& x = this->get(children[2]);
+          if (!x.isTracked())
+            return r;
+          r.zeros = x.zeros >> low;
+          r.ones  = x.ones >> low;
+          if (low == 0 && x.umax <= mask) {
+            r.umin = x.umin;
+            r.umax = x.umax;
+          }
+          break;
+        }
+
+        case triton::ast::CONCAT_NODE: {
+          triton::uint32 shift = size;
+          for (const auto& child : children) {
+            const auto& x = this->get(child);
+            if (!x.isTracked())
+              return AbstractValue(size);
+            shift   -= x.size;
+            r.zeros |= x.zeros << shift;
+            r.ones  |= x.ones << shift;
+          }
+          break;
+        }
+
+        case triton::ast::BVNOT_NODE: {
+          const auto& x = this->get(children[0]);
+          if (!x.isTracked())
+            return r;
+          r.zeros = x.ones;
+          r.ones  = x.zeros;
+          r.umin  = mask - x.umax;
+          r.umax  = mask - x.umin;
+          r.smin  = -1 - x.smax;
+          r.smax  = -1 - x.smin;
+          break;
+        }
+
+        case triton::ast::BVNEG_NODE: {
+          const auto& x = this->get(children[0]);
+          if (!x.isTracked())
+            return r;
+          AbstractValue nx(size);
+          nx.zeros = x.ones;
+          nx.ones  = x.zeros;
+          addCarry(AbstractValue(0, size), nx, true, r);
+          break;
+        }
+
+        case triton::ast::ITE_NODE: {
+          const auto& cond = this->get(children[0]);
+          if (cond.isTrue())
+            return this->get(children[1]);
+          if (cond.isFalse())
+            return this->get(children[2]);
+          r = AbstractValue::join(this->get(children[1]), this->get(children[2]));
+          break;
+        }
+
+        case triton::ast::LNOT_NODE: {
+          const auto& x = this->get(children[0]);
+          return boolean(x.isFalse(), x.isTrue());
+        }
+
+        case triton::ast::LAND_NODE:
+        case triton::ast::LOR_NODE: {
+          bool all = true, any = false;
+          bool conjunction = (node->getType() == triton::ast::LAND_NODE);
+          for (const auto& child : children) {
+            const auto& x = this->get(child);
+            all &= (conjunction ? x.isTrue() : x.isFalse());
+            any |= (conjunction ? x.isFalse() : x.isTrue());
+          }
+          return conjunction ? boolean(all, any) : boolean(any, all);
+        }
+
+        default: {
+          if (children.size() != 2)
+            return r;
+
+          const auto& a = this->get(children[0]);
+          const auto& b = this->get(children[1]);
+          if (!a.isTracked() || !b.isTracked() || a.size != b.size)
+            return r;
+
+          switch (node->getType()) {
+            case triton::ast::BVAND_NODE:
+              r.zeros = a.zeros | b.zeros;
+              r.ones  = a.ones & b.ones;
+              r.umax  = std::min(a.umax, b.umax);
+              break;
+
+            case triton::ast::BVOR_NODE:
+              r.zeros = a.zeros & b.zeros;
+              r.ones  = a.ones | b.ones;
+              r.umin  = std::max(a.umin, b.umin);
+              break;
+
+            case triton::ast::BVXOR_NODE:
+              r.zeros = (a.zeros & b.zeros) | (a.ones & b.ones);
+              r.ones  = (a.zeros & b.ones) | (a.ones & b.zeros);
+              break;
+
+            case triton::ast::BVADD_NODE:
+              addCarry(a, b, false, r);
+              if (a.umax <= mask - b.umax) {
+                r.umin = a.umin + b.umin;
+                r.umax = a.umax + b.umax;
+              }
+              break;
+
+            case triton::ast::BVSUB_NODE: {
+              AbstractValue nb(size);
+              nb.zeros = b.ones;
+              nb.ones  = b.zeros;
+              addCarry(a, nb, true, r);
+              if (a.umin >= b.umax) {
+                r.umin = a.umin - b.umax;
+                r.umax = a.umax - b.umin;
+              }
+              break;
+            }
+
+            case triton::ast::BVMUL_NODE: {
+              triton::uint32 tz = std::min(trailingZeros(a) + trailingZeros(b), size);
+              r.zeros = maskOf(tz);
+              if (b.umax == 0 || a.umax <= mask / b.umax) {
+                r.umin = a.umin * b.umin;
+                r.umax = a.umax * b.umax;
+              }
+              break;
+            }
+
+            case triton::ast::BVUDIV_NODE:
+              /* A division by zero is all ones */
+              if (b.umin > 0) {
+                r.umin = a.umin / b.umax;
+                r.umax = a.umax / b.umin;
+              }
+              break;
+
+            case triton::ast::BVUREM_NODE:
+              /* A remainder by zero is the dividend */
+              r.umax = (b.umin > 0) ? std::min(a.umax, b.umax - 1) : a.umax;
+              break;
+
+            case triton::ast::BVSHL_NODE:
+            case triton::ast::BVLSHR_NODE:
+            case triton::ast::BVASHR_NODE: {
+              bool left  = (node->getType() == triton::ast::BVSHL_NODE);
+              bool arith = (node->getType() == triton::ast::BVASHR_NODE);
+
+              if (!b.isConstant()) {
+                if (node->getType() == triton::ast::BVLSHR_NODE)
+                  r.umax = a.umax;
+                break;
+              }
+
+              triton::uint64 sign  = static_cast<triton::uint64>(1) << (size - 1);
+              triton::uint32 shift = static_cast<triton::uint32>(std::min<triton::uint64>(b.ones, size));
+              if (shift == size && !arith)
+                return AbstractValue(0, size);
+              if (shift == size)
+                shift = size - 1;
+
+              if (left) {
+                r.zeros = ((a.zeros << shift) | maskOf(shift)) & mask;
+                r.ones  = (a.ones << shift) & mask;
+                break;
+              }
+
+              triton::uint64 high = mask & ~(mask >> shift);
+              r.zeros = (a.zeros >> shift) | ((!arith || (a.zeros & sign)) ? high : 0);
+              r.ones  = (a.ones >> shift) | ((arith && (a.ones & sign)) ? high : 0);
+              if (arith) {
+                r.smin = a.smin >> shift;
+                r.smax = a.smax >> shift;
+              }
+              else {
+                r.umin = a.umin >> shift;
+                r.umax = a.umax >> shift;
+              }
+              break;
+            }
+
+            case triton::ast::EQUAL_NODE:
+            case triton::ast::DISTINCT_NODE: {
+              bool differ = ((a.ones & b.zeros) | (a.zeros & b.ones)) != 0 ||
+                            a.umax < b.umin || b.umax < a.umin || a.smax < b.smin || b.smax < a.smin;
+              bool equal  = a.isConstant() && b.isConstant() && a.ones == b.ones;
+              if (node->getType() == triton::ast::EQUAL_NODE)
+                return boolean(equal, differ);
+              return boolean(differ, equal);
+            }
+
+            case triton::ast::BVULT_NODE: return boolean(a.umax < b.umin, a.umin >= b.umax);
+            case triton::ast::BVULE_NODE: return boolean(a.umax <= b.umin, a.umin > b.umax);
+            case triton::ast::BVUGT_NODE: return boolean(b.umax < a.umin, b.umin >= a.umax);
+            case triton::ast::BVUGE_NODE: return boolean(b.umax <= a.umin, b.umin > a.umax);
+            case triton::ast::BVSLT_NODE: return boolean(a.smax < b.smin, a.smin >= b.smax);
+            case triton::ast::BVSLE_NODE: return boolean(a.smax <= b.smin, a.smin > b.smax);
+            case triton::ast::BVSGT_NODE: return boolean(b.smax < a.smin, b.smin >= a.smax);
+            case triton::ast::BVSGE_NODE: return boolean(b.smax <= a.smin, b.smin > a.smax);
+
+            default:
+              break;
+          }
+          break;
+        }
+      }
+
+      r.refine();
+      return r;
+    }
+
+
+    void AbstractInterpreter::clear(void) {
+      this->values.clear();
+    }
+
+
+    triton::usize AbstractInterpreter::size(void) const {
+      return this->values.size();
+    }
+
+  };
+};
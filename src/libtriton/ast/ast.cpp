@@ -34,6 +34,7 @@ namespace triton {
       this->eval        = 0;
       this->hash        = 0;
       this->logical     = false;
+      this->revision    = 0;
       this->level       = 1;
       this->size        = 0;
       this->symbolized  = false;
@@ -52,6 +53,11 @@ namespace triton {
     }
 
 
+    triton::ast::AbstractValue AbstractNode::getAbstractValue(void) {
+      return this->ctxt->getAbstractValue(this->shared_from_this());
+    }
+
+
     triton::ast::ast_e AbstractNode::getType(void) const {
       return this->type;
     }
@@ -168,6 +174,11 @@ namespace triton {
     }
 
 
+    triton::usize AbstractNode::getRevision(void) const {
+      return this->revision;
+    }
+
+
     triton::uint32 AbstractNode::getLevel(void) const {
       return this->level;
     }
@@ -176,11 +187,20 @@ namespace triton {
     void AbstractNode::initParents(void) {
       auto ancestors = parentsExtraction(this->shared_from_this(), false);
       for (auto& sp : ancestors) {
+        sp->revision++;
         sp->init();
       }
     }
 
 
+    void AbstractNode::reviseParents(void) {
+      auto ancestors = parentsExtraction(this->shared_from_this(), false);
+      for (auto& sp : ancestors) {
+        sp->revision++;
+      }
+    }
+
+
     std::vector<SharedAbstractNode>& AbstractNode::getChildren(void) {
       return this->children;
     }
@@ -34,6 +34,7 @@ namespace triton {
     AstContext& AstContext::operator=(const AstContext& other) {
       std::enable_shared_from_this<AstContext>::operator=(other);
 
+      this->abstraction       = other.abstraction;
       this->astRepresentation = other.astRepresentation;
       this->modes             = other.modes;
       this->nodes             = other.nodes;
@@ -71,6 +72,11 @@ namespace triton {
     }
 
 
+    triton::ast::AbstractValue AstContext::getAbstractValue(const SharedAbstractNode& node) {
+      return this->abstraction.analyze(node);
+    }
+
+
     SharedAbstractNode AstContext::array(triton::uint32 indexSize) {
       SharedAbstractNode node = std::make_shared<ArrayNode>(indexSize, this->shared_from_this());
       if (node == nullptr)
@@ -156,6 +162,22 @@ namespace triton {
           return expr1;
       }
 
+      if (this->modes->isModeEnabled(triton::modes::ABSTRACT_INTERPRETATION)) {
+        /* Optimization: A & C = A if the bits cleared by C are known to be zero in A */
+        if (expr1->isSymbolized() && !expr2->isSymbolized()) {
+          auto value = this->getAbstractValue(expr1);
+          if (value.isTracked() && (~static_cast<triton::uint64>(expr2->evaluate()) & ~value.zeros & value.getMask()) == 0)
+            return expr1;
+        }
+
+        /* Optimization: C & A = A if the bits cleared by C are known to be zero in A */
+        if (!expr1->isSymbolized() && expr2->isSymbolized()) {
+          auto value = this->getAbstractValue(expr2);
+          if (value.isTracked() && (~static_cast<triton::uint64>(expr1->evaluate()) & ~value.zeros & value.getMask()) == 0)
+            return expr2;
+        }
+      }
+
       SharedAbstractNode node = std::make_shared<BvandNode>(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvand(): Not enough memory.");
@@ -608,8 +630,6 @@ namespace triton {
       }
 
       SharedAbstractNode node = std::make_shared<BvsubNode>(expr1, expr2);
-      std::string nodeStr = triton::utils::toString(node);
-      //std::cout << "AstContext::bvsub: " << nodeStr << std::endl;
 
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::bvsub(): Not enough memory.");
@@ -640,8 +660,6 @@ namespace triton {
       }
 
       SharedAbstractNode node = std::make_shared<FpsubNode>(expr1, expr2);
-      std::string nodeStr = triton::utils::toString(node);
-      //std::cout << "AstContext::fpsub: " << nodeStr << std::endl;
 
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::fpsub(): Not enough memory.");
@@ -898,8 +916,6 @@ namespace triton {
       /* Optimization: If we extract the full size of expr, just return expr */
 
       SharedAbstractNode node = std::make_shared<FpisZeroNode>(expr);
-      std::string nodeStr = triton::utils::toString(node);
-      //std::cout << "AstContext::fpisZero: " << nodeStr << std::endl;
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::fpisZero(): Not enough memory.");
       node->init();
@@ -911,8 +927,6 @@ namespace triton {
       /* Optimization: If we extract the full size of expr, just return expr */
 
       SharedAbstractNode node = std::make_shared<FpisPositiveNode>(expr);
-      std::string nodeStr = triton::utils::toString(node);
-      //std::cout << "AstContext::fpisPositive: " << nodeStr << std::endl;
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::fpisPositive(): Not enough memory.");
       node->init();
@@ -935,8 +949,6 @@ namespace triton {
 
     SharedAbstractNode AstContext::integer(const triton::uint512& value) {
       SharedAbstractNode node = std::make_shared<IntegerNode>(value, this->shared_from_this());
-      std::string nodeStr = triton::utils::toString(node);
-      //std::cout << "AstContext::integer(): " << nodeStr << std::endl;
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::integer(): Not enough memory.");
       node->init();
@@ -954,8 +966,6 @@ namespace triton {
       }
 
       SharedAbstractNode node = std::make_shared<IteNode>(ifExpr, thenExpr, elseExpr);
-      std::string nodeStr = triton::utils::toString(node);
-      //std::cout << "AstContext::ite(): " << nodeStr << std::endl;
       if (node == nullptr)
         throw triton::exceptions::Ast("AstContext::ite(): Not enough memory.");
       node->init();
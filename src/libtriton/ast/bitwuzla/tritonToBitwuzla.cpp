@@ -5,6 +5,9 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <stack>
+#include <tuple>
 #include <vector>
 
 #include <triton/coreUtils.hpp>
@@ -21,12 +24,15 @@ namespace triton {
 
     TritonToBitwuzla::TritonToBitwuzla(bool eval)
       : isEval(eval) {
+      this->sweepThreshold = 0x10000;
+      this->translatedCount = 0;
     }
 
 
     TritonToBitwuzla::~TritonToBitwuzla() {
       this->translatedNodes.clear();
       this->variables.clear();
+      this->variableTerms.clear();
       this->symbols.clear();
     }
 
@@ -36,19 +42,112 @@ namespace triton {
     }
 
 
+    std::unordered_map<BitwuzlaTerm, triton::engines::symbolic::SharedSymbolicVariable> TritonToBitwuzla::getVariables(const SharedAbstractNode& node) const {
+      std::unordered_map<BitwuzlaTerm, triton::engines::symbolic::SharedSymbolicVariable> ret;
+
+      for (auto&& n : triton::ast::search(node, VARIABLE_NODE)) {
+        const auto& symVar = reinterpret_cast<VariableNode*>(n.get())->getSymbolicVariable();
+        auto it = this->variableTerms.find(symVar->getId());
+        if (it != this->variableTerms.end())
+          ret[it->second] = symVar;
+      }
+
+      return ret;
+    }
+
+
     const std::map<size_t, BitwuzlaSort>& TritonToBitwuzla::getBitvectorSorts(void) const {
       return this->bvSorts;
     }
 
 
+    triton::usize TritonToBitwuzla::getTranslatedCount(void) const {
+      return this->translatedCount;
+    }
+
+
+    triton::usize TritonToBitwuzla::size(void) const {
+      return this->translatedNodes.size();
+    }
+
+
+    bool TritonToBitwuzla::isTranslated(const SharedAbstractNode& node) const {
+      auto it = this->translatedNodes.find(node.get());
+
+      /* A dead node may have been reallocated at the same address, and a live one may have been changed in place since */
+      return it != this->translatedNodes.end() && !it->second.node.expired() && it->second.revision == node->getRevision();
+    }
+
+
+    BitwuzlaTerm TritonToBitwuzla::getTranslation(const SharedAbstractNode& node) const {
+      return this->translatedNodes.at(node.get()).term;
+    }
+
+
+    void TritonToBitwuzla::sweep(void) {
+      if (this->translatedNodes.size() < this->sweepThreshold)
+        return;
+
+      for (auto it = this->translatedNodes.begin(); it != this->translatedNodes.end();) {
+        if (it->second.node.expired())
+          it = this->translatedNodes.erase(it);
+        else
+          it++;
+      }
+
+      /* Sweeping again once the live translations have doubled keeps it amortized */
+      this->sweepThreshold = std::max<triton::usize>(0x10000, this->translatedNodes.size() * 2);
+    }
+
+
     BitwuzlaTerm TritonToBitwuzla::convert(const SharedAbstractNode& node, Bitwuzla* bzla) {
-      auto nodes = childrenExtraction(node, true /* unroll*/, true /* revert */);
+      std::stack<std::pair<SharedAbstractNode, bool>> worklist;
 
-      for (auto&& n : nodes) {
-        this->translatedNodes[n] = translate(n, bzla);
+      if (node == nullptr)
+        throw triton::exceptions::AstLifting("TritonToBitwuzla::convert(): node cannot be null.");
+
+      this->translatedCount = 0;
+
+      /*
+       *  Sub-DAGs translated by a previous conversion are neither visited nor
+       *  translated again, so that a conversion only costs its new nodes.
+       */
+      worklist.push({node, false});
+      while (!worklist.empty()) {
+        SharedAbstractNode n;
+        bool postOrder;
+        std::tie(n, postOrder) = worklist.top();
+        worklist.pop();
+
+        if (this->isTranslated(n))
+          continue;
+
+        /* All children have been translated */
+        if (postOrder) {
+          this->translatedNodes[n.get()] = {n, this->translate(n, bzla), n->getRevision()};
+          this->translatedCount++;
+          continue;
+        }
+
+        worklist.push({n, true});
+
+        for (const auto& child : n->getChildren()) {
+          if (!this->isTranslated(child))
+            worklist.push({child, false});
+        }
+
+        /* References are unrolled */
+        if (n->getType() == REFERENCE_NODE) {
+          const auto& ref = reinterpret_cast<ReferenceNode*>(n.get())->getSymbolicExpression()->getAst();
+          if (!this->isTranslated(ref))
+            worklist.push({ref, false});
+        }
       }
 
-      return this->translatedNodes.at(node);
+      BitwuzlaTerm term = this->getTranslation(node);
+      this->sweep();
+
+      return term;
     }
 
 
@@ -58,7 +157,7 @@ namespace triton {
 
       std::vector<BitwuzlaTerm> children;
       for (auto&& n : node->getChildren()) {
-        children.emplace_back(this->translatedNodes.at(n));
+        children.emplace_back(this->getTranslation(n));
       }
 
       BitwuzlaTermManager* tm = bitwuzla_get_term_mgr(bzla);
@@ -248,7 +347,7 @@ namespace triton {
 
         case REFERENCE_NODE: {
           auto ref = reinterpret_cast<ReferenceNode*>(node.get())->getSymbolicExpression()->getAst();
-          return this->translatedNodes.at(ref);
+          return this->getTranslation(ref);
         }
 
         case SELECT_NODE:
@@ -264,7 +363,7 @@ namespace triton {
           if (it == symbols.end())
             throw triton::exceptions::AstLifting("TritonToBitwuzla::translate(): [STRING_NODE] Symbols not found.");
 
-          return this->translatedNodes.at(it->second);
+          return this->getTranslation(it->second);
         }
 
         case SX_NODE: {
@@ -290,19 +389,15 @@ namespace triton {
             return bitwuzla_mk_bv_value(tm, sort->second, triton::utils::toString(value).c_str(), 10);
           }
 
-          auto n = (BitwuzlaTerm) 0;
-          /* If we already translated the node, return that. */
-          for (auto it = variables.begin(); it != variables.end(); ++it) {
-            if (it->second == symVar) {
-              n = it->first;
-              break;
-            }
+          /* If we already translated the variable, return that. */
+          auto it = this->variableTerms.find(symVar->getId());
+          if (it != this->variableTerms.end()) {
+            return it->second;
           }
 
-          if (n == 0) {
-            n = bitwuzla_mk_const(tm, sort->second, symVar->getName().c_str());
-            variables[n] = symVar;
-          }
+          auto n = bitwuzla_mk_const(tm, sort->second, symVar->getName().c_str());
+          this->variableTerms[symVar->getId()] = n;
+          this->variables[n] = symVar;
 
           return n;
         }
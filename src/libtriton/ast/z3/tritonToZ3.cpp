@@ -5,6 +5,9 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <stack>
+#include <tuple>
 #include <vector>
 
 #include <triton/coreUtils.hpp>
@@ -22,11 +25,14 @@ namespace triton {
     TritonToZ3::TritonToZ3(bool eval)
       : context() {
       this->isEval = eval;
+      this->sweepThreshold = 0x10000;
+      this->translatedCount = 0;
     }
 
 
     TritonToZ3::~TritonToZ3() {
       /* See #828: Release ownership before calling container destructor */
+      this->translatedNodes.clear();
       this->symbols.clear();
       this->variables.clear();
     }
@@ -37,27 +43,115 @@ namespace triton {
     }
 
 
+    bool TritonToZ3::isTranslated(const triton::ast::SharedAbstractNode& node) const {
+      auto it = this->translatedNodes.find(node.get());
+
+      /*
+       *  A dead node may have been reallocated at the same address, and a live one
+       *  is translated again if one of its nodes has been replaced since (e.g. by
+       *  setChild() or a symbolized expression).
+       */
+      return it != this->translatedNodes.end() && !it->second.node.expired() && it->second.revision == node->getRevision();
+    }
+
+
+    const z3::expr& TritonToZ3::getTranslation(const triton::ast::SharedAbstractNode& node) const {
+      return this->translatedNodes.at(node.get()).expr;
+    }
+
+
+    void TritonToZ3::sweep(void) {
+      if (this->translatedNodes.size() < this->sweepThreshold)
+        return;
+
+      for (auto it = this->translatedNodes.begin(); it != this->translatedNodes.end();) {
+        if (it->second.node.expired())
+          it = this->translatedNodes.erase(it);
+        else
+          it++;
+      }
+
+      /* Sweeping again once the live translations have doubled keeps it amortized */
+      this->sweepThreshold = std::max<triton::usize>(0x10000, this->translatedNodes.size() * 2);
+    }
+
+
     z3::expr TritonToZ3::convert(const triton::ast::SharedAbstractNode& node) {
-      std::unordered_map<triton::ast::SharedAbstractNode, z3::expr> results;
+      std::stack<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
 
-      auto nodes = triton::ast::childrenExtraction(node, true /* unroll*/, true /* revert */);
+      if (node == nullptr)
+        throw triton::exceptions::AstLifting("TritonToZ3::convert(): node cannot be null.");
+
+      this->translatedCount = 0;
+
+      /*
+       *  Sub-DAGs translated by a previous conversion are neither visited nor
+       *  translated again, so that a conversion only costs its new nodes.
+       */
+      worklist.push({node, false});
+      while (!worklist.empty()) {
+        triton::ast::SharedAbstractNode n;
+        bool postOrder;
+        std::tie(n, postOrder) = worklist.top();
+        worklist.pop();
+
+        if (this->isTranslated(n))
+          continue;
+
+        /* All children have been translated */
+        if (postOrder) {
+          z3::expr expr = this->do_convert(n);
+          this->translatedNodes.erase(n.get());
+          this->translatedNodes.emplace(n.get(), Translation(n, expr));
+          this->translatedCount++;
+          continue;
+        }
 
-      for (auto&& n : nodes) {
-        results.insert(std::make_pair(n, this->do_convert(n, &results)));
+        worklist.push({n, true});
+
+        for (const auto& child : n->getChildren()) {
+          if (!this->isTranslated(child))
+            worklist.push({child, false});
+        }
+
+        /* References are unrolled */
+        if (n->getType() == triton::ast::REFERENCE_NODE) {
+          const auto& ref = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst();
+          if (!this->isTranslated(ref))
+            worklist.push({ref, false});
+        }
       }
 
-      return results.at(node);
+      z3::expr expr = this->getTranslation(node);
+      this->sweep();
+
+      return expr;
+    }
+
+
+    z3::context& TritonToZ3::getContext(void) {
+      return this->context;
+    }
+
+
+    triton::usize TritonToZ3::getTranslatedCount(void) const {
+      return this->translatedCount;
+    }
+
+
+    triton::usize TritonToZ3::size(void) const {
+      return this->translatedNodes.size();
     }
 
 
-    z3::expr TritonToZ3::do_convert(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>* results) {
+    z3::expr TritonToZ3::do_convert(const triton::ast::SharedAbstractNode& node) {
       if (node == nullptr)
         throw triton::exceptions::AstLifting("TritonToZ3::do_convert(): node cannot be null.");
 
       /* Prepare z3's children */
       std::vector<z3::expr> children;
       for (auto&& n : node->getChildren()) {
-        children.emplace_back(results->at(n));
+        children.emplace_back(this->getTranslation(n));
       }
 
       switch (node->getType()) {
@@ -290,7 +384,7 @@ namespace triton {
         }
 
         case REFERENCE_NODE:
-          return results->at(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst());
+          return this->getTranslation(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst());
 
         case STRING_NODE: {
           std::string value = reinterpret_cast<triton::ast::StringNode*>(node.get())->getString();
@@ -298,7 +392,7 @@ namespace triton {
           if (this->symbols.find(value) == this->symbols.end())
             throw triton::exceptions::AstLifting("TritonToZ3::do_convert(): [STRING_NODE] Symbols not found.");
 
-          return results->at(this->symbols[value]);
+          return this->getTranslation(this->symbols[value]);
         }
 
         case SELECT_NODE:
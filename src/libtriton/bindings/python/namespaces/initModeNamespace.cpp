@@ -31,30 +31,73 @@ The MODE namespace contains all kinds of modes.
 \section MODE_py_api Python API - Items of the MODE namespace
 <hr>
 
+- **MODE.ABSTRACT_INTERPRETATION**<br>
+Computes the known bits and the unsigned and signed intervals of the AST nodes. Masks keeping all the bits that may be set are
+dropped and queries known to be true or false are decided without calling the solver. Such queries are mostly the branches over
+concrete values, like loop conditions, recorded in the path constraints.
+
 - **MODE.ALIGNED_MEMORY**<br>
 Keeps a map of aligned memory to reduce the symbolic memory explosion of `LOAD` and `STORE` accesses.
 
 - **MODE.AST_OPTIMIZATIONS**<br>
 Reduces the depth of the trees using classical arithmetic optimisations.
 
+- **MODE.CONCRETIZE_ON_BUDGET**<br>
+Concretizes a new symbolic expression when its AST exceeds one of the thresholds given to `setConcretizationBudget()`.
+
 - **MODE.CONCRETIZE_UNDEFINED_REGISTERS**<br>
 Concretizes every register tagged as undefined (see #750).
 
 - **MODE.CONSTANT_FOLDING**<br>
 Performs a constant folding optimization of sub ASTs which do not contain symbolic variables.
 
+- **MODE.CONSTRAINT_INDEPENDENCE**<br>
+Splits the conjunction given to `getModel()` and `isSat()` into clusters of constraints which share symbolic variables. Clusters
+already satisfied by the current concrete values are not sent to the solver, and their variables are modeled by their concrete values.
+
+- **MODE.DEAD_FLAG_ELIMINATION**<br>
+When a \ref py_BasicBlock_page is processed, defers the AST of each flag until it is read or until the end of the block, so the flags which are overwritten later in the block without being read are never built. Live flags are added to the instruction which wrote them. This mode has no effect with `MODE.LAZY_FLAGS`, which already defers every flag, nor with `MODE.ONLY_ON_SYMBOLIZED` and `MODE.ONLY_ON_TAINTED`.
+
+- **MODE.DECODE_CACHE**<br>
+Restores an instruction processed again at the same address with the same bytes from a cache instead of decoding it again. Use `getDecodeCacheStats()` to get the hit rate.
+
+- **MODE.LAZY_FLAGS**<br>
+Records how a flag is computed and only builds its AST when the flag is read, like QEMU condition codes. Reading a flag through the API (e.g. `getSymbolicRegister()`, `getRegisterAst()` or `getConcreteRegisterValue()`) builds it, so the returned ASTs are unchanged. Flags which are overwritten before being read are never built, and instructions do not list them in their expressions.
+
 - **MODE.MEMORY_ARRAY**<br>
 Enables symbolic pointers reasoning (QF_ABV logic). When this mode is not enabled, which is the case by default, the QF_BV memory model is applied.
 
+- **MODE.MODEL_REUSE**<br>
+Before `getModel()` and `isSat()` send a query to the solver, evaluates it under the current concrete values and under the last models
+returned by the solver, and returns the first assignment which satisfies it. Variables missing from a recent model keep their concrete
+value. It pays off when a branch and its negation are both queried, as one of them holds for the concrete values. A generational
+search which only asks for the branches not taken seldom skips the solver. Use `getModelCacheStats()` to get the fraction of queries
+which skip the solver.
+
+- **MODE.NATIVE_INTERPRETER**<br>
+On x86-64, executes common instructions (mov, lea, arithmetic, logic, shifts, stack and branches) directly on the concrete state with native integers when none of the values they read is symbolized or tainted. Written registers and memory cells are concretized and untainted. Like with `MODE.ONLY_ON_SYMBOLIZED`, such instructions have no symbolic expressions and no semantics. Other instructions are processed as usual.
+
 - **MODE.ONLY_ON_SYMBOLIZED**<br>
-Removes symbolic expressions that does not contain symbolic variable.
+Removes symbolic expressions that does not contain symbolic variable. On x86-64, the instructions supported by `MODE.NATIVE_INTERPRETER` are executed natively when none of the values they read is symbolized or tainted, without building their semantics.
 
 - **MODE.ONLY_ON_TAINTED**<br>
 Removes symbolic expressions that are not tainted.
 
+- **MODE.OPTIMISTIC_SOLVING**<br>
+When the query of `getModel()` or of a list of queries given to `getModels()` is a conjunction which is unsatisfiable or times out,
+solves its last conjunct alone, e.g. the negated branch of a path predicate, and returns its model with the `SAT` status.
+Other variables keep the current input. Such models are flagged by `SolverModel.isOptimistic()`, as in QSYM.
+
 - **MODE.PC_TRACKING_SYMBOLIC**<br>
 Tracks path constraints only if they are symbolized. This mode is enabled by default.
 
+- **MODE.SOLVER_CACHE**<br>
+Restores the result of `getModel()` and `isSat()` from a cache when an identical query, up to the renaming of its symbolic variables,
+has already been solved. Use `getSolverCacheStats()` to get the hit rate, and `saveSolverCache()` / `loadSolverCache()` to keep it across runs.
+
+- **MODE.STORE_LOAD_FORWARDING**<br>
+When every byte of a `LOAD` comes from the same previous `STORE`, returns a single `extract` of the stored expression instead of a `concat` of byte references.
+
 - **MODE.SYMBOLIZE_INDEX_ROTATION**<br>
 Symbolizes the index of rotation for `bvror` and `bvrol` nodes. This mode increases the complexity of solving.
 
@@ -76,14 +119,25 @@ namespace triton {
     namespace python {
 
       void initModeNamespace(PyObject* modeDict) {
+        xPyDict_SetItemString(modeDict, "ABSTRACT_INTERPRETATION",        PyLong_FromUint32(triton::modes::ABSTRACT_INTERPRETATION));
         xPyDict_SetItemString(modeDict, "ALIGNED_MEMORY",                 PyLong_FromUint32(triton::modes::ALIGNED_MEMORY));
         xPyDict_SetItemString(modeDict, "AST_OPTIMIZATIONS",              PyLong_FromUint32(triton::modes::AST_OPTIMIZATIONS));
+        xPyDict_SetItemString(modeDict, "CONCRETIZE_ON_BUDGET",           PyLong_FromUint32(triton::modes::CONCRETIZE_ON_BUDGET));
         xPyDict_SetItemString(modeDict, "CONCRETIZE_UNDEFINED_REGISTERS", PyLong_FromUint32(triton::modes::CONCRETIZE_UNDEFINED_REGISTERS));
         xPyDict_SetItemString(modeDict, "CONSTANT_FOLDING",               PyLong_FromUint32(triton::modes::CONSTANT_FOLDING));
+        xPyDict_SetItemString(modeDict, "CONSTRAINT_INDEPENDENCE",        PyLong_FromUint32(triton::modes::CONSTRAINT_INDEPENDENCE));
+        xPyDict_SetItemString(modeDict, "DEAD_FLAG_ELIMINATION",          PyLong_FromUint32(triton::modes::DEAD_FLAG_ELIMINATION));
+        xPyDict_SetItemString(modeDict, "DECODE_CACHE",                   PyLong_FromUint32(triton::modes::DECODE_CACHE));
+        xPyDict_SetItemString(modeDict, "LAZY_FLAGS",                     PyLong_FromUint32(triton::modes::LAZY_FLAGS));
         xPyDict_SetItemString(modeDict, "MEMORY_ARRAY",                   PyLong_FromUint32(triton::modes::MEMORY_ARRAY));
+        xPyDict_SetItemString(modeDict, "MODEL_REUSE",                    PyLong_FromUint32(triton::modes::MODEL_REUSE));
+        xPyDict_SetItemString(modeDict, "NATIVE_INTERPRETER",             PyLong_FromUint32(triton::modes::NATIVE_INTERPRETER));
         xPyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",             PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
         xPyDict_SetItemString(modeDict, "ONLY_ON_TAINTED",                PyLong_FromUint32(triton::modes::ONLY_ON_TAINTED));
+        xPyDict_SetItemString(modeDict, "OPTIMISTIC_SOLVING",             PyLong_FromUint32(triton::modes::OPTIMISTIC_SOLVING));
         xPyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",           PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
+        xPyDict_SetItemString(modeDict, "SOLVER_CACHE",                   PyLong_FromUint32(triton::modes::SOLVER_CACHE));
+        xPyDict_SetItemString(modeDict, "STORE_LOAD_FORWARDING",          PyLong_FromUint32(triton::modes::STORE_LOAD_FORWARDING));
         xPyDict_SetItemString(modeDict, "SYMBOLIZE_INDEX_ROTATION",       PyLong_FromUint32(triton::modes::SYMBOLIZE_INDEX_ROTATION));
         xPyDict_SetItemString(modeDict, "SYMBOLIZE_LOAD",                 PyLong_FromUint32(triton::modes::SYMBOLIZE_LOAD));
         xPyDict_SetItemString(modeDict, "SYMBOLIZE_STORE",                PyLong_FromUint32(triton::modes::SYMBOLIZE_STORE));
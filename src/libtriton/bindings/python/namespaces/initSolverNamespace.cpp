@@ -27,6 +27,9 @@ The SOLVER namespace contains all kinds of solver status.
 
 - **SOLVER.Z3**
 - **SOLVER.BITWUZLA**
+- **SOLVER.PORTFOLIO**: Races the available solvers and returns the first answer.
+- **SOLVER.LOCAL_SEARCH**: Mutates the variables until the query holds. Answers SAT with a model or UNKNOWN.
+- **SOLVER.PROCESS_POOL**: Solves the queries with z3 or Bitwuzla in worker processes, which are restarted when they crash or exceed their limits. Not available on Windows.
 
 */
 
@@ -45,6 +48,13 @@ namespace triton {
         #if defined(TRITON_BITWUZLA_INTERFACE)
         xPyDict_SetItemString(solverDict, "BITWUZLA", PyLong_FromUint32(triton::engines::solver::SOLVER_BITWUZLA));
         #endif
+        #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+        xPyDict_SetItemString(solverDict, "PORTFOLIO", PyLong_FromUint32(triton::engines::solver::SOLVER_PORTFOLIO));
+        #endif
+        xPyDict_SetItemString(solverDict, "LOCAL_SEARCH", PyLong_FromUint32(triton::engines::solver::SOLVER_LOCAL_SEARCH));
+        #if !defined(_WIN32) && (defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE))
+        xPyDict_SetItemString(solverDict, "PROCESS_POOL", PyLong_FromUint32(triton::engines::solver::SOLVER_PROCESS_POOL));
+        #endif
       }
 
     }; /* python namespace */
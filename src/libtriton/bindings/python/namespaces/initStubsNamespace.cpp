@@ -28,24 +28,36 @@ The STUBS namespace contains all stubs.
 \section STUBS_py_api Python API - Items of the STUBS namespace
 <hr>
 
+- <b>STUBS.AARCH64.LIBC.abi</b><br>
+The calling convention of the AArch64 libc stub, as a \ref py_SYMBOLIC_page abi to register its function summaries.
+
 - <b>STUBS.AARCH64.LIBC.code</b><br>
 The libc stub on AArch64 architecture with the ARM64 ABI calling convention.
 
 - <b>STUBS.AARCH64.LIBC.symbols</b><br>
 The symbols map of the AArch64 libc stub.
 
+- <b>STUBS.I386.SYSTEMV.LIBC.abi</b><br>
+The calling convention of the i386-systemv libc stub.
+
 - <b>STUBS.I386.SYSTEMV.LIBC.code</b><br>
 The libc stub on i386 architecture with the SystemV ABI calling convention.
 
 - <b>STUBS.I386.SYSTEMV.LIBC.symbols</b><br>
 The symbols map of the i386-systemv libc stub.
 
+- <b>STUBS.X8664.MS.LIBC.abi</b><br>
+The calling convention of the x8664-ms libc stub.
+
 - <b>STUBS.X8664.MS.LIBC.code</b><br>
 The libc stub on x8664 architecture with the MS ABI calling convention.
 
 - <b>STUBS.X8664.MS.LIBC.symbols</b><br>
 The symbols map of the x8664-ms libc stub.
 
+- <b>STUBS.X8664.SYSTEMV.LIBC.abi</b><br>
+The calling convention of the x8664-systemv libc stub.
+
 - <b>STUBS.X8664.SYSTEMV.LIBC.code</b><br>
 The libc stub on x8664 architecture with the SystemV ABI calling convention.
 
@@ -82,8 +94,9 @@ namespace triton {
       }
 
 
-      static PyObject* initLibc(const std::vector<triton::uint8>& code, const std::map<std::string, triton::uint64>& symbols) {
+      static PyObject* initLibc(const std::vector<triton::uint8>& code, const std::map<std::string, triton::uint64>& symbols, triton::engines::symbolic::abi_e abi) {
         PyObject* libcDict = xPyDict_New();
+        xPyDict_SetItemString(libcDict, "abi", PyLong_FromUint32(abi));
         xPyDict_SetItemString(libcDict, "code", initCode(code));
         xPyDict_SetItemString(libcDict, "symbols", initSymbols(symbols));
         PyObject* libcDictClass = xPyClass_New(nullptr, libcDict, xPyString_FromString("LIBC"));
@@ -92,17 +105,17 @@ namespace triton {
       }
 
 
-      static PyObject* initSystemV(const std::vector<triton::uint8>& code, const std::map<std::string, triton::uint64>& symbols) {
+      static PyObject* initSystemV(const std::vector<triton::uint8>& code, const std::map<std::string, triton::uint64>& symbols, triton::engines::symbolic::abi_e abi) {
         PyObject* systemvDict = xPyDict_New();
-        xPyDict_SetItemString(systemvDict, "LIBC", initLibc(code, symbols));
+        xPyDict_SetItemString(systemvDict, "LIBC", initLibc(code, symbols, abi));
         PyObject* systemvDictClass = xPyClass_New(nullptr, systemvDict, xPyString_FromString("SYSTEMV"));
         return systemvDictClass;
       }
 
 
-      static PyObject* initMS(const std::vector<triton::uint8>& code, const std::map<std::string, triton::uint64>& symbols) {
+      static PyObject* initMS(const std::vector<triton::uint8>& code, const std::map<std::string, triton::uint64>& symbols, triton::engines::symbolic::abi_e abi) {
         PyObject* systemvDict = xPyDict_New();
-        xPyDict_SetItemString(systemvDict, "LIBC", initLibc(code, symbols));
+        xPyDict_SetItemString(systemvDict, "LIBC", initLibc(code, symbols, abi));
         PyObject* systemvDictClass = xPyClass_New(nullptr, systemvDict, xPyString_FromString("MS"));
         return systemvDictClass;
       }
@@ -110,8 +123,8 @@ namespace triton {
 
       static PyObject* initX8664(void) {
         PyObject* dict = xPyDict_New();
-        xPyDict_SetItemString(dict, "SYSTEMV", initSystemV(triton::stubs::x8664::systemv::libc::code, triton::stubs::x8664::systemv::libc::symbols));
-        xPyDict_SetItemString(dict, "MS", initMS(triton::stubs::x8664::ms::libc::code, triton::stubs::x8664::ms::libc::symbols));
+        xPyDict_SetItemString(dict, "SYSTEMV", initSystemV(triton::stubs::x8664::systemv::libc::code, triton::stubs::x8664::systemv::libc::symbols, triton::stubs::x8664::systemv::libc::abi));
+        xPyDict_SetItemString(dict, "MS", initMS(triton::stubs::x8664::ms::libc::code, triton::stubs::x8664::ms::libc::symbols, triton::stubs::x8664::ms::libc::abi));
         PyObject* dictClass = xPyClass_New(nullptr, dict, xPyString_FromString("X8664"));
         return dictClass;
       }
@@ -119,7 +132,7 @@ namespace triton {
 
       static PyObject* initAArch64(void) {
         PyObject* dict = xPyDict_New();
-        xPyDict_SetItemString(dict, "LIBC", initLibc(triton::stubs::aarch64::libc::code, triton::stubs::aarch64::libc::symbols));
+        xPyDict_SetItemString(dict, "LIBC", initLibc(triton::stubs::aarch64::libc::code, triton::stubs::aarch64::libc::symbols, triton::stubs::aarch64::libc::abi));
         PyObject* dictClass = xPyClass_New(nullptr, dict, xPyString_FromString("AARCH64"));
         return dictClass;
       }
@@ -127,7 +140,7 @@ namespace triton {
 
       static PyObject* initI386(void) {
         PyObject* dict = xPyDict_New();
-        xPyDict_SetItemString(dict, "SYSTEMV", initSystemV(triton::stubs::i386::systemv::libc::code, triton::stubs::i386::systemv::libc::symbols));
+        xPyDict_SetItemString(dict, "SYSTEMV", initSystemV(triton::stubs::i386::systemv::libc::code, triton::stubs::i386::systemv::libc::symbols, triton::stubs::i386::systemv::libc::abi));
         PyObject* dictClass = xPyClass_New(nullptr, dict, xPyString_FromString("I386"));
         return dictClass;
       }
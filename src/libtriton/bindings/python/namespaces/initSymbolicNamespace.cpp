@@ -20,15 +20,19 @@
 \section SYMBOLIC_py_description Description
 <hr>
 
-The SYMBOLIC namespace contains all types of symbolic expressions and variables.
+The SYMBOLIC namespace contains all types of symbolic expressions and variables, and the calling conventions of function summaries.
 
 \section SYMBOLIC_py_api Python API - Items of the SYMBOLIC namespace
 <hr>
 
+- **SYMBOLIC.AAPCS64_ABI**
+- **SYMBOLIC.DEFAULT_ABI**
 - **SYMBOLIC.MEMORY_EXPRESSION**
 - **SYMBOLIC.MEMORY_VARIABLE**
+- **SYMBOLIC.MS_ABI**
 - **SYMBOLIC.REGISTER_EXPRESSION**
 - **SYMBOLIC.REGISTER_VARIABLE**
+- **SYMBOLIC.SYSTEMV_ABI**
 - **SYMBOLIC.UNDEFINED_VARIABLE**
 - **SYMBOLIC.VOLATILE_EXPRESSION**
 
@@ -41,10 +45,14 @@ namespace triton {
     namespace python {
 
       void initSymbolicNamespace(PyObject* symbolicDict) {
+        xPyDict_SetItemString(symbolicDict, "AAPCS64_ABI",           PyLong_FromUint32(triton::engines::symbolic::AAPCS64_ABI));
+        xPyDict_SetItemString(symbolicDict, "DEFAULT_ABI",           PyLong_FromUint32(triton::engines::symbolic::DEFAULT_ABI));
         xPyDict_SetItemString(symbolicDict, "MEMORY_EXPRESSION",     PyLong_FromUint32(triton::engines::symbolic::MEMORY_EXPRESSION));
         xPyDict_SetItemString(symbolicDict, "MEMORY_VARIABLE",       PyLong_FromUint32(triton::engines::symbolic::MEMORY_VARIABLE));
+        xPyDict_SetItemString(symbolicDict, "MS_ABI",                PyLong_FromUint32(triton::engines::symbolic::MS_ABI));
         xPyDict_SetItemString(symbolicDict, "REGISTER_EXPRESSION",   PyLong_FromUint32(triton::engines::symbolic::REGISTER_EXPRESSION));
         xPyDict_SetItemString(symbolicDict, "REGISTER_VARIABLE",     PyLong_FromUint32(triton::engines::symbolic::REGISTER_VARIABLE));
+        xPyDict_SetItemString(symbolicDict, "SYSTEMV_ABI",           PyLong_FromUint32(triton::engines::symbolic::SYSTEMV_ABI));
         xPyDict_SetItemString(symbolicDict, "UNDEFINED_VARIABLE",    PyLong_FromUint32(triton::engines::symbolic::UNDEFINED_VARIABLE));
         xPyDict_SetItemString(symbolicDict, "VOLATILE_EXPRESSION",   PyLong_FromUint32(triton::engines::symbolic::VOLATILE_EXPRESSION));
       }
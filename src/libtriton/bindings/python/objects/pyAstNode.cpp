@@ -60,6 +60,10 @@ Compares the current tree to another one.
 - <b>integer evaluate(void)</b><br>
 Evaluates the tree and returns its value.
 
+- <b>dict getAbstractValue(void)</b><br>
+Returns the known bits and the intervals of the node as a dictionary with the `zeros`, `ones`, `umin`, `umax`, `smin` and `smax` keys,
+or None if the node is wider than 64 bits.
+
 - <b>integer getBitvectorMask(void)</b><br>
 Returns the mask of the node vector according to its size.<br>
 e.g: `0xffffffff`
@@ -180,6 +184,32 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_getAbstractValue(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          auto value = PyAstNode_AsAstNode(self)->getAbstractValue();
+
+          if (!value.isTracked()) {
+            Py_INCREF(Py_None);
+            return Py_None;
+          }
+
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "zeros", PyLong_FromUint64(value.zeros));
+          xPyDict_SetItemString(ret, "ones",  PyLong_FromUint64(value.ones));
+          xPyDict_SetItemString(ret, "umin",  PyLong_FromUint64(value.umin));
+          xPyDict_SetItemString(ret, "umax",  PyLong_FromUint64(value.umax));
+          xPyDict_SetItemString(ret, "smin",  PyLong_FromLongLong(value.smin));
+          xPyDict_SetItemString(ret, "smax",  PyLong_FromLongLong(value.smax));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_getBitvectorMask(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint512(PyAstNode_AsAstNode(self)->getBitvectorMask());
@@ -839,6 +869,7 @@ namespace triton {
       PyMethodDef AstNode_callbacks[] = {
         {"equalTo",                 AstNode_equalTo,                METH_O,          ""},
         {"evaluate",                AstNode_evaluate,               METH_NOARGS,     ""},
+        {"getAbstractValue",        AstNode_getAbstractValue,       METH_NOARGS,     ""},
         {"getBitvectorMask",        AstNode_getBitvectorMask,       METH_NOARGS,     ""},
         {"getBitvectorSize",        AstNode_getBitvectorSize,       METH_NOARGS,     ""},
         {"getChildren",             AstNode_getChildren,            METH_NOARGS,     ""},
@@ -78,6 +78,9 @@ Returns the value of the model.
 - <b>\ref py_SymbolicVariable_page getVariable(void)</b><br>
 Returns the symbolic variable.
 
+- <b>bool isOptimistic(void)</b><br>
+Returns true if the model only satisfies the last conjunct of the query (see \ref py_MODE_page `OPTIMISTIC_SOLVING`).
+
 */
 
 
@@ -124,6 +127,18 @@ namespace triton {
       }
 
 
+      static PyObject* SolverModel_isOptimistic(PyObject* self, PyObject* noarg) {
+        try {
+          if (PySolverModel_AsSolverModel(self)->isOptimistic())
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       #if !defined(IS_PY3_8) || !IS_PY3_8
       static int SolverModel_print(PyObject* self, void* io, int s) {
         std::cout << PySolverModel_AsSolverModel(self);
@@ -144,10 +159,11 @@ namespace triton {
 
       //! SolverModel methods.
       PyMethodDef SolverModel_callbacks[] = {
-        {"getId",       SolverModel_getId,        METH_NOARGS,    ""},
-        {"getValue",    SolverModel_getValue,     METH_NOARGS,    ""},
-        {"getVariable", SolverModel_getVariable,  METH_NOARGS,    ""},
-        {nullptr,       nullptr,                  0,              nullptr}
+        {"getId",         SolverModel_getId,          METH_NOARGS,    ""},
+        {"getValue",      SolverModel_getValue,       METH_NOARGS,    ""},
+        {"getVariable",   SolverModel_getVariable,    METH_NOARGS,    ""},
+        {"isOptimistic",  SolverModel_isOptimistic,   METH_NOARGS,    ""},
+        {nullptr,         nullptr,                    0,              nullptr}
       };
 
 
@@ -42,6 +42,18 @@ libTriton offers Python bindings on top of its C++ API which allow you to build
 - <b>void addCallback(\ref py_CALLBACK_page kind, function cb)</b><br>
 Adds a callback at specific internal points. Your callback will be called each time the point is reached.
 
+- <b>integer addFunctionSummaries(integer base, dict symbols, \ref py_SYMBOLIC_page abi=SYMBOLIC.DEFAULT_ABI)</b><br>
+Applies the native symbolic summaries of the supported functions of a stubs symbols map (e.g. `STUBS.X8664.SYSTEMV.LIBC.symbols`) loaded at `base`,
+instead of emulating their code. Returns the number of summarized functions. Supported functions are `memcmp`, `memcpy`, `memmove`, `mempcpy`,
+`memset`, `strcmp`, `strlen`, `strncmp` and `strnlen`. `abi` is the calling convention of the stubs (e.g. `STUBS.X8664.MS.LIBC.abi`), the default
+one of the architecture being used otherwise. Raises an exception if the architecture does not support it.
+
+- <b>void addFunctionSummary(integer addr, string name, \ref py_SYMBOLIC_page abi=SYMBOLIC.DEFAULT_ABI)</b><br>
+Applies the native symbolic summary of the function `name` when an instruction is processed at `addr`, its arguments following the `abi` calling convention.
+
+- <b>void assertConstraint(\ref py_AstNode_page node)</b><br>
+Asserts a constraint in the current scope of the incremental solver session. Its translation to the solver is kept until the session is reset.
+
 - <b>void assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
 The symbolic expression (`symExpr`) must be aligned to the memory access.
@@ -53,9 +65,18 @@ The symbolic expression (`symExpr`) must be aligned to the targeted size registe
 - <b>\ref py_EXCEPTION_page buildSemantics(\ref py_Instruction_page inst)</b><br>
 Builds the instruction semantics. Returns `EXCEPTION.NO_FAULT` if the instruction is supported.
 
+- <b>dict checkWithAssumption(\ref py_AstNode_page node=None, bool status=False, integer timeout=0)</b><br>
+Checks the constraints asserted in the incremental solver session together with `node`, which only holds for this check. Returns a model as a
+dictionary of {integer symVarId : \ref py_SolverModel_page model} if it is satisfiable. If status is True, returns a tuple of (dict model,
+\ref py_SOLVER_STATE_page status, integer solvingTime). Flipping the branch k of a path is done by checking the negation of the constraint k
+and then asserting the constraint k, so that the prefix is neither translated nor asserted again.
+
 - <b>void clearCallbacks(void)</b><br>
 Clears recorded callbacks.
 
+- <b>void clearDecodeCache(void)</b><br>
+Removes all instructions of the decode cache used by the \ref py_MODE_page `DECODE_CACHE` mode and resets its counters.
+
 - <b>void clearModes(void)</b><br>
 Clears recorded modes.
 
@@ -65,9 +86,27 @@ Clears concrete values assigned to the memory cells.
 - <b>void clearConcreteMemoryValue(integer addr, integer size)</b><br>
 Clears concrete values assigned to the memory cells from `addr` to `addr + size`.
 
+- <b>void clearConcretizationStats(void)</b><br>
+Resets the counters of the \ref py_MODE_page `CONCRETIZE_ON_BUDGET` mode.
+
+- <b>void clearExecutionTree(void)</b><br>
+Removes all the branches of the execution tree.
+
+- <b>void clearFunctionSummaries(void)</b><br>
+Removes all function summaries.
+
+- <b>void clearModelCache(void)</b><br>
+Removes all the recent models kept by the \ref py_MODE_page `MODEL_REUSE` mode and resets its counters.
+
 - <b>void clearPathConstraints(void)</b><br>
 Clears the current path predicate.
 
+- <b>void clearSolverCache(void)</b><br>
+Removes all the queries of the solver cache and resets its counters.
+
+- <b>void clearSolverStats(void)</b><br>
+Resets the time spent in each phase by the queries sent to the solver.
+
 - <b>void concretizeAllMemory(void)</b><br>
 Concretizes all symbolic memory references.
 
@@ -134,6 +173,23 @@ Returns the concrete value of a register.
 - <b>integer getConcreteVariableValue(\ref py_SymbolicVariable_page symVar)</b><br>
 Returns the concrete value of a symbolic variable.
 
+- <b>dict getConcretizationStats(void)</b><br>
+Returns how often each threshold of the \ref py_MODE_page `CONCRETIZE_ON_BUDGET` mode fired, as a dictionary with the `level`, `nodes`, `variables` and `pinned` keys.
+
+- <b>dict getDecodeCacheStats(void)</b><br>
+Returns the counters of the decode cache used by the \ref py_MODE_page `DECODE_CACHE` mode, as a dictionary with the `hits`, `misses` and `flushes` keys.
+
+- <b>dict getExecutionTreeStats(void)</b><br>
+Returns the counters of the execution tree, as a dictionary with the `nodes`, `unexplored`, `pending`, `explored`, `infeasible`, `timeout` and `diverged` keys.
+`nodes` counts the branch instructions, `diverged` the runs which did not take the satisfiable branch whose model they followed, the other keys count
+the branches in each state.
+
+- <b>integer getFunctionSummaryBound(void)</b><br>
+Returns the maximum number of bytes covered by the ITE chains of function summaries.
+
+- <b>dict getFunctionSummaryHits(void)</b><br>
+Returns how many times each function summary has been applied.
+
 - <b>integer getGprBitSize(void)</b><br>
 Returns the size in bits of the General Purpose Registers.
 
@@ -150,10 +206,25 @@ Returns the AST corresponding to the \ref py_MemoryAccess_page with the SSA form
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
 If status is True, returns a tuple of (dict model, \ref py_SOLVER_STATE_page status, integer solvingTime).
 
-- <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit, bool status=False, integer timeout=0)</b><br>
+- <b>dict getModelCacheStats(void)</b><br>
+Returns the counters of the \ref py_MODE_page `MODEL_REUSE` mode, as a dictionary with the `concrete`, `hits` and `misses` keys.
+`concrete` and `hits` count the queries satisfied by the concrete values and by a recent model, `misses` the queries sent to the solver.
+
+- <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit, bool status=False, integer timeout=0, [\ref py_SymbolicVariable_page, ...] projection=[])</b><br>
 Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
+If a `projection` is given, models differ on these variables only and only hold them, e.g. to enumerate the targets of a jump table.
 If status is True, returns a tuple of ([dict model, ...], \ref py_SOLVER_STATE_page status, integer solvingTime).
 
+- <b>[dict, ...] getModels([\ref py_AstNode_page, ...] nodes, integer threads=0, bool status=False, integer timeout=0)</b><br>
+Computes a model for each query of a list, like a generational search flipping each path constraint. Queries are solved concurrently
+on `threads` workers (0 for one per hardware thread), each with its own solver context. Models are returned in the order of the queries,
+an unsatisfiable query having an empty model. If status is True, returns a tuple of ([dict model, ...], [\ref py_SOLVER_STATE_page status, ...], [integer solvingTime, ...]).
+
+- <b>dict getNextExecutionFrontier(void)</b><br>
+Hands out the next unexplored branch of the execution tree and marks it as pending, or returns None if there is none. The branch is a dictionary
+with the `id`, `source`, `destination`, `threadId`, `prefix` and `predicate` keys. `prefix` is the \ref py_AstNode_page of the conjunction
+of the predicates taken from the root to the branch instruction, None at the root. `predicate` is the \ref py_AstNode_page to solve to take the branch.
+
 - <b>\ref py_Register_page getParentRegister(\ref py_Register_page reg)</b><br>
 Returns the parent \ref py_Register_page from a \ref py_Register_page.
 
@@ -184,6 +255,29 @@ Returns the AST corresponding to the \ref py_Register_page with the SSA form.
 - <b>\ref py_SOLVER_page getSolver(void)</b><br>
 Returns the SMT solver engine currently used.
 
+- <b>dict getSolverCacheStats(void)</b><br>
+Returns the counters of the solver cache used by the \ref py_MODE_page `SOLVER_CACHE` mode, as a dictionary with the `hits`, `misses`, `evictions` and `rejections` keys. An entry is rejected when its model does not satisfy the query.
+
+- <b>dict getSolverStats(void)</b><br>
+Returns the time spent in each phase by the queries sent to the solver, as a dictionary with the `queries`, `nodes`, `translation`, `check`, `model`, `numeral` and `decided` keys.
+Times are in microseconds: `translation` converts Triton's AST to the solver, `check` solves, `model` extracts the models and `numeral` parses their values.
+`nodes` counts the AST nodes translated, the ones reused from previous queries excluded. `decided` counts the queries answered
+by the \ref py_MODE_page `ABSTRACT_INTERPRETATION` mode without calling the solver.
+
+- <b>dict getSolverPortfolioStats(void)</b><br>
+Returns the number of queries won by each backend of the `SOLVER.PORTFOLIO` solver, as a dictionary of {string backend : integer wins}.
+
+- <b>string getSolverRecordDirectory(void)</b><br>
+Returns the directory of the recorded solver queries, an empty string if queries are not recorded.
+
+- <b>integer getSolverSessionSize(void)</b><br>
+Returns the number of constraints asserted in the incremental solver session. Assumptions given to `checkWithAssumption()` are not counted, as they are dropped after their check.
+
+- <b>[dict, ...] getSolverWorkerStats(void)</b><br>
+Returns the counters of each worker process of the `SOLVER.PROCESS_POOL` solver, as a list of dictionaries with the `pid`, `queries`,
+`crashes`, `timeouts` and `time` keys. `pid` is 0 while the worker is not running, `crashes` counts the workers killed or crashed and then
+restarted, and `time` is the time spent waiting for the worker in microseconds.
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpression(integer symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
@@ -295,6 +389,15 @@ Lifts a symbolic expression and all its references to Python format. If `icommen
 - <b>string liftToSMT(\ref py_SymbolicExpression_page expr, bool assert_=False, bool icomment=False)</b><br>
 Lifts a symbolic expression and all its references to SMT format. If `assert_` is true, then (assert <expr>). If `icomment` is true, then print instructions assembly in expression comments.
 
+- <b>void loadSolverCache(string path)</b><br>
+Adds the queries of a file written by `saveSolverCache()` to the solver cache.
+
+- <b>integer mergePathConstraints(integer frontier=0)</b><br>
+Merges the current path constraints into the execution tree, which keeps the paths of successive runs. Returns the number of new branch instructions.
+Directions seen but not taken are handed out by `getNextExecutionFrontier()` in discovery order. `frontier` is the id of the satisfiable branch
+whose model the run followed. If the run does not take it, it is handed out again, its model having diverged, and marked as timeout if it
+diverges twice.
+
 - <b>\ref py_SymbolicExpression_page newSymbolicExpression(\ref py_AstNode_page node, string comment)</b><br>
 Returns a new symbolic expression. Note that if there are simplification passes recorded, simplifications will be applied.
 
@@ -304,6 +407,9 @@ Returns a new symbolic variable.
 - <b>void popPathConstraint(void)</b><br>
 Pops the last constraints added to the path predicate.
 
+- <b>void popSolverScope(void)</b><br>
+Closes the last scope of the incremental solver session and drops the constraints asserted in it.
+
 - <b>\ref py_EXCEPTION_page processing(\ref py_Instruction_page inst)</b><br>
 Processes an instruction and updates engines according to the instruction semantics. Returns `EXCEPTION.NO_FAULT` if the instruction is supported.
 
@@ -313,12 +419,28 @@ Processes a basic block with a potential given base address and updates engines
 - <b>void pushPathConstraint(\ref py_AstNode_page node, string comment="")</b><br>
 Pushs constraints to the current path predicate.
 
+- <b>void pushSolverScope(void)</b><br>
+Opens a new scope in the incremental solver session.
+
 - <b>void removeCallback(\ref py_CALLBACK_page kind, function cb)</b><br>
 Removes a recorded callback.
 
 - <b>void reset(void)</b><br>
 Resets everything.
 
+- <b>void resetSolverSession(void)</b><br>
+Drops the incremental solver session, its scopes and its translated constraints.
+
+- <b>void resolveExecutionFrontier(integer id, \ref py_SOLVER_STATE_page status)</b><br>
+Resolves a branch handed out by `getNextExecutionFrontier()` with the status of its predicate. An unsatisfiable branch is marked as infeasible,
+a branch which timed out or is unknown as timeout. A satisfiable branch stays pending until the next merged run, which should follow its model.
+
+- <b>void retryExecutionTimeouts(void)</b><br>
+Hands out again the branches of the execution tree which timed out, e.g. to solve them with a larger timeout.
+
+- <b>void saveSolverCache(string path)</b><br>
+Writes the solver cache to a file, so that another run can skip the queries it already solved.
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -348,6 +470,13 @@ the symbolic state (if it exists). You should probably use the concretize functi
 - <b>void setConcreteVariableValue(\ref py_SymbolicVariable_page symVar, integer value)</b><br>
 Sets the concrete value of a symbolic variable.
 
+- <b>void setConcretizationBudget(integer level=0, integer nodes=0, integer variables=0, bool pin=False)</b><br>
+Sets the thresholds of the \ref py_MODE_page `CONCRETIZE_ON_BUDGET` mode on the level, the number of unique nodes and the number of symbolic variables of a new expression. A zero threshold is disabled.
+If `pin` is true, a path constraint pinning the concretized value is recorded.
+
+- <b>void setFunctionSummaryBound(integer bound)</b><br>
+Sets the maximum number of bytes covered by the ITE chains of function summaries (64 by default).
+
 - <b>void setMode(\ref py_MODE_page mode, bool flag)</b><br>
 Enables or disables a specific mode.
 
@@ -357,9 +486,20 @@ Defines an SMT solver
 - <b>void setSolverMemoryLimit(integer megabytes)</b><br>
 Defines a solver memory consumption limit (in megabytes)
 
+- <b>void setSolverPortfolioSeeds(integer seeds)</b><br>
+Defines the number of z3 instances with the random seeds 1 to `seeds` raced by the `SOLVER.PORTFOLIO` solver, next to the default one.
+The backends are created again and their wins are reset.
+
+- <b>void setSolverRecordDirectory(string path)</b><br>
+Writes every query sent to the solver to `path` as a SMT-LIB2 file with its backend, timeout, status, solving time and variables.
+The `triton-solver-bench` example replays such a corpus. An empty path stops recording.
+
 - <b>void setSolverTimeout(integer ms)</b><br>
 Defines a solver timeout (in milliseconds)
 
+- <b>void setSolverWorkers(integer workers)</b><br>
+Defines the number of worker processes of the `SOLVER.PROCESS_POOL` solver, one per core if 0.
+
 - <b>bool setTaintMemory(\ref py_MemoryAccess_page mem, bool flag)</b><br>
 Sets the targeted memory as tainted or not. Returns true if the memory is still tainted.
 
@@ -706,6 +846,94 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_addFunctionSummaries(PyObject* self, PyObject* args) {
+        std::map<std::string, triton::uint64> symbols;
+        PyObject* base  = nullptr;
+        PyObject* dict  = nullptr;
+        PyObject* abi   = nullptr;
+        PyObject* key   = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t pos  = 0;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &base, &dict, &abi) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addFunctionSummaries(): Invalid number of arguments");
+        }
+
+        if (base == nullptr || (!PyLong_Check(base) && !PyInt_Check(base)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addFunctionSummaries(): Expects an integer as first argument.");
+
+        if (dict == nullptr || !PyDict_Check(dict))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addFunctionSummaries(): Expects a dict as second argument.");
+
+        if (abi != nullptr && (!PyLong_Check(abi) && !PyInt_Check(abi)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addFunctionSummaries(): Expects a SYMBOLIC abi as third argument.");
+
+        while (PyDict_Next(dict, &pos, &key, &value)) {
+          if (!PyStr_Check(key) || (!PyLong_Check(value) && !PyInt_Check(value)))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::addFunctionSummaries(): Expects a dict of {string: integer}.");
+          symbols[PyStr_AsString(key)] = PyLong_AsUint64(value);
+        }
+
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->addFunctionSummaries(PyLong_AsUint64(base), symbols, abi == nullptr ? triton::engines::symbolic::DEFAULT_ABI : static_cast<triton::engines::symbolic::abi_e>(PyLong_AsUint32(abi))));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_addFunctionSummary(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* name = nullptr;
+        PyObject* abi  = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OOO", &addr, &name, &abi) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addFunctionSummary(): Invalid number of arguments");
+        }
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addFunctionSummary(): Expects an integer as first argument.");
+
+        if (name == nullptr || !PyStr_Check(name))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addFunctionSummary(): Expects a string as second argument.");
+
+        if (abi != nullptr && (!PyLong_Check(abi) && !PyInt_Check(abi)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::addFunctionSummary(): Expects a SYMBOLIC abi as third argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->addFunctionSummary(PyLong_AsUint64(addr), PyStr_AsString(name), abi == nullptr ? triton::engines::symbolic::DEFAULT_ABI : static_cast<triton::engines::symbolic::abi_e>(PyLong_AsUint32(abi)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_assertConstraint(PyObject* self, PyObject* node) {
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::assertConstraint(): Expects a AstNode as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->assertConstraint(PyAstNode_AsAstNode(node));
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
         PyObject* se  = nullptr;
         PyObject* mem = nullptr;
@@ -788,6 +1016,75 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_checkWithAssumption(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::solver::status_e status;
+        triton::uint32 solvingTime = 0;
+        triton::uint32 timeout_c = 0;
+
+        PyObject* dict    = nullptr;
+        PyObject* node    = nullptr;
+        PyObject* wb      = nullptr;
+        PyObject* timeout = nullptr;
+
+        static char* keywords[] = {
+          (char*)"node",
+          (char*)"status",
+          (char*)"timeout",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOO", keywords, &node, &wb, &timeout) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::checkWithAssumption(): Invalid keyword argument.");
+        }
+
+        if (node != nullptr && node != Py_None && !PyAstNode_Check(node)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::checkWithAssumption(): Expects a AstNode or None as node argument.");
+        }
+
+        if (wb != nullptr && !PyBool_Check(wb)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::checkWithAssumption(): Expects a boolean as status keyword.");
+        }
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::checkWithAssumption(): Expects a integer as timeout keyword.");
+        }
+
+        if (timeout != nullptr) {
+          timeout_c = PyLong_AsUint32(timeout);
+        }
+
+        try {
+          triton::ast::SharedAbstractNode assumption = nullptr;
+          if (node != nullptr && node != Py_None) {
+            assumption = PyAstNode_AsAstNode(node);
+          }
+
+          dict = triton::bindings::python::xPyDict_New();
+          auto model = PyTritonContext_AsTritonContext(self)->checkWithAssumption(assumption, &status, timeout_c, &solvingTime);
+          for (auto it = model.begin(); it != model.end(); it++) {
+            xPyDict_SetItem(dict, PyLong_FromUsize(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wb != nullptr && PyLong_AsBool(wb) == true) {
+          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
+          PyTuple_SetItem(tuple, 0, dict);
+          PyTuple_SetItem(tuple, 1, PyLong_FromUint32(status));
+          PyTuple_SetItem(tuple, 2, PyLong_FromUint32(solvingTime));
+          return tuple;
+        }
+
+        return dict;
+      }
+
+
       static PyObject* TritonContext_clearCallbacks(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->clearCallbacks();
@@ -804,6 +1101,19 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_clearDecodeCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearDecodeCache();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_clearModes(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->clearModes();
@@ -857,6 +1167,58 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_clearConcretizationStats(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearConcretizationStats();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearExecutionTree(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearExecutionTree();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearFunctionSummaries(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearFunctionSummaries();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearModelCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearModelCache();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_clearPathConstraints(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->clearPathConstraints();
@@ -870,6 +1232,32 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_clearSolverCache(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearSolverCache();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_clearSolverStats(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->clearSolverStats();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         try {
           PyTritonContext_AsTritonContext(self)->concretizeAllMemory();
@@ -1372,6 +1760,88 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getConcretizationStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getConcretizationStats();
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "level",     PyLong_FromUsize(stats.level));
+          xPyDict_SetItemString(ret, "nodes",     PyLong_FromUsize(stats.nodes));
+          xPyDict_SetItemString(ret, "variables", PyLong_FromUsize(stats.variables));
+          xPyDict_SetItemString(ret, "pinned",    PyLong_FromUsize(stats.pinned));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getDecodeCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getDecodeCacheStats();
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "hits",    PyLong_FromUsize(stats.hits));
+          xPyDict_SetItemString(ret, "misses",  PyLong_FromUsize(stats.misses));
+          xPyDict_SetItemString(ret, "flushes", PyLong_FromUsize(stats.flushes));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getExecutionTreeStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getExecutionTreeStats();
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "nodes",      PyLong_FromUsize(stats.nodes));
+          xPyDict_SetItemString(ret, "unexplored", PyLong_FromUsize(stats.unexplored));
+          xPyDict_SetItemString(ret, "pending",    PyLong_FromUsize(stats.pending));
+          xPyDict_SetItemString(ret, "explored",   PyLong_FromUsize(stats.explored));
+          xPyDict_SetItemString(ret, "infeasible", PyLong_FromUsize(stats.infeasible));
+          xPyDict_SetItemString(ret, "timeout",    PyLong_FromUsize(stats.timeout));
+          xPyDict_SetItemString(ret, "diverged",   PyLong_FromUsize(stats.diverged));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getFunctionSummaryBound(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getFunctionSummaryBound());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getFunctionSummaryHits(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          ret = xPyDict_New();
+          for (const auto& hit : PyTritonContext_AsTritonContext(self)->getFunctionSummaryHits()) {
+            xPyDict_SetItemString(ret, hit.first.c_str(), PyLong_FromUsize(hit.second));
+          }
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getGprBitSize(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint32(PyTritonContext_AsTritonContext(self)->getGprBitSize());
@@ -1494,6 +1964,73 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getModelCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getModelCacheStats();
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "concrete",  PyLong_FromUsize(stats.concrete));
+          xPyDict_SetItemString(ret, "hits",      PyLong_FromUsize(stats.hits));
+          xPyDict_SetItemString(ret, "misses",    PyLong_FromUsize(stats.misses));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getModelsBatch(PyObject* self, PyObject* nodes, triton::uint32 threads, bool wb, triton::uint32 timeout) {
+        std::vector<triton::engines::solver::status_e> status;
+        std::vector<triton::ast::SharedAbstractNode> queries;
+        std::vector<triton::uint32> solvingTime;
+        PyObject* ret = nullptr;
+
+        for (Py_ssize_t i = 0; i < PyList_Size(nodes); i++) {
+          PyObject* item = PyList_GetItem(nodes, i);
+          if (!PyAstNode_Check(item))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Each element from the list must be a AstNode.");
+          queries.push_back(PyAstNode_AsAstNode(item));
+        }
+
+        try {
+          auto models = PyTritonContext_AsTritonContext(self)->getModels(queries, threads, &status, timeout, &solvingTime);
+
+          ret = xPyList_New(models.size());
+          for (triton::usize index = 0; index < models.size(); index++) {
+            PyObject* mdict = xPyDict_New();
+            for (const auto& model : models[index]) {
+              xPyDict_SetItem(mdict, PyLong_FromUsize(model.first), PySolverModel(model.second));
+            }
+            PyList_SetItem(ret, index, mdict);
+          }
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        if (wb) {
+          PyObject* states = xPyList_New(status.size());
+          PyObject* times  = xPyList_New(solvingTime.size());
+          for (triton::usize index = 0; index < status.size(); index++) {
+            PyList_SetItem(states, index, PyLong_FromUint32(status[index]));
+            PyList_SetItem(times, index, PyLong_FromUint32(solvingTime[index]));
+          }
+          PyObject* tuple = triton::bindings::python::xPyTuple_New(3);
+          PyTuple_SetItem(tuple, 0, ret);
+          PyTuple_SetItem(tuple, 1, states);
+          PyTuple_SetItem(tuple, 2, times);
+          return tuple;
+        }
+
+        return ret;
+      }
+
+
       static PyObject* TritonContext_getModels(PyObject* self, PyObject* args, PyObject* kwargs) {
         triton::engines::solver::status_e status;
         triton::uint32 solvingTime = 0;
@@ -1504,25 +2041,29 @@ namespace triton {
         PyObject* limit   = nullptr;
         PyObject* wb      = nullptr;
         PyObject* timeout = nullptr;
+        PyObject* proj    = nullptr;
+
+        std::vector<triton::engines::symbolic::SharedSymbolicVariable> projection;
 
         static char* keywords[] = {
           (char*)"node",
           (char*)"limit",
           (char*)"status",
           (char*)"timeout",
+          (char*)"projection",
           nullptr
         };
 
         /* Extract Keywords */
-        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &node, &limit, &wb, &timeout) == false) {
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOOO", keywords, &node, &limit, &wb, &timeout, &proj) == false) {
           return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Invalid keyword argument.");
         }
 
-        if (node == nullptr || !PyAstNode_Check(node)) {
-          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a AstNode as node argument.");
+        if (node == nullptr || (!PyAstNode_Check(node) && !PyList_Check(node))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a AstNode or a list of AstNodes as node argument.");
         }
 
-        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit))) {
+        if ((limit == nullptr && !PyList_Check(node)) || (limit != nullptr && !PyLong_Check(limit) && !PyInt_Check(limit))) {
           return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects an integer as limit argument.");
         }
 
@@ -1538,8 +2079,25 @@ namespace triton {
           timeout_c = PyLong_AsUint32(timeout);
         }
 
+        if (proj != nullptr) {
+          if (!PyList_Check(proj) || PyList_Check(node))
+            return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Expects a list of SymbolicVariables as projection keyword of a single query.");
+
+          for (Py_ssize_t i = 0; i < PyList_Size(proj); i++) {
+            PyObject* item = PyList_GetItem(proj, i);
+            if (!PySymbolicVariable_Check(item))
+              return PyErr_Format(PyExc_TypeError, "TritonContext::getModels(): Each element of the projection must be a SymbolicVariable.");
+            projection.push_back(PySymbolicVariable_AsSymbolicVariable(item));
+          }
+        }
+
+        /* A list of queries is solved as a batch, the limit being the number of threads */
+        if (PyList_Check(node)) {
+          return TritonContext_getModelsBatch(self, node, (limit != nullptr ? PyLong_AsUint32(limit) : 0), (wb != nullptr && PyLong_AsBool(wb)), timeout_c);
+        }
+
         try {
-          auto models = PyTritonContext_AsTritonContext(self)->getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit), &status, timeout_c, &solvingTime);
+          auto models = PyTritonContext_AsTritonContext(self)->getModels(PyAstNode_AsAstNode(node), projection, PyLong_AsUint32(limit), &status, timeout_c, &solvingTime);
           triton::uint32 index = 0;
 
           ret = xPyList_New(models.size());
@@ -1569,7 +2127,40 @@ namespace triton {
           return tuple;
         }
 
-        return ret;
+        return ret;
+      }
+
+
+      static PyObject* TritonContext_getNextExecutionFrontier(PyObject* self, PyObject* noarg) {
+        triton::engines::symbolic::ExecutionFrontier frontier;
+        PyObject* ret = nullptr;
+
+        try {
+          if (!PyTritonContext_AsTritonContext(self)->getNextExecutionFrontier(frontier)) {
+            Py_INCREF(Py_None);
+            return Py_None;
+          }
+
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "id",          PyLong_FromUsize(frontier.id));
+          xPyDict_SetItemString(ret, "source",      PyLong_FromUint64(frontier.source));
+          xPyDict_SetItemString(ret, "destination", PyLong_FromUint64(frontier.destination));
+          xPyDict_SetItemString(ret, "threadId",    PyLong_FromUint32(frontier.threadId));
+          xPyDict_SetItemString(ret, "predicate",   PyAstNode(frontier.predicate));
+
+          if (frontier.prefix == nullptr) {
+            Py_INCREF(Py_None);
+            xPyDict_SetItemString(ret, "prefix", Py_None);
+          }
+          else {
+            xPyDict_SetItemString(ret, "prefix", PyAstNode(frontier.prefix));
+          }
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
       }
 
 
@@ -1728,6 +2319,105 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_getSolverCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getSolverCacheStats();
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "hits",       PyLong_FromUsize(stats.hits));
+          xPyDict_SetItemString(ret, "misses",     PyLong_FromUsize(stats.misses));
+          xPyDict_SetItemString(ret, "evictions",  PyLong_FromUsize(stats.evictions));
+          xPyDict_SetItemString(ret, "rejections", PyLong_FromUsize(stats.rejections));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          const auto& stats = PyTritonContext_AsTritonContext(self)->getSolverStats();
+          ret = xPyDict_New();
+          xPyDict_SetItemString(ret, "queries",     PyLong_FromUsize(stats.queries));
+          xPyDict_SetItemString(ret, "nodes",       PyLong_FromUsize(stats.nodes));
+          xPyDict_SetItemString(ret, "translation", PyLong_FromUint64(stats.translation));
+          xPyDict_SetItemString(ret, "check",       PyLong_FromUint64(stats.check));
+          xPyDict_SetItemString(ret, "model",       PyLong_FromUint64(stats.model));
+          xPyDict_SetItemString(ret, "numeral",     PyLong_FromUint64(stats.numeral));
+          xPyDict_SetItemString(ret, "decided",     PyLong_FromUsize(stats.decided));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverPortfolioStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          ret = xPyDict_New();
+          for (const auto& wins : PyTritonContext_AsTritonContext(self)->getSolverPortfolioStats())
+            xPyDict_SetItemString(ret, wins.first.c_str(), PyLong_FromUsize(wins.second));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverRecordDirectory(PyObject* self, PyObject* noarg) {
+        try {
+          return xPyString_FromString(PyTritonContext_AsTritonContext(self)->getSolverRecordDirectory().c_str());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverSessionSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->getSolverSessionSize());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* TritonContext_getSolverWorkerStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          auto workers = PyTritonContext_AsTritonContext(self)->getSolverWorkerStats();
+          triton::uint32 index = 0;
+
+          ret = xPyList_New(workers.size());
+          for (const auto& stats : workers) {
+            PyObject* worker = xPyDict_New();
+            xPyDict_SetItemString(worker, "pid",      PyLong_FromLong(stats.pid));
+            xPyDict_SetItemString(worker, "queries",  PyLong_FromUsize(stats.queries));
+            xPyDict_SetItemString(worker, "crashes",  PyLong_FromUsize(stats.crashes));
+            xPyDict_SetItemString(worker, "timeouts", PyLong_FromUsize(stats.timeouts));
+            xPyDict_SetItemString(worker, "time",     PyLong_FromUint64(stats.time));
+            PyList_SetItem(ret, index++, worker);
+          }
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_getSymbolicExpression(PyObject* self, PyObject* symExprId) {
         if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
           return PyErr_Format(PyExc_TypeError, "TritonContext::getSymbolicExpression(): Expects an integer as argument.");
@@ -2424,6 +3114,42 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_loadSolverCache(PyObject* self, PyObject* path) {
+        if (!PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::loadSolverCache(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->loadSolverCache(PyStr_AsString(path));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_mergePathConstraints(PyObject* self, PyObject* args) {
+        PyObject* frontier = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|O", &frontier) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mergePathConstraints(): Invalid number of arguments");
+        }
+
+        if (frontier != nullptr && !PyLong_Check(frontier) && !PyInt_Check(frontier))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::mergePathConstraints(): Expects an integer as argument.");
+
+        try {
+          return PyLong_FromUsize(PyTritonContext_AsTritonContext(self)->mergePathConstraints(frontier != nullptr ? PyLong_AsUsize(frontier) : 0));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* TritonContext_newSymbolicExpression(PyObject* self, PyObject* args) {
         PyObject* node          = nullptr;
         PyObject* comment       = nullptr;
@@ -2501,6 +3227,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_popSolverScope(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->popSolverScope();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_processing(PyObject* self, PyObject* args) {
         PyObject* obj  = nullptr;
         PyObject* addr = nullptr;
@@ -2572,6 +3314,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_pushSolverScope(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->pushSolverScope();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_removeCallback(PyObject* self, PyObject* args) {
         PyObject* cb       = nullptr;
         PyObject* cb_self  = nullptr;
@@ -2652,6 +3410,78 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_resetSolverSession(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->resetSolverSession();
+        }
+        catch (const triton::exceptions::PyCallbacks&) {
+          return nullptr;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_resolveExecutionFrontier(PyObject* self, PyObject* args) {
+        PyObject* id     = nullptr;
+        PyObject* status = nullptr;
+
+        /* Extract arguments */
+        if (PyArg_ParseTuple(args, "|OO", &id, &status) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::resolveExecutionFrontier(): Invalid number of arguments");
+        }
+
+        if (id == nullptr || (!PyLong_Check(id) && !PyInt_Check(id)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::resolveExecutionFrontier(): Expects an integer as first argument.");
+
+        if (status == nullptr || (!PyLong_Check(status) && !PyInt_Check(status)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::resolveExecutionFrontier(): Expects a SOLVER_STATE as second argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->resolveExecutionFrontier(PyLong_AsUsize(id), static_cast<triton::engines::solver::status_e>(PyLong_AsUint32(status)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_retryExecutionTimeouts(PyObject* self, PyObject* noarg) {
+        try {
+          PyTritonContext_AsTritonContext(self)->retryExecutionTimeouts();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_saveSolverCache(PyObject* self, PyObject* path) {
+        if (!PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::saveSolverCache(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->saveSolverCache(PyStr_AsString(path));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "TritonContext::setArchitecture(): Expects an ARCH as argument.");
@@ -2944,6 +3774,77 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_setConcretizationBudget(PyObject* self, PyObject* args, PyObject* kwargs) {
+        triton::engines::symbolic::ConcretizationBudget budget;
+
+        PyObject* level     = nullptr;
+        PyObject* nodes     = nullptr;
+        PyObject* variables = nullptr;
+        PyObject* pin       = nullptr;
+
+        static char* keywords[] = {
+          (char*)"level",
+          (char*)"nodes",
+          (char*)"variables",
+          (char*)"pin",
+          nullptr
+        };
+
+        /* Extract Keywords */
+        if (PyArg_ParseTupleAndKeywords(args, kwargs, "|OOOO", keywords, &level, &nodes, &variables, &pin) == false) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcretizationBudget(): Invalid keyword argument.");
+        }
+
+        if ((level != nullptr && (!PyLong_Check(level) && !PyInt_Check(level))) ||
+            (nodes != nullptr && (!PyLong_Check(nodes) && !PyInt_Check(nodes))) ||
+            (variables != nullptr && (!PyLong_Check(variables) && !PyInt_Check(variables)))) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcretizationBudget(): Expects integers as thresholds.");
+        }
+
+        if (pin != nullptr && !PyBool_Check(pin)) {
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setConcretizationBudget(): Expects a boolean as pin keyword.");
+        }
+
+        if (level != nullptr)
+          budget.level = PyLong_AsUint32(level);
+
+        if (nodes != nullptr)
+          budget.nodes = PyLong_AsUsize(nodes);
+
+        if (variables != nullptr)
+          budget.variables = PyLong_AsUsize(variables);
+
+        if (pin != nullptr)
+          budget.pin = PyLong_AsBool(pin);
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setConcretizationBudget(budget);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setFunctionSummaryBound(PyObject* self, PyObject* bound) {
+        if (bound == nullptr || (!PyLong_Check(bound) && !PyInt_Check(bound)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setFunctionSummaryBound(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setFunctionSummaryBound(PyLong_AsUint32(bound));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setMode(PyObject* self, PyObject* args) {
         PyObject* mode = nullptr;
         PyObject* flag = nullptr;
@@ -3006,6 +3907,22 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_setSolverRecordDirectory(PyObject* self, PyObject* path) {
+        if (!PyStr_Check(path))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverRecordDirectory(): Expects a string as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverRecordDirectory(PyStr_AsString(path));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setSolverTimeout(PyObject* self, PyObject* ms) {
         if (ms == nullptr || (!PyLong_Check(ms) && !PyInt_Check(ms)))
           return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverTimeout(): Expects an integer as argument.");
@@ -3022,6 +3939,38 @@ namespace triton {
       }
 
 
+      static PyObject* TritonContext_setSolverPortfolioSeeds(PyObject* self, PyObject* seeds) {
+        if (seeds == nullptr || (!PyLong_Check(seeds) && !PyInt_Check(seeds)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverPortfolioSeeds(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverPortfolioSeeds(PyLong_AsUint32(seeds));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* TritonContext_setSolverWorkers(PyObject* self, PyObject* workers) {
+        if (workers == nullptr || (!PyLong_Check(workers) && !PyInt_Check(workers)))
+          return PyErr_Format(PyExc_TypeError, "TritonContext::setSolverWorkers(): Expects an integer as argument.");
+
+        try {
+          PyTritonContext_AsTritonContext(self)->setSolverWorkers(PyLong_AsUint32(workers));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* TritonContext_setTaintMemory(PyObject* self, PyObject* args) {
         PyObject* mem  = nullptr;
         PyObject* flag = nullptr;
@@ -3560,13 +4509,24 @@ namespace triton {
       //! TritonContext methods.
       PyMethodDef TritonContext_callbacks[] = {
         {"addCallback",                         (PyCFunction)TritonContext_addCallback,                                                 METH_VARARGS,                  ""},
+        {"addFunctionSummaries",                (PyCFunction)TritonContext_addFunctionSummaries,                                        METH_VARARGS,                  ""},
+        {"addFunctionSummary",                  (PyCFunction)TritonContext_addFunctionSummary,                                          METH_VARARGS,                  ""},
+        {"assertConstraint",                    (PyCFunction)TritonContext_assertConstraint,                                            METH_O,                        ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)TritonContext_assignSymbolicExpressionToMemory,                            METH_VARARGS,                  ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)TritonContext_assignSymbolicExpressionToRegister,                          METH_VARARGS,                  ""},
         {"buildSemantics",                      (PyCFunction)TritonContext_buildSemantics,                                              METH_O,                        ""},
+        {"checkWithAssumption",                 (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_checkWithAssumption,         METH_VARARGS | METH_KEYWORDS,  ""},
         {"clearCallbacks",                      (PyCFunction)TritonContext_clearCallbacks,                                              METH_NOARGS,                   ""},
+        {"clearDecodeCache",                    (PyCFunction)TritonContext_clearDecodeCache,                                            METH_NOARGS,                   ""},
         {"clearModes",                          (PyCFunction)TritonContext_clearModes,                                                  METH_NOARGS,                   ""},
         {"clearConcreteMemoryValue",            (PyCFunction)TritonContext_clearConcreteMemoryValue,                                    METH_VARARGS,                  ""},
+        {"clearConcretizationStats",            (PyCFunction)TritonContext_clearConcretizationStats,                                    METH_NOARGS,                   ""},
+        {"clearExecutionTree",                  (PyCFunction)TritonContext_clearExecutionTree,                                          METH_NOARGS,                   ""},
+        {"clearFunctionSummaries",              (PyCFunction)TritonContext_clearFunctionSummaries,                                      METH_NOARGS,                   ""},
+        {"clearModelCache",                     (PyCFunction)TritonContext_clearModelCache,                                             METH_NOARGS,                   ""},
         {"clearPathConstraints",                (PyCFunction)TritonContext_clearPathConstraints,                                        METH_NOARGS,                   ""},
+        {"clearSolverCache",                    (PyCFunction)TritonContext_clearSolverCache,                                            METH_NOARGS,                   ""},
+        {"clearSolverStats",                    (PyCFunction)TritonContext_clearSolverStats,                                            METH_NOARGS,                   ""},
         {"concretizeAllMemory",                 (PyCFunction)TritonContext_concretizeAllMemory,                                         METH_NOARGS,                   ""},
         {"concretizeAllRegister",               (PyCFunction)TritonContext_concretizeAllRegister,                                       METH_NOARGS,                   ""},
         {"concretizeMemory",                    (PyCFunction)TritonContext_concretizeMemory,                                            METH_O,                        ""},
@@ -3584,12 +4544,19 @@ namespace triton {
         {"getConcreteMemoryValue",              (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getConcreteMemoryValue,      METH_VARARGS | METH_KEYWORDS,  ""},
         {"getConcreteRegisterValue",            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getConcreteRegisterValue,    METH_VARARGS | METH_KEYWORDS,  ""},
         {"getConcreteVariableValue",            (PyCFunction)TritonContext_getConcreteVariableValue,                                    METH_O,                        ""},
+        {"getConcretizationStats",              (PyCFunction)TritonContext_getConcretizationStats,                                      METH_NOARGS,                   ""},
+        {"getDecodeCacheStats",                 (PyCFunction)TritonContext_getDecodeCacheStats,                                         METH_NOARGS,                   ""},
+        {"getExecutionTreeStats",               (PyCFunction)TritonContext_getExecutionTreeStats,                                       METH_NOARGS,                   ""},
+        {"getFunctionSummaryBound",             (PyCFunction)TritonContext_getFunctionSummaryBound,                                     METH_NOARGS,                   ""},
+        {"getFunctionSummaryHits",              (PyCFunction)TritonContext_getFunctionSummaryHits,                                      METH_NOARGS,                   ""},
         {"getGprBitSize",                       (PyCFunction)TritonContext_getGprBitSize,                                               METH_NOARGS,                   ""},
         {"getGprSize",                          (PyCFunction)TritonContext_getGprSize,                                                  METH_NOARGS,                   ""},
         {"getImmediateAst",                     (PyCFunction)TritonContext_getImmediateAst,                                             METH_O,                        ""},
         {"getMemoryAst",                        (PyCFunction)TritonContext_getMemoryAst,                                                METH_O,                        ""},
         {"getModel",                            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModel,                    METH_VARARGS | METH_KEYWORDS,  ""},
+        {"getModelCacheStats",                  (PyCFunction)TritonContext_getModelCacheStats,                                          METH_NOARGS,                   ""},
         {"getModels",                           (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_getModels,                   METH_VARARGS | METH_KEYWORDS,  ""},
+        {"getNextExecutionFrontier",            (PyCFunction)TritonContext_getNextExecutionFrontier,                                    METH_NOARGS,                   ""},
         {"getParentRegister",                   (PyCFunction)TritonContext_getParentRegister,                                           METH_O,                        ""},
         {"getParentRegisters",                  (PyCFunction)TritonContext_getParentRegisters,                                          METH_NOARGS,                   ""},
         {"getPathConstraints",                  (PyCFunction)TritonContext_getPathConstraints,                                          METH_NOARGS,                   ""},
@@ -3599,6 +4566,12 @@ namespace triton {
         {"getRegister",                         (PyCFunction)TritonContext_getRegister,                                                 METH_O,                        ""},
         {"getRegisterAst",                      (PyCFunction)TritonContext_getRegisterAst,                                              METH_O,                        ""},
         {"getSolver",                           (PyCFunction)TritonContext_getSolver,                                                   METH_NOARGS,                   ""},
+        {"getSolverCacheStats",                 (PyCFunction)TritonContext_getSolverCacheStats,                                         METH_NOARGS,                   ""},
+        {"getSolverStats",                      (PyCFunction)TritonContext_getSolverStats,                                              METH_NOARGS,                   ""},
+        {"getSolverPortfolioStats",             (PyCFunction)TritonContext_getSolverPortfolioStats,                                     METH_NOARGS,                   ""},
+        {"getSolverRecordDirectory",            (PyCFunction)TritonContext_getSolverRecordDirectory,                                    METH_NOARGS,                   ""},
+        {"getSolverSessionSize",                (PyCFunction)TritonContext_getSolverSessionSize,                                        METH_NOARGS,                   ""},
+        {"getSolverWorkerStats",                (PyCFunction)TritonContext_getSolverWorkerStats,                                        METH_NOARGS,                   ""},
         {"getSymbolicExpression",               (PyCFunction)TritonContext_getSymbolicExpression,                                       METH_O,                        ""},
         {"getSymbolicExpressions",              (PyCFunction)TritonContext_getSymbolicExpressions,                                      METH_NOARGS,                   ""},
         {"getSymbolicMemory",                   (PyCFunction)TritonContext_getSymbolicMemory,                                           METH_VARARGS,                  ""},
@@ -3628,23 +4601,36 @@ namespace triton {
         {"liftToLLVM",                          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_liftToLLVM,                  METH_VARARGS | METH_KEYWORDS,  ""},
         {"liftToPython",                        (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_liftToPython,                METH_VARARGS | METH_KEYWORDS,  ""},
         {"liftToSMT",                           (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_liftToSMT,                   METH_VARARGS | METH_KEYWORDS,  ""},
+        {"loadSolverCache",                     (PyCFunction)TritonContext_loadSolverCache,                                             METH_O,                        ""},
+        {"mergePathConstraints",                (PyCFunction)TritonContext_mergePathConstraints,                                        METH_VARARGS,                  ""},
         {"newSymbolicExpression",               (PyCFunction)TritonContext_newSymbolicExpression,                                       METH_VARARGS,                  ""},
         {"newSymbolicVariable",                 (PyCFunction)TritonContext_newSymbolicVariable,                                         METH_VARARGS,                  ""},
         {"popPathConstraint",                   (PyCFunction)TritonContext_popPathConstraint,                                           METH_NOARGS,                   ""},
+        {"popSolverScope",                      (PyCFunction)TritonContext_popSolverScope,                                              METH_NOARGS,                   ""},
         {"processing",                          (PyCFunction)TritonContext_processing,                                                  METH_VARARGS,                  ""},
         {"pushPathConstraint",                  (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_pushPathConstraint,          METH_VARARGS | METH_KEYWORDS,  ""},
+        {"pushSolverScope",                     (PyCFunction)TritonContext_pushSolverScope,                                             METH_NOARGS,                   ""},
         {"removeCallback",                      (PyCFunction)TritonContext_removeCallback,                                              METH_VARARGS,                  ""},
         {"reset",                               (PyCFunction)TritonContext_reset,                                                       METH_NOARGS,                   ""},
+        {"resetSolverSession",                  (PyCFunction)TritonContext_resetSolverSession,                                          METH_NOARGS,                   ""},
+        {"resolveExecutionFrontier",            (PyCFunction)TritonContext_resolveExecutionFrontier,                                    METH_VARARGS,                  ""},
+        {"retryExecutionTimeouts",              (PyCFunction)TritonContext_retryExecutionTimeouts,                                      METH_NOARGS,                   ""},
+        {"saveSolverCache",                     (PyCFunction)TritonContext_saveSolverCache,                                             METH_O,                        ""},
         {"setArchitecture",                     (PyCFunction)TritonContext_setArchitecture,                                             METH_O,                        ""},
         {"setAstRepresentationMode",            (PyCFunction)TritonContext_setAstRepresentationMode,                                    METH_O,                        ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_setConcreteMemoryAreaValue,  METH_VARARGS | METH_KEYWORDS,  ""},
         {"setConcreteMemoryValue",              (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_setConcreteMemoryValue,      METH_VARARGS | METH_KEYWORDS,  ""},
         {"setConcreteRegisterValue",            (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_setConcreteRegisterValue,    METH_VARARGS | METH_KEYWORDS,  ""},
         {"setConcreteVariableValue",            (PyCFunction)TritonContext_setConcreteVariableValue,                                    METH_VARARGS,                  ""},
+        {"setConcretizationBudget",             (PyCFunction)(void*)(PyCFunctionWithKeywords)TritonContext_setConcretizationBudget,     METH_VARARGS | METH_KEYWORDS,  ""},
+        {"setFunctionSummaryBound",             (PyCFunction)TritonContext_setFunctionSummaryBound,                                     METH_O,                        ""},
         {"setMode",                             (PyCFunction)TritonContext_setMode,                                                     METH_VARARGS,                  ""},
         {"setSolver",                           (PyCFunction)TritonContext_setSolver,                                                   METH_O,                        ""},
         {"setSolverMemoryLimit",                (PyCFunction)TritonContext_setSolverMemoryLimit,                                        METH_O,                        ""},
+        {"setSolverPortfolioSeeds",             (PyCFunction)TritonContext_setSolverPortfolioSeeds,                                     METH_O,                        ""},
+        {"setSolverRecordDirectory",            (PyCFunction)TritonContext_setSolverRecordDirectory,                                    METH_O,                        ""},
         {"setSolverTimeout",                    (PyCFunction)TritonContext_setSolverTimeout,                                            METH_O,                        ""},
+        {"setSolverWorkers",                    (PyCFunction)TritonContext_setSolverWorkers,                                            METH_O,                        ""},
         {"setTaintMemory",                      (PyCFunction)TritonContext_setTaintMemory,                                              METH_VARARGS,                  ""},
         {"setTaintRegister",                    (PyCFunction)TritonContext_setTaintRegister,                                            METH_VARARGS,                  ""},
         {"setThumb",                            (PyCFunction)TritonContext_setThumb,                                                    METH_O,                        ""},
@@ -383,6 +383,8 @@ namespace triton {
 
   triton::uint512 Context::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
     this->checkArchitecture();
+    /* The concrete value of a lazy flag is synchronized when it is built */
+    this->symbolic->materializeLazyFlag(reg);
     return this->arch.getConcreteRegisterValue(reg, execCallbacks);
   }
 
@@ -437,6 +439,7 @@ namespace triton {
 
   void Context::setConcreteRegisterValue(const triton::arch::Register& reg, const triton::uint512& value, bool execCallbacks) {
     this->checkArchitecture();
+    this->symbolic->materializeLazyFlag(reg);
     this->arch.setConcreteRegisterValue(reg, value, execCallbacks);
     /*
      * In order to synchronize the concrete state with the symbolic
@@ -451,6 +454,8 @@ namespace triton {
       throw triton::exceptions::Engines("Context::setConcreteState(): Not the same architecture.");
     }
 
+    this->symbolic->materializeLazyFlags();
+
     switch (this->getArchitecture()) {
       case triton::arch::ARCH_X86_64:
         *static_cast<triton::arch::x86::x8664Cpu*>(this->getCpuInstance()) = *static_cast<triton::arch::x86::x8664Cpu*>(other.getCpuInstance());
@@ -543,7 +548,7 @@ namespace triton {
     if (this->symbolic == nullptr)
       throw triton::exceptions::Context("Context::initEngines(): Not enough memory.");
 
-    this->solver = new(std::nothrow) triton::engines::solver::SolverEngine();
+    this->solver = new(std::nothrow) triton::engines::solver::SolverEngine(this->modes);
     if (this->solver == nullptr)
       throw triton::exceptions::Context("Context::initEngines(): Not enough memory.");
 
@@ -555,10 +560,18 @@ namespace triton {
     if (this->lifting == nullptr)
       throw triton::exceptions::Context("Context::initEngines(): Not enough memory.");
 
-    this->irBuilder = new(std::nothrow) triton::arch::IrBuilder(&this->arch, this->modes, this->astCtxt, this->symbolic, this->taint);
+    this->summaries = new(std::nothrow) triton::engines::symbolic::FunctionSummaries(&this->arch, this->modes, this->symbolic, this->taint, this->astCtxt);
+    if (this->summaries == nullptr)
+      throw triton::exceptions::Context("Context::initEngines(): Not enough memory.");
+
+    this->irBuilder = new(std::nothrow) triton::arch::IrBuilder(&this->arch, this->modes, this->astCtxt, this->symbolic, this->taint, this->summaries);
     if (this->irBuilder == nullptr)
       throw triton::exceptions::Context("Context::initEngines(): Not enough memory.");
 
+    this->decodeCache = new(std::nothrow) triton::arch::DecodeCache(&this->arch);
+    if (this->decodeCache == nullptr)
+      throw triton::exceptions::Context("Context::initEngines(): Not enough memory.");
+
     /* Setup registers shortcut */
     this->registers.init(this->arch.getArchitecture());
   }
@@ -569,15 +582,19 @@ namespace triton {
       delete this->irBuilder;
       delete this->lifting;
       delete this->solver;
+      delete this->summaries;
       delete this->symbolic;
       delete this->taint;
-
-      this->astCtxt   = nullptr;
-      this->irBuilder = nullptr;
-      this->lifting   = nullptr;
-      this->solver    = nullptr;
-      this->symbolic  = nullptr;
-      this->taint     = nullptr;
+      delete this->decodeCache;
+
+      this->astCtxt     = nullptr;
+      this->irBuilder   = nullptr;
+      this->lifting     = nullptr;
+      this->solver      = nullptr;
+      this->summaries   = nullptr;
+      this->symbolic    = nullptr;
+      this->taint       = nullptr;
+      this->decodeCache = nullptr;
     }
 
     // Clean up the ast context
@@ -601,18 +618,37 @@ namespace triton {
 
   triton::arch::exception_e Context::processing(triton::arch::Instruction& inst) {
     this->checkArchitecture();
-    this->arch.disassembly(inst);
+    if (this->modes->isModeEnabled(triton::modes::DECODE_CACHE))
+      this->decodeCache->disassembly(inst);
+    else
+      this->arch.disassembly(inst);
     return this->irBuilder->buildSemantics(inst);
   }
 
 
   triton::arch::exception_e Context::processing(triton::arch::BasicBlock& block, triton::uint64 addr) {
     this->checkArchitecture();
-    this->arch.disassembly(block, addr);
+    if (this->modes->isModeEnabled(triton::modes::DECODE_CACHE))
+      this->decodeCache->disassembly(block, addr);
+    else
+      this->arch.disassembly(block, addr);
     return this->irBuilder->buildSemantics(block);
   }
 
 
+  const triton::arch::DecodeCacheStats& Context::getDecodeCacheStats(void) const {
+    this->checkArchitecture();
+    return this->decodeCache->getStats();
+  }
+
+
+  void Context::clearDecodeCache(void) {
+    this->checkArchitecture();
+    this->decodeCache->clear();
+    this->decodeCache->clearStats();
+  }
+
+
 
   /* IR builder Context ================================================================================= */
 
@@ -850,6 +886,7 @@ namespace triton {
 
   std::unordered_map<triton::arch::register_e, triton::engines::symbolic::SharedSymbolicExpression> Context::getSymbolicRegisters(void) const {
     this->checkSymbolic();
+    this->symbolic->materializeLazyFlags();
     return this->symbolic->getSymbolicRegisters();
   }
 
@@ -862,6 +899,7 @@ namespace triton {
 
   const triton::engines::symbolic::SharedSymbolicExpression& Context::getSymbolicRegister(const triton::arch::Register& reg) const {
     this->checkSymbolic();
+    this->symbolic->materializeLazyFlag(reg);
     return this->symbolic->getSymbolicRegister(reg);
   }
 
@@ -1000,6 +1038,42 @@ namespace triton {
   }
 
 
+  triton::usize Context::mergePathConstraints(triton::usize frontier) {
+    this->checkSymbolic();
+    return this->symbolic->mergePathConstraints(frontier);
+  }
+
+
+  bool Context::getNextExecutionFrontier(triton::engines::symbolic::ExecutionFrontier& frontier) {
+    this->checkSymbolic();
+    return this->symbolic->getExecutionTree().getNextFrontier(frontier);
+  }
+
+
+  void Context::resolveExecutionFrontier(triton::usize id, triton::engines::solver::status_e status) {
+    this->checkSymbolic();
+    this->symbolic->getExecutionTree().resolve(id, status);
+  }
+
+
+  void Context::retryExecutionTimeouts(void) {
+    this->checkSymbolic();
+    this->symbolic->getExecutionTree().retryTimeouts();
+  }
+
+
+  const triton::engines::symbolic::ExecutionTreeStats& Context::getExecutionTreeStats(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getExecutionTree().getStats();
+  }
+
+
+  void Context::clearExecutionTree(void) {
+    this->checkSymbolic();
+    this->symbolic->getExecutionTree().clear();
+  }
+
+
   bool Context::isSymbolicExpressionExists(triton::usize symExprId) const {
     this->checkSymbolic();
     return this->symbolic->isSymbolicExpressionExists(symExprId);
@@ -1020,6 +1094,7 @@ namespace triton {
 
   bool Context::isRegisterSymbolized(const triton::arch::Register& reg) const {
     this->checkSymbolic();
+    this->symbolic->materializeLazyFlag(reg);
     return this->symbolic->isRegisterSymbolized(reg);
   }
 
@@ -1054,6 +1129,66 @@ namespace triton {
   }
 
 
+  void Context::addFunctionSummary(triton::uint64 addr, const std::string& name, triton::engines::symbolic::abi_e abi) {
+    this->checkSymbolic();
+    this->summaries->addSummary(addr, name, abi);
+  }
+
+
+  triton::usize Context::addFunctionSummaries(triton::uint64 base, const std::map<std::string, triton::uint64>& symbols, triton::engines::symbolic::abi_e abi) {
+    this->checkSymbolic();
+    return this->summaries->addSummaries(base, symbols, abi);
+  }
+
+
+  void Context::clearFunctionSummaries(void) {
+    this->checkSymbolic();
+    this->summaries->clearSummaries();
+  }
+
+
+  void Context::setFunctionSummaryBound(triton::uint32 bound) {
+    this->checkSymbolic();
+    this->summaries->setBound(bound);
+  }
+
+
+  triton::uint32 Context::getFunctionSummaryBound(void) const {
+    this->checkSymbolic();
+    return this->summaries->getBound();
+  }
+
+
+  const std::map<std::string, triton::usize>& Context::getFunctionSummaryHits(void) const {
+    this->checkSymbolic();
+    return this->summaries->getHits();
+  }
+
+
+  void Context::setConcretizationBudget(const triton::engines::symbolic::ConcretizationBudget& budget) {
+    this->checkSymbolic();
+    this->symbolic->setConcretizationBudget(budget);
+  }
+
+
+  const triton::engines::symbolic::ConcretizationBudget& Context::getConcretizationBudget(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getConcretizationBudget();
+  }
+
+
+  const triton::engines::symbolic::ConcretizationStats& Context::getConcretizationStats(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getConcretizationStats();
+  }
+
+
+  void Context::clearConcretizationStats(void) {
+    this->checkSymbolic();
+    this->symbolic->clearConcretizationStats();
+  }
+
+
   std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> Context::sliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr) {
     this->checkSymbolic();
     return this->symbolic->sliceExpressions(expr);
@@ -1123,6 +1258,18 @@ namespace triton {
   }
 
 
+  std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> Context::getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+    this->checkSolver();
+    return this->solver->getModels(node, projection, limit, status, timeout, solvingTime);
+  }
+
+
+  std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> Context::getModels(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 threads, std::vector<triton::engines::solver::status_e>* status, triton::uint32 timeout, std::vector<triton::uint32>* solvingTime) const {
+    this->checkSolver();
+    return this->solver->getModels(nodes, threads, status, timeout, solvingTime);
+  }
+
+
   bool Context::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
     this->checkSolver();
     return this->solver->isSat(node, status, timeout, solvingTime);
@@ -1168,6 +1315,148 @@ namespace triton {
   }
 
 
+  const triton::engines::solver::SolverStats& Context::getSolverStats(void) const {
+    this->checkSolver();
+    return this->solver->getStats();
+  }
+
+
+  void Context::clearSolverStats(void) {
+    this->checkSolver();
+    this->solver->clearStats();
+  }
+
+
+  const triton::engines::solver::SolverCacheStats& Context::getSolverCacheStats(void) const {
+    this->checkSolver();
+    return this->solver->getCacheStats();
+  }
+
+
+  void Context::clearSolverCache(void) {
+    this->checkSolver();
+    this->solver->clearCache();
+  }
+
+
+  const triton::engines::solver::ModelCacheStats& Context::getModelCacheStats(void) const {
+    this->checkSolver();
+    return this->solver->getModelCacheStats();
+  }
+
+
+  void Context::clearModelCache(void) {
+    this->checkSolver();
+    this->solver->clearModelCache();
+  }
+
+
+  std::map<std::string, triton::usize> Context::getSolverPortfolioStats(void) const {
+    this->checkSolver();
+    #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+    if (this->getSolver() == triton::engines::solver::SOLVER_PORTFOLIO) {
+      return reinterpret_cast<const triton::engines::solver::PortfolioSolver*>(this->getSolverInstance())->getWins();
+    }
+    #endif
+    throw triton::exceptions::Context("Context::getSolverPortfolioStats(): Solver instance must be a SOLVER_PORTFOLIO.");
+  }
+
+
+  std::vector<triton::engines::solver::SolverWorkerStats> Context::getSolverWorkerStats(void) const {
+    this->checkSolver();
+    #if !defined(_WIN32) && (defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE))
+    if (this->getSolver() == triton::engines::solver::SOLVER_PROCESS_POOL) {
+      return reinterpret_cast<const triton::engines::solver::ProcessPoolSolver*>(this->getSolverInstance())->getWorkerStats();
+    }
+    #endif
+    throw triton::exceptions::Context("Context::getSolverWorkerStats(): Solver instance must be a SOLVER_PROCESS_POOL.");
+  }
+
+
+  void Context::setSolverPortfolioSeeds(triton::uint32 seeds) {
+    this->checkSolver();
+    #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+    if (this->getSolver() == triton::engines::solver::SOLVER_PORTFOLIO) {
+      this->solver->setPortfolioSeeds(seeds);
+      return;
+    }
+    #endif
+    throw triton::exceptions::Context("Context::setSolverPortfolioSeeds(): Solver instance must be a SOLVER_PORTFOLIO.");
+  }
+
+
+  void Context::setSolverWorkers(triton::uint32 workers) {
+    this->checkSolver();
+    #if !defined(_WIN32) && (defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE))
+    if (this->getSolver() == triton::engines::solver::SOLVER_PROCESS_POOL) {
+      this->solver->setWorkers(workers);
+      return;
+    }
+    #endif
+    throw triton::exceptions::Context("Context::setSolverWorkers(): Solver instance must be a SOLVER_PROCESS_POOL.");
+  }
+
+
+  void Context::loadSolverCache(const std::string& path) {
+    this->checkSolver();
+    this->solver->loadCache(path);
+  }
+
+
+  void Context::saveSolverCache(const std::string& path) const {
+    this->checkSolver();
+    this->solver->saveCache(path);
+  }
+
+
+  void Context::setSolverRecordDirectory(const std::string& path) {
+    this->checkSolver();
+    this->solver->setRecordDirectory(path);
+  }
+
+
+  const std::string& Context::getSolverRecordDirectory(void) const {
+    this->checkSolver();
+    return this->solver->getRecordDirectory();
+  }
+
+
+  void Context::pushSolverScope(void) {
+    this->checkSolver();
+    this->solver->pushScope();
+  }
+
+
+  void Context::popSolverScope(void) {
+    this->checkSolver();
+    this->solver->popScope();
+  }
+
+
+  void Context::assertConstraint(const triton::ast::SharedAbstractNode& node) {
+    this->checkSolver();
+    this->solver->assertConstraint(node);
+  }
+
+
+  std::unordered_map<triton::usize, triton::engines::solver::SolverModel> Context::checkWithAssumption(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+    this->checkSolver();
+    return this->solver->checkWithAssumption(node, status, timeout, solvingTime);
+  }
+
+
+  void Context::resetSolverSession(void) {
+    this->checkSolver();
+    this->solver->resetSession();
+  }
+
+
+  triton::usize Context::getSolverSessionSize(void) const {
+    this->checkSolver();
+    return this->solver->getSessionSize();
+  }
+
+
 
   /* Taint engine Context ============================================================================== */
 
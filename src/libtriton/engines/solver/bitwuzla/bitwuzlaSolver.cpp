@@ -6,6 +6,7 @@
 */
 
 #include <fstream>
+#include <mutex>
 #include <regex>
 #include <string>
 
@@ -23,18 +24,58 @@ namespace triton {
   namespace engines {
     namespace solver {
 
-      BitwuzlaSolver::BitwuzlaSolver() {
+      /* Returns the microseconds elapsed since `start` */
+      static triton::uint64 elapsed(const std::chrono::steady_clock::time_point& start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+      }
+
+
+      /* The counters of a query, published as the ones of the last query when it returns or throws */
+      class BitwuzlaSolver::QueryStats : public triton::engines::solver::SolverStats {
+        private:
+          const BitwuzlaSolver* solver;
+
+        public:
+          QueryStats(const BitwuzlaSolver* solver) : solver(solver) {
+            this->queries = 1;
+          }
+
+          ~QueryStats() {
+            std::lock_guard<std::mutex> lock(this->solver->statsLock);
+            this->solver->stats = *this;
+          }
+      };
+
+
+      BitwuzlaSolver::BitwuzlaSolver()
+        : sessionParams(0, 0) {
         this->timeout = 0;
         this->memoryLimit = 0;
+        this->interrupted = false;
+        this->sessionOptions = nullptr;
+        this->sessionTermMgr = nullptr;
+        this->session = nullptr;
+        this->sessionScopes = 0;
 
         // Set bitwuzla abort function.
         bitwuzla_set_abort_callback(this->abortCallback);
       }
 
 
+      BitwuzlaSolver::~BitwuzlaSolver() {
+        this->resetSession();
+      }
+
+
       int32_t BitwuzlaSolver::terminateCallback(void* state) {
         auto p = reinterpret_cast<SolverParams*>(state);
 
+        // Check interruption.
+        if (p->interrupted && p->interrupted->load()) {
+          p->status = triton::engines::solver::UNKNOWN;
+          return 1;
+        }
+
         // Count elapsed time.
         auto delta = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - p->start).count();
 
@@ -92,102 +133,147 @@ namespace triton {
                                                                                             triton::engines::solver::status_e* status,
                                                                                             triton::uint32 timeout,
                                                                                             triton::uint32* solvingTime) const {
+        return this->getModels(node, {}, limit, status, timeout, solvingTime);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> BitwuzlaSolver::getModels(const triton::ast::SharedAbstractNode& node,
+                                                                                            const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection,
+                                                                                            triton::uint32 limit,
+                                                                                            triton::engines::solver::status_e* status,
+                                                                                            triton::uint32 timeout,
+                                                                                            triton::uint32* solvingTime) const {
         if (node == nullptr)
           throw triton::exceptions::SolverEngine("BitwuzlaSolver::getModels(): Node cannot be null.");
 
         if (node->isLogical() == false)
           throw triton::exceptions::SolverEngine("BitwuzlaSolver::getModels(): Must be a logical node.");
 
-        // Create solver.
-        auto bzlaOptions = bitwuzla_options_new();
-        bitwuzla_set_option(bzlaOptions, BITWUZLA_OPT_PRODUCE_MODELS, 1);
-        auto bzlaTermMgr = bitwuzla_term_manager_new();
-        auto bzla = bitwuzla_new(bzlaTermMgr, bzlaOptions);
+        std::unique_ptr<Instance> local;
+        std::unique_lock<std::mutex> shared(this->instanceLock, std::defer_lock);
+        Instance& instance = this->getInstance(shared, local);
 
-        // Convert Triton' AST to solver terms.
-        auto bzlaAst = triton::ast::TritonToBitwuzla();
-        bitwuzla_assert(bzla, bzlaAst.convert(node, bzla));
+        auto bzla = instance.bzla;
+        auto bzlaTermMgr = instance.termMgr;
 
-        auto tmout = timeout != 0 ? timeout : this->timeout;
+        QueryStats stats(this);
 
-        // Set solving params.
-        SolverParams p(tmout, this->memoryLimit);
-        if (tmout || this->memoryLimit) {
-          bitwuzla_set_termination_callback(bzla, this->terminateCallback, reinterpret_cast<void*>(&p));
-        }
+        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+        try {
+          // The query and its blocking clauses live in a scope, the translated terms are kept.
+          bitwuzla_push(bzla, 1);
+
+          // Convert Triton' AST to solver terms.
+          auto translation = std::chrono::steady_clock::now();
+          bitwuzla_assert(bzla, instance.ast.convert(node, bzla));
+          stats.nodes = instance.ast.getTranslatedCount();
+
+          // Only the variables of this query, or the projected ones, belong to its models.
+          std::unordered_map<BitwuzlaTerm, triton::engines::symbolic::SharedSymbolicVariable> variables;
+          if (projection.empty()) {
+            variables = instance.ast.getVariables(node);
+          }
+          for (const auto& symVar : projection) {
+            variables[instance.ast.convert(node->getContext()->variable(symVar), bzla)] = symVar;
+            stats.nodes += instance.ast.getTranslatedCount();
+          }
 
-        // Get time of solving start.
-        auto start = std::chrono::system_clock::now();
+          stats.translation = elapsed(translation);
+          instance.translations += stats.nodes;
 
-        // Check result.
-        auto res = bitwuzla_check_sat(bzla);
+          auto tmout = timeout != 0 ? timeout : this->timeout;
 
-        // Write back status.
-        if (status) {
-          switch (res) {
-            case BITWUZLA_SAT:
-              *status = triton::engines::solver::SAT;
-              break;
-            case BITWUZLA_UNSAT:
-              *status = triton::engines::solver::UNSAT;
-              break;
-            case BITWUZLA_UNKNOWN:
-              *status = p.status;
-              break;
-          }
-        }
+          // Set solving params.
+          instance.params = SolverParams(tmout, this->memoryLimit);
+          instance.params.interrupted = &this->interrupted;
 
-        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
-        while(res == BITWUZLA_SAT && limit >= 1) {
-          std::vector<BitwuzlaTerm> solution;
-          solution.reserve(bzlaAst.getVariables().size());
-
-          // Parse model.
-          std::unordered_map<triton::usize, SolverModel> model;
-          for (const auto& it : bzlaAst.getVariables()) {
-            const char* svalue = bitwuzla_term_value_get_str_fmt(bitwuzla_get_value(bzla, it.first), 2);
-            auto value = this->fromBvalueToUint512(svalue);
-            auto m = SolverModel(it.second, value);
-            model[m.getId()] = m;
+          // Get time of solving start.
+          auto start = std::chrono::system_clock::now();
 
-            // Negate current model to escape duplication in the next solution.
-            const auto& symvar_sort = bzlaAst.getBitvectorSorts().at(it.second->getSize());
-            auto cur_val = bitwuzla_mk_bv_value(bzlaTermMgr, symvar_sort, svalue, 2);
-            auto n = bitwuzla_mk_term2(bzlaTermMgr, BITWUZLA_KIND_EQUAL, it.first, cur_val);
-            solution.push_back(bitwuzla_mk_term1(bzlaTermMgr, BITWUZLA_KIND_NOT, n));
-          }
+          // Check result.
+          auto check = std::chrono::steady_clock::now();
+          auto res = bitwuzla_check_sat(bzla);
+          stats.check += elapsed(check);
 
-          // Check that model is available.
-          if (model.empty()) {
-            break;
+          // Write back status.
+          if (status) {
+            switch (res) {
+              case BITWUZLA_SAT:
+                *status = triton::engines::solver::SAT;
+                break;
+              case BITWUZLA_UNSAT:
+                *status = triton::engines::solver::UNSAT;
+                break;
+              case BITWUZLA_UNKNOWN:
+                *status = instance.params.status;
+                break;
+            }
           }
 
-          // Push model.
-          ret.push_back(model);
-
-          if (--limit) {
-            // Escape last model.
-            if (solution.size() > 1) {
-              bitwuzla_assert(bzla, bitwuzla_mk_term(bzlaTermMgr, BITWUZLA_KIND_OR, solution.size(), solution.data()));
+          while(res == BITWUZLA_SAT && limit >= 1) {
+            std::vector<BitwuzlaTerm> solution;
+            solution.reserve(variables.size());
+
+            // Parse model.
+            auto extraction = std::chrono::steady_clock::now();
+            triton::uint64 numerals = 0;
+            std::unordered_map<triton::usize, SolverModel> model;
+            for (const auto& it : variables) {
+              auto cur_val = bitwuzla_get_value(bzla, it.first);
+              const char* svalue = bitwuzla_term_value_get_str_fmt(cur_val, 2);
+              auto numeral = std::chrono::steady_clock::now();
+              auto value = this->fromBvalueToUint512(svalue);
+              numerals += elapsed(numeral);
+              auto m = SolverModel(it.second, value);
+              model[m.getId()] = m;
+
+              // Negate current model to escape duplication in the next solution.
+              auto n = bitwuzla_mk_term2(bzlaTermMgr, BITWUZLA_KIND_EQUAL, it.first, cur_val);
+              solution.push_back(bitwuzla_mk_term1(bzlaTermMgr, BITWUZLA_KIND_NOT, n));
             }
-            else {
-              bitwuzla_assert(bzla, solution.front());
+
+            stats.numeral += numerals;
+            stats.model   += elapsed(extraction) - numerals;
+
+            // Check that model is available.
+            if (model.empty()) {
+              break;
             }
 
-            // Get next model.
-            res = bitwuzla_check_sat(bzla);
+            // Push model.
+            ret.push_back(model);
+
+            if (--limit) {
+              // Escape last model.
+              if (solution.size() > 1) {
+                bitwuzla_assert(bzla, bitwuzla_mk_term(bzlaTermMgr, BITWUZLA_KIND_OR, solution.size(), solution.data()));
+              }
+              else {
+                bitwuzla_assert(bzla, solution.front());
+              }
+
+              // Get next model.
+              check = std::chrono::steady_clock::now();
+              res = bitwuzla_check_sat(bzla);
+              stats.check += elapsed(check);
+            }
           }
-        }
 
-        // Get time of solving end.
-        auto end = std::chrono::system_clock::now();
+          // Get time of solving end.
+          auto end = std::chrono::system_clock::now();
 
-        if (solvingTime)
-          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+          if (solvingTime)
+            *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 
-        bitwuzla_delete(bzla);
-        bitwuzla_term_manager_delete(bzlaTermMgr);
-        bitwuzla_options_delete(bzlaOptions);
+          bitwuzla_pop(bzla, 1);
+        }
+        catch (const triton::exceptions::Exception&) {
+          // An aborted query leaves its scope open, the shared instance is dropped.
+          if (shared.owns_lock()) {
+            this->instance.reset();
+          }
+          throw;
+        }
 
         return ret;
       }
@@ -247,11 +333,212 @@ namespace triton {
       }
 
 
+      BitwuzlaSolver::Instance::Instance()
+        : ast(false), params(0, 0) {
+        this->options = bitwuzla_options_new();
+        bitwuzla_set_option(this->options, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+        this->termMgr = bitwuzla_term_manager_new();
+        this->bzla = bitwuzla_new(this->termMgr, this->options);
+        this->translations = 0;
+
+        // The parameters outlive every query of the instance.
+        bitwuzla_set_termination_callback(this->bzla, BitwuzlaSolver::terminateCallback, reinterpret_cast<void*>(&this->params));
+      }
+
+
+      BitwuzlaSolver::Instance::~Instance() {
+        bitwuzla_delete(this->bzla);
+        bitwuzla_term_manager_delete(this->termMgr);
+        bitwuzla_options_delete(this->options);
+      }
+
+
+      BitwuzlaSolver::Instance& BitwuzlaSolver::getInstance(std::unique_lock<std::mutex>& lock, std::unique_ptr<Instance>& local) const {
+        // A query solved concurrently on the same solver cannot share the instance.
+        if (lock.try_lock()) {
+          // The term manager keeps the terms of dead nodes, it is renewed once they may dominate.
+          if (this->instance != nullptr && this->instance->translations > 0x100000) {
+            this->instance.reset();
+          }
+
+          if (this->instance == nullptr) {
+            this->instance.reset(new(std::nothrow) Instance());
+            if (this->instance == nullptr) {
+              throw triton::exceptions::SolverEngine("BitwuzlaSolver::getInstance(): Not enough memory.");
+            }
+          }
+          return *this->instance;
+        }
+
+        local.reset(new(std::nothrow) Instance());
+        if (local == nullptr) {
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::getInstance(): Not enough memory.");
+        }
+
+        return *local;
+      }
+
+
+      void BitwuzlaSolver::initSession(void) {
+        if (this->session != nullptr) {
+          return;
+        }
+
+        this->sessionOptions = bitwuzla_options_new();
+        bitwuzla_set_option(this->sessionOptions, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+        this->sessionTermMgr = bitwuzla_term_manager_new();
+        this->session = bitwuzla_new(this->sessionTermMgr, this->sessionOptions);
+
+        this->sessionAst.reset(new(std::nothrow) triton::ast::TritonToBitwuzla());
+        if (this->sessionAst == nullptr) {
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::initSession(): Not enough memory.");
+        }
+
+        // The parameters outlive every check of the session.
+        bitwuzla_set_termination_callback(this->session, this->terminateCallback, reinterpret_cast<void*>(&this->sessionParams));
+      }
+
+
+      void BitwuzlaSolver::pushScope(void) {
+        this->initSession();
+        bitwuzla_push(this->session, 1);
+        this->sessionScopes++;
+      }
+
+
+      void BitwuzlaSolver::popScope(void) {
+        if (this->sessionScopes == 0) {
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::popScope(): No scope to pop.");
+        }
+
+        bitwuzla_pop(this->session, 1);
+        this->sessionScopes--;
+      }
+
+
+      void BitwuzlaSolver::assertConstraint(const triton::ast::SharedAbstractNode& node) {
+        if (node == nullptr) {
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::assertConstraint(): Node cannot be null.");
+        }
+
+        if (node->isLogical() == false) {
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::assertConstraint(): Must be a logical node.");
+        }
+
+        this->initSession();
+        bitwuzla_assert(this->session, this->sessionAst->convert(node, this->session));
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> BitwuzlaSolver::checkWithAssumption(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        std::unordered_map<triton::usize, SolverModel> model;
+        std::vector<BitwuzlaTerm> assumptions;
+
+        if (node != nullptr && node->isLogical() == false) {
+          throw triton::exceptions::SolverEngine("BitwuzlaSolver::checkWithAssumption(): Must be a logical node.");
+        }
+
+        this->initSession();
+
+        QueryStats stats(this);
+
+        // Assumptions only hold for this check.
+        if (node != nullptr) {
+          auto translation = std::chrono::steady_clock::now();
+          assumptions.push_back(this->sessionAst->convert(node, this->session));
+          stats.translation = elapsed(translation);
+          stats.nodes = this->sessionAst->getTranslatedCount();
+        }
+
+        // Set solving params.
+        this->sessionParams = SolverParams(timeout != 0 ? timeout : this->timeout, this->memoryLimit);
+
+        // Get time of solving start.
+        auto start = std::chrono::system_clock::now();
+
+        // Check result.
+        auto res = bitwuzla_check_sat_assuming(this->session, assumptions.size(), assumptions.data());
+
+        // Get time of solving end.
+        auto end = std::chrono::system_clock::now();
+        stats.check = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        if (solvingTime)
+          *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+        // Write back status.
+        if (status) {
+          switch (res) {
+            case BITWUZLA_SAT:
+              *status = triton::engines::solver::SAT;
+              break;
+            case BITWUZLA_UNSAT:
+              *status = triton::engines::solver::UNSAT;
+              break;
+            case BITWUZLA_UNKNOWN:
+              *status = this->sessionParams.status;
+              break;
+          }
+        }
+
+        // Parse model.
+        if (res == BITWUZLA_SAT) {
+          auto extraction = std::chrono::steady_clock::now();
+          for (const auto& it : this->sessionAst->getVariables()) {
+            const char* svalue = bitwuzla_term_value_get_str_fmt(bitwuzla_get_value(this->session, it.first), 2);
+            auto numeral = std::chrono::steady_clock::now();
+            auto value = this->fromBvalueToUint512(svalue);
+            stats.numeral += elapsed(numeral);
+            auto m = SolverModel(it.second, value);
+            model[m.getId()] = m;
+          }
+          stats.model = elapsed(extraction) - stats.numeral;
+        }
+
+        return model;
+      }
+
+
+      void BitwuzlaSolver::resetSession(void) {
+        if (this->session == nullptr) {
+          return;
+        }
+
+        this->sessionAst.reset();
+        bitwuzla_delete(this->session);
+        bitwuzla_term_manager_delete(this->sessionTermMgr);
+        bitwuzla_options_delete(this->sessionOptions);
+
+        this->session = nullptr;
+        this->sessionTermMgr = nullptr;
+        this->sessionOptions = nullptr;
+        this->sessionScopes = 0;
+      }
+
+
+      triton::usize BitwuzlaSolver::getSessionSize(void) const {
+        size_t size = 0;
+
+        if (this->session == nullptr) {
+          return 0;
+        }
+
+        bitwuzla_get_assertions(this->session, &size);
+        return size;
+      }
+
+
       std::string BitwuzlaSolver::getName(void) const {
         return "Bitwuzla";
       }
 
 
+      triton::engines::solver::SolverStats BitwuzlaSolver::getStats(void) const {
+        std::lock_guard<std::mutex> lock(this->statsLock);
+        return this->stats;
+      }
+
+
       void BitwuzlaSolver::setTimeout(triton::uint32 ms) {
         this->timeout = ms;
       }
@@ -261,6 +548,12 @@ namespace triton {
         this->memoryLimit = limit;
       }
 
+
+      void BitwuzlaSolver::interrupt(bool enable) {
+        this->interrupted = enable;
+      }
+
+
       triton::uint512 BitwuzlaSolver::fromBvalueToUint512(const char* value) const {
         triton::usize   len = strlen(value);
         triton::usize   pos = 0;
@@ -0,0 +1,833 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <set>
+#include <stack>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/localSearchSolver.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Returns the microseconds elapsed since `start` */
+      static triton::uint64 elapsed(const std::chrono::steady_clock::time_point& start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+      }
+
+
+      /* Returns the mask of `size` bits */
+      static triton::uint64 maskOf(triton::uint32 size) {
+        return (size >= 64) ? 0xffffffffffffffff : ((static_cast<triton::uint64>(1) << size) - 1);
+      }
+
+
+      /* Sign-extends a value of `size` bits */
+      static triton::sint64 toSigned(triton::uint64 value, triton::uint32 size) {
+        triton::uint64 sign = static_cast<triton::uint64>(1) << (size - 1);
+        return static_cast<triton::sint64>(((value & maskOf(size)) ^ sign) - sign);
+      }
+
+
+      /* Adds two distances, saturating instead of wrapping */
+      static triton::uint64 saturate(triton::uint64 a, triton::uint64 b) {
+        return (a > std::numeric_limits<triton::uint64>::max() - b) ? std::numeric_limits<triton::uint64>::max() : a + b;
+      }
+
+
+      /* The SMT-LIB semantics of the unsigned and signed divisions, a division by zero being defined */
+      static triton::uint64 udiv(triton::uint64 a, triton::uint64 b, triton::uint32 size) {
+        return b ? a / b : maskOf(size);
+      }
+
+
+      static triton::uint64 urem(triton::uint64 a, triton::uint64 b) {
+        return b ? a % b : a;
+      }
+
+
+      static triton::uint64 sdiv(triton::uint64 a, triton::uint64 b, triton::uint32 size) {
+        triton::uint64 mask = maskOf(size);
+        triton::uint64 sign = static_cast<triton::uint64>(1) << (size - 1);
+        bool na = (a & sign) != 0;
+        bool nb = (b & sign) != 0;
+        triton::uint64 r = udiv(na ? (-a & mask) : a, nb ? (-b & mask) : b, size);
+        return (na != nb) ? (-r & mask) : r;
+      }
+
+
+      static triton::uint64 srem(triton::uint64 a, triton::uint64 b, triton::uint32 size) {
+        triton::uint64 mask = maskOf(size);
+        triton::uint64 sign = static_cast<triton::uint64>(1) << (size - 1);
+        bool na = (a & sign) != 0;
+        bool nb = (b & sign) != 0;
+        triton::uint64 r = urem(na ? (-a & mask) : a, nb ? (-b & mask) : b);
+        return na ? (-r & mask) : r;
+      }
+
+
+      static triton::uint64 smod(triton::uint64 a, triton::uint64 b, triton::uint32 size) {
+        triton::uint64 mask = maskOf(size);
+        triton::uint64 sign = static_cast<triton::uint64>(1) << (size - 1);
+        bool na = (a & sign) != 0;
+        bool nb = (b & sign) != 0;
+        triton::uint64 r = urem(na ? (-a & mask) : a, nb ? (-b & mask) : b);
+        if (r == 0 || na == nb)
+          return na ? (-r & mask) : r;
+        return ((na ? -r : r) + b) & mask;
+      }
+
+
+      /* The distance from `a` to satisfy `a < b`, or `a <= b` if not `strict` */
+      static triton::uint64 below(triton::uint64 a, triton::uint64 b, bool strict) {
+        if (strict)
+          return (a < b) ? 0 : saturate(a - b, 1);
+        return (a <= b) ? 0 : a - b;
+      }
+
+
+      /* An operation of a compiled query, its result being the value of its slot */
+      struct SearchOperation {
+        //! The operator, BV_NODE for constants.
+        triton::ast::ast_e type;
+
+        //! The size of the result.
+        triton::uint32 size;
+
+        //! The low bit of an extraction, or the rotation.
+        triton::uint32 arg;
+
+        //! The slots of the operands.
+        std::vector<triton::uint32> operands;
+      };
+
+
+      /* A variable of a compiled query */
+      struct SearchVariable {
+        //! The symbolic variable.
+        triton::engines::symbolic::SharedSymbolicVariable variable;
+
+        //! The slot holding its value.
+        triton::uint32 slot;
+
+        //! The size of the variable.
+        triton::uint32 size;
+      };
+
+
+      /* A conjunct of a compiled query */
+      struct SearchClause {
+        //! The slot of the conjunct.
+        triton::uint32 slot;
+
+        //! The variables read by the conjunct.
+        std::vector<triton::uint32> variables;
+      };
+
+
+      /* A query compiled to a flat program, operations being ordered after their operands */
+      class SearchProgram {
+        public:
+          //! The operations.
+          std::vector<SearchOperation> code;
+
+          //! The value of each operation.
+          std::vector<triton::uint64> values;
+
+          //! The variables of the query.
+          std::vector<SearchVariable> variables;
+
+          //! The conjuncts of the query.
+          std::vector<SearchClause> clauses;
+
+          //! The constants of the query, tried as values of the variables.
+          std::vector<triton::uint64> dictionary;
+
+          //! True if a conjunct is false whatever the variables.
+          bool unsat;
+
+          //! Constructor.
+          SearchProgram() : unsat(false) {}
+
+          //! Compiles a query. Returns false if it cannot be evaluated on 64-bit values.
+          bool compile(const triton::ast::SharedAbstractNode& node);
+
+          //! Evaluates the operations with the current values of the variables.
+          void run(void);
+
+          //! Returns the distance to make a logical slot `expected`, 0 if it already is.
+          triton::uint64 distance(triton::uint32 slot, bool expected) const;
+
+        private:
+          //! Appends the operation of a node whose operands are compiled. Returns false if it is not supported.
+          bool emit(const triton::ast::SharedAbstractNode& node, std::unordered_map<const triton::ast::AbstractNode*, triton::uint32>& slots);
+
+          //! Splits the query into its conjuncts and finds their variables.
+          void split(const triton::ast::SharedAbstractNode& node, const std::unordered_map<const triton::ast::AbstractNode*, triton::uint32>& slots);
+      };
+
+
+      bool SearchProgram::compile(const triton::ast::SharedAbstractNode& root) {
+        std::unordered_map<const triton::ast::AbstractNode*, triton::uint32> slots;
+        std::stack<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
+        auto node = (root->getType() == triton::ast::ASSERT_NODE) ? root->getChildren()[0] : root;
+
+        worklist.push({node, false});
+        while (!worklist.empty()) {
+          triton::ast::SharedAbstractNode n;
+          bool postOrder;
+          std::tie(n, postOrder) = worklist.top();
+          worklist.pop();
+
+          if (slots.find(n.get()) != slots.end())
+            continue;
+
+          if (postOrder) {
+            if (!this->emit(n, slots))
+              return false;
+            continue;
+          }
+
+          worklist.push({n, true});
+
+          /* Sub-trees without symbolic variables are constants */
+          if (!n->isSymbolized())
+            continue;
+
+          /* References are unrolled */
+          if (n->getType() == triton::ast::REFERENCE_NODE)
+            worklist.push({reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst(), false});
+
+          for (const auto& child : n->getChildren()) {
+            if (child->getType() != triton::ast::INTEGER_NODE && slots.find(child.get()) == slots.end())
+              worklist.push({child, false});
+          }
+        }
+
+        std::sort(this->dictionary.begin(), this->dictionary.end());
+        this->dictionary.erase(std::unique(this->dictionary.begin(), this->dictionary.end()), this->dictionary.end());
+
+        this->run();
+        this->split(node, slots);
+
+        return true;
+      }
+
+
+      bool SearchProgram::emit(const triton::ast::SharedAbstractNode& node, std::unordered_map<const triton::ast::AbstractNode*, triton::uint32>& slots) {
+        const auto& children = node->getChildren();
+        triton::uint32 size = node->getBitvectorSize();
+        SearchOperation op = {node->getType(), size, 0, {}};
+        triton::uint64 value = 0;
+
+        if (node->isArray() || size == 0 || size > 64)
+          return false;
+
+        if (!node->isSymbolized()) {
+          op.type = triton::ast::BV_NODE;
+          value = static_cast<triton::uint64>(node->evaluate());
+          if (size > 1)
+            this->dictionary.push_back(value);
+        }
+
+        else {
+          switch (node->getType()) {
+            case triton::ast::REFERENCE_NODE:
+              slots[node.get()] = slots.at(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst().get());
+              return true;
+
+            case triton::ast::VARIABLE_NODE:
+              value = static_cast<triton::uint64>(node->evaluate());
+              this->variables.push_back({reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable(), static_cast<triton::uint32>(this->code.size()), size});
+              break;
+
+            case triton::ast::EXTRACT_NODE:
+              op.arg = triton::ast::getInteger<triton::uint32>(children[1]);
+              op.operands.push_back(slots.at(children[2].get()));
+              break;
+
+            case triton::ast::SX_NODE:
+            case triton::ast::ZX_NODE:
+              op.operands.push_back(slots.at(children[1].get()));
+              break;
+
+            case triton::ast::BVROL_NODE:
+            case triton::ast::BVROR_NODE:
+              op.arg = triton::ast::getInteger<triton::uint32>(children[1]) % size;
+              op.operands.push_back(slots.at(children[0].get()));
+              break;
+
+            case triton::ast::BSWAP_NODE:
+            case triton::ast::BVADD_NODE:
+            case triton::ast::BVAND_NODE:
+            case triton::ast::BVASHR_NODE:
+            case triton::ast::BVLSHR_NODE:
+            case triton::ast::BVMUL_NODE:
+            case triton::ast::BVNAND_NODE:
+            case triton::ast::BVNEG_NODE:
+            case triton::ast::BVNOR_NODE:
+            case triton::ast::BVNOT_NODE:
+            case triton::ast::BVOR_NODE:
+            case triton::ast::BVSDIV_NODE:
+            case triton::ast::BVSGE_NODE:
+            case triton::ast::BVSGT_NODE:
+            case triton::ast::BVSHL_NODE:
+            case triton::ast::BVSLE_NODE:
+            case triton::ast::BVSLT_NODE:
+            case triton::ast::BVSMOD_NODE:
+            case triton::ast::BVSREM_NODE:
+            case triton::ast::BVSUB_NODE:
+            case triton::ast::BVUDIV_NODE:
+            case triton::ast::BVUGE_NODE:
+            case triton::ast::BVUGT_NODE:
+            case triton::ast::BVULE_NODE:
+            case triton::ast::BVULT_NODE:
+            case triton::ast::BVUREM_NODE:
+            case triton::ast::BVXNOR_NODE:
+            case triton::ast::BVXOR_NODE:
+            case triton::ast::CONCAT_NODE:
+            case triton::ast::DISTINCT_NODE:
+            case triton::ast::EQUAL_NODE:
+            case triton::ast::IFF_NODE:
+            case triton::ast::ITE_NODE:
+            case triton::ast::LAND_NODE:
+            case triton::ast::LNOT_NODE:
+            case triton::ast::LOR_NODE:
+            case triton::ast::LXOR_NODE:
+              for (const auto& child : children)
+                op.operands.push_back(slots.at(child.get()));
+              break;
+
+            /* Arrays, quantifiers and let bindings are not supported */
+            default:
+              return false;
+          }
+        }
+
+        slots[node.get()] = static_cast<triton::uint32>(this->code.size());
+        this->code.push_back(op);
+        this->values.push_back(value);
+
+        return true;
+      }
+
+
+      void SearchProgram::split(const triton::ast::SharedAbstractNode& node, const std::unordered_map<const triton::ast::AbstractNode*, triton::uint32>& slots) {
+        std::vector<triton::sint32> variableOf(this->code.size(), -1);
+        std::vector<triton::usize> visited(this->code.size(), 0);
+        std::stack<triton::ast::SharedAbstractNode> conjuncts;
+        triton::usize stamp = 0;
+
+        for (triton::usize i = 0; i < this->variables.size(); i++)
+          variableOf[this->variables[i].slot] = static_cast<triton::sint32>(i);
+
+        conjuncts.push(node);
+        while (!conjuncts.empty()) {
+          auto n = conjuncts.top();
+          conjuncts.pop();
+
+          if (n->getType() == triton::ast::REFERENCE_NODE) {
+            conjuncts.push(reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst());
+            continue;
+          }
+
+          if (n->getType() == triton::ast::LAND_NODE && n->isSymbolized()) {
+            for (const auto& child : n->getChildren())
+              conjuncts.push(child);
+            continue;
+          }
+
+          SearchClause clause = {slots.at(n.get()), {}};
+          std::stack<triton::uint32> operations;
+          stamp++;
+
+          /* The variables read by the conjunct are the ones its moves mutate */
+          operations.push(clause.slot);
+          while (!operations.empty()) {
+            triton::uint32 slot = operations.top();
+            operations.pop();
+
+            if (visited[slot] == stamp)
+              continue;
+            visited[slot] = stamp;
+
+            if (variableOf[slot] >= 0)
+              clause.variables.push_back(variableOf[slot]);
+
+            for (triton::uint32 operand : this->code[slot].operands)
+              operations.push(operand);
+          }
+
+          /* A conjunct without variables is constant */
+          if (clause.variables.empty()) {
+            this->unsat |= (this->values[clause.slot] == 0);
+            continue;
+          }
+
+          this->clauses.push_back(clause);
+        }
+      }
+
+
+      void SearchProgram::run(void) {
+        for (triton::usize i = 0; i < this->code.size(); i++) {
+          const SearchOperation& op = this->code[i];
+          const auto& o = op.operands;
+          const auto& v = this->values;
+          triton::uint64 mask = maskOf(op.size);
+          triton::uint64 r = 0;
+
+          switch (op.type) {
+            /* Constants and variables are set once */
+            case triton::ast::BV_NODE:
+            case triton::ast::VARIABLE_NODE:
+              continue;
+
+            case triton::ast::BVADD_NODE:   r = v[o[0]] + v[o[1]]; break;
+            case triton::ast::BVSUB_NODE:   r = v[o[0]] - v[o[1]]; break;
+            case triton::ast::BVMUL_NODE:   r = v[o[0]] * v[o[1]]; break;
+            case triton::ast::BVAND_NODE:   r = v[o[0]] & v[o[1]]; break;
+            case triton::ast::BVOR_NODE:    r = v[o[0]] | v[o[1]]; break;
+            case triton::ast::BVXOR_NODE:   r = v[o[0]] ^ v[o[1]]; break;
+            case triton::ast::BVNAND_NODE:  r = ~(v[o[0]] & v[o[1]]); break;
+            case triton::ast::BVNOR_NODE:   r = ~(v[o[0]] | v[o[1]]); break;
+            case triton::ast::BVXNOR_NODE:  r = ~(v[o[0]] ^ v[o[1]]); break;
+            case triton::ast::BVNOT_NODE:   r = ~v[o[0]]; break;
+            case triton::ast::BVNEG_NODE:   r = -v[o[0]]; break;
+            case triton::ast::BVUDIV_NODE:  r = udiv(v[o[0]], v[o[1]], op.size); break;
+            case triton::ast::BVUREM_NODE:  r = urem(v[o[0]], v[o[1]]); break;
+            case triton::ast::BVSDIV_NODE:  r = sdiv(v[o[0]], v[o[1]], op.size); break;
+            case triton::ast::BVSREM_NODE:  r = srem(v[o[0]], v[o[1]], op.size); break;
+            case triton::ast::BVSMOD_NODE:  r = smod(v[o[0]], v[o[1]], op.size); break;
+            case triton::ast::BVSHL_NODE:   r = (v[o[1]] >= op.size) ? 0 : v[o[0]] << v[o[1]]; break;
+            case triton::ast::BVLSHR_NODE:  r = (v[o[1]] >= op.size) ? 0 : v[o[0]] >> v[o[1]]; break;
+            case triton::ast::BVASHR_NODE:  r = toSigned(v[o[0]], op.size) >> std::min<triton::uint64>(v[o[1]], op.size - 1); break;
+            case triton::ast::BVROL_NODE:   r = op.arg ? (v[o[0]] << op.arg) | (v[o[0]] >> (op.size - op.arg)) : v[o[0]]; break;
+            case triton::ast::BVROR_NODE:   r = op.arg ? (v[o[0]] >> op.arg) | (v[o[0]] << (op.size - op.arg)) : v[o[0]]; break;
+            case triton::ast::EXTRACT_NODE: r = v[o[0]] >> op.arg; break;
+            case triton::ast::ZX_NODE:      r = v[o[0]]; break;
+            case triton::ast::SX_NODE:      r = toSigned(v[o[0]], this->code[o[0]].size); break;
+            case triton::ast::ITE_NODE:     r = v[o[0]] ? v[o[1]] : v[o[2]]; break;
+            case triton::ast::EQUAL_NODE:   r = (v[o[0]] == v[o[1]]); break;
+            case triton::ast::IFF_NODE:     r = (v[o[0]] == v[o[1]]); break;
+            case triton::ast::DISTINCT_NODE:r = (v[o[0]] != v[o[1]]); break;
+            case triton::ast::LNOT_NODE:    r = !v[o[0]]; break;
+            case triton::ast::BVULT_NODE:   r = v[o[0]] <  v[o[1]]; break;
+            case triton::ast::BVULE_NODE:   r = v[o[0]] <= v[o[1]]; break;
+            case triton::ast::BVUGT_NODE:   r = v[o[0]] >  v[o[1]]; break;
+            case triton::ast::BVUGE_NODE:   r = v[o[0]] >= v[o[1]]; break;
+            case triton::ast::BVSLT_NODE:   r = toSigned(v[o[0]], this->code[o[0]].size) <  toSigned(v[o[1]], this->code[o[1]].size); break;
+            case triton::ast::BVSLE_NODE:   r = toSigned(v[o[0]], this->code[o[0]].size) <= toSigned(v[o[1]], this->code[o[1]].size); break;
+            case triton::ast::BVSGT_NODE:   r = toSigned(v[o[0]], this->code[o[0]].size) >  toSigned(v[o[1]], this->code[o[1]].size); break;
+            case triton::ast::BVSGE_NODE:   r = toSigned(v[o[0]], this->code[o[0]].size) >= toSigned(v[o[1]], this->code[o[1]].size); break;
+
+            case triton::ast::BSWAP_NODE:
+              for (triton::uint32 byte = 0; byte < op.size / 8; byte++)
+                r = (r << 8) | ((v[o[0]] >> (byte * 8)) & 0xff);
+              break;
+
+            case triton::ast::CONCAT_NODE:
+              for (triton::uint32 operand : o) {
+                triton::uint32 shift = this->code[operand].size;
+                r = ((shift < 64) ? (r << shift) : 0) | v[operand];
+              }
+              break;
+
+            case triton::ast::LAND_NODE:
+              r = 1;
+              for (triton::uint32 operand : o)
+                r &= (v[operand] != 0);
+              break;
+
+            case triton::ast::LOR_NODE:
+              for (triton::uint32 operand : o)
+                r |= (v[operand] != 0);
+              break;
+
+            case triton::ast::LXOR_NODE:
+              for (triton::uint32 operand : o)
+                r ^= (v[operand] != 0);
+              break;
+
+            default:
+              break;
+          }
+
+          this->values[i] = r & mask;
+        }
+      }
+
+
+      triton::uint64 SearchProgram::distance(triton::uint32 slot, bool expected) const {
+        const SearchOperation& op = this->code[slot];
+        const auto& o = op.operands;
+        triton::uint64 a = 0;
+        triton::uint64 b = 0;
+
+        switch (op.type) {
+          case triton::ast::LNOT_NODE:
+            return this->distance(o[0], !expected);
+
+          /* A conjunction is as far as the sum of its operands, a disjunction as its closest operand */
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE: {
+            bool conjunction = ((op.type == triton::ast::LAND_NODE) == expected);
+            triton::uint64 d = conjunction ? 0 : std::numeric_limits<triton::uint64>::max();
+            for (triton::uint32 operand : o) {
+              triton::uint64 x = this->distance(operand, expected);
+              d = conjunction ? saturate(d, x) : std::min(d, x);
+            }
+            return d;
+          }
+
+          case triton::ast::EQUAL_NODE:
+          case triton::ast::DISTINCT_NODE:
+            a = this->values[o[0]];
+            b = this->values[o[1]];
+            if ((op.type == triton::ast::EQUAL_NODE) == expected)
+              return std::min((a - b) & maskOf(this->code[o[0]].size), (b - a) & maskOf(this->code[o[0]].size));
+            return (a != b) ? 0 : 1;
+
+          case triton::ast::BVSGE_NODE:
+          case triton::ast::BVSGT_NODE:
+          case triton::ast::BVSLE_NODE:
+          case triton::ast::BVSLT_NODE:
+          case triton::ast::BVUGE_NODE:
+          case triton::ast::BVUGT_NODE:
+          case triton::ast::BVULE_NODE:
+          case triton::ast::BVULT_NODE: {
+            a = this->values[o[0]];
+            b = this->values[o[1]];
+
+            /* Signed values are biased to compare as unsigned ones */
+            if (op.type == triton::ast::BVSGE_NODE || op.type == triton::ast::BVSGT_NODE || op.type == triton::ast::BVSLE_NODE || op.type == triton::ast::BVSLT_NODE) {
+              triton::uint64 sign = static_cast<triton::uint64>(1) << (this->code[o[0]].size - 1);
+              a ^= sign;
+              b ^= sign;
+            }
+
+            /* !(a < b) is b <= a */
+            switch (op.type) {
+              case triton::ast::BVULT_NODE:
+              case triton::ast::BVSLT_NODE: return expected ? below(a, b, true) : below(b, a, false);
+              case triton::ast::BVULE_NODE:
+              case triton::ast::BVSLE_NODE: return expected ? below(a, b, false) : below(b, a, true);
+              case triton::ast::BVUGT_NODE:
+              case triton::ast::BVSGT_NODE: return expected ? below(b, a, true) : below(a, b, false);
+              default:                      return expected ? below(b, a, false) : below(a, b, true);
+            }
+          }
+
+          default:
+            return ((this->values[slot] != 0) == expected) ? 0 : 1;
+        }
+      }
+
+
+      /* The counters of a query, published to the solver when the query ends */
+      class LocalSearchSolver::QueryStats : public triton::engines::solver::SolverStats {
+        private:
+          const LocalSearchSolver* solver;
+
+        public:
+          QueryStats(const LocalSearchSolver* solver) : solver(solver) {
+            this->queries = 1;
+          }
+
+          ~QueryStats() {
+            std::lock_guard<std::mutex> lock(this->solver->statsLock);
+            this->solver->stats = *this;
+          }
+      };
+
+
+      LocalSearchSolver::LocalSearchSolver() {
+        this->timeout = 0;
+        this->memoryLimit = 0;
+        this->seed = 0;
+        this->interrupted = false;
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> LocalSearchSolver::search(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+        std::set<std::vector<triton::uint64>> found;
+        std::vector<triton::uint32> keys;
+        std::mt19937_64 rng(this->seed);
+        SearchProgram program;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("LocalSearchSolver::search(): node cannot be null.");
+
+        if (node->isLogical() == false)
+          throw triton::exceptions::SolverEngine("LocalSearchSolver::search(): Must be a logical node.");
+
+        QueryStats stats(this);
+
+        if (status)
+          *status = triton::engines::solver::UNKNOWN;
+
+        if (solvingTime)
+          *solvingTime = 0;
+
+        auto translation = std::chrono::steady_clock::now();
+        bool supported = program.compile(node);
+        stats.translation = elapsed(translation);
+        stats.nodes = program.code.size();
+
+        if (!supported || limit == 0)
+          return ret;
+
+        if (program.unsat) {
+          if (status)
+            *status = triton::engines::solver::UNSAT;
+          return ret;
+        }
+
+        /* Models differ on the projected variables, all variables by default */
+        for (triton::uint32 i = 0; i < program.variables.size(); i++) {
+          if (projection.empty() || std::any_of(projection.begin(), projection.end(), [&](const triton::engines::symbolic::SharedSymbolicVariable& var) { return var->getId() == program.variables[i].variable->getId(); }))
+            keys.push_back(i);
+        }
+
+        std::vector<triton::uint64> distances(program.clauses.size(), 0);
+        auto key = [&]() {
+          std::vector<triton::uint64> k;
+          for (triton::uint32 i : keys)
+            k.push_back(program.values[program.variables[i].slot]);
+          return k;
+        };
+
+        auto cost = [&]() {
+          triton::uint64 total = 0;
+          program.run();
+          for (triton::usize i = 0; i < program.clauses.size(); i++) {
+            distances[i] = program.distance(program.clauses[i].slot, true);
+            total = saturate(total, distances[i]);
+          }
+          /* A model already found is blocked */
+          if (total == 0 && found.find(key()) != found.end())
+            total = 1;
+          return total;
+        };
+
+        triton::uint32 ms = timeout ? timeout : (this->timeout ? this->timeout : LocalSearchSolver::defaultTimeout);
+        auto start = std::chrono::steady_clock::now();
+        auto deadline = start + std::chrono::milliseconds(ms);
+        triton::uint64 best = cost();
+        triton::usize stall = 0;
+        std::vector<triton::uint32> unsatisfied;
+
+        for (triton::usize step = 1; ret.size() < limit; step++) {
+          if (best == 0) {
+            std::unordered_map<triton::usize, SolverModel> model;
+
+            if (projection.empty()) {
+              for (const auto& var : program.variables)
+                model[var.variable->getId()] = SolverModel(var.variable, program.values[var.slot]);
+            }
+            else {
+              /* A projected variable missing from the query is unconstrained, any value fits */
+              for (const auto& var : projection)
+                model[var->getId()] = SolverModel(var, 0);
+              for (triton::uint32 i : keys)
+                model[program.variables[i].variable->getId()] = SolverModel(program.variables[i].variable, program.values[program.variables[i].slot]);
+            }
+
+            ret.push_back(model);
+            found.insert(key());
+
+            if (keys.empty())
+              break;
+
+            best = cost();
+            continue;
+          }
+
+          if ((step & 0xff) == 0 && (this->interrupted || std::chrono::steady_clock::now() >= deadline))
+            break;
+
+          /* Mutates a variable of an unsatisfied conjunct, a projected one if only the blocking fails */
+          unsatisfied.clear();
+          for (triton::uint32 i = 0; i < program.clauses.size(); i++) {
+            if (distances[i])
+              unsatisfied.push_back(i);
+          }
+
+          const auto& candidates = unsatisfied.empty() ? keys : program.clauses[unsatisfied[rng() % unsatisfied.size()]].variables;
+          const SearchVariable& var = program.variables[candidates[rng() % candidates.size()]];
+          triton::uint64 mask = maskOf(var.size);
+          triton::uint64 old = program.values[var.slot];
+          triton::uint64 before = best;
+          triton::uint64 delta = 0;
+          triton::uint64& value = program.values[var.slot];
+
+          switch (rng() % 6) {
+            case 0:
+              value ^= static_cast<triton::uint64>(1) << (rng() % var.size);
+              break;
+
+            case 1:
+              delta = 1 + rng() % 16;
+              break;
+
+            case 2:
+              delta = static_cast<triton::uint64>(1) << (rng() % var.size);
+              break;
+
+            case 3:
+              value = rng();
+              break;
+
+            /* Input bytes are often compared one at a time */
+            case 4: {
+              triton::uint32 shift = (rng() % ((var.size + 7) / 8)) * 8;
+              value = (value & ~(static_cast<triton::uint64>(0xff) << shift)) | ((rng() & 0xff) << shift);
+              break;
+            }
+
+            /* Constants of the query and their neighbors */
+            default:
+              value = program.dictionary.empty() ? rng() : program.dictionary[rng() % program.dictionary.size()] + (rng() % 3) - 1;
+              break;
+          }
+
+          if (delta && (rng() & 1))
+            delta = -delta;
+
+          value = (value + delta) & mask;
+
+          triton::uint64 current = cost();
+          if (current > best) {
+            value = old;
+            cost();
+            stall++;
+          }
+          else {
+            /* A step getting closer is doubled while it still does */
+            while (delta && current < best && current) {
+              best = current;
+              old = value;
+              delta <<= 1;
+              value = (value + delta) & mask;
+              current = cost();
+            }
+
+            if (current > best) {
+              value = old;
+              current = cost();
+            }
+
+            stall = (current < before) ? 0 : stall + 1;
+            best = current;
+          }
+
+          /* Restarts the variables of the unsatisfied conjuncts from random values */
+          if (stall > 1000 + 100 * program.variables.size()) {
+            for (triton::uint32 i : unsatisfied) {
+              for (triton::uint32 v : program.clauses[i].variables)
+                program.values[program.variables[v].slot] = rng() & maskOf(program.variables[v].size);
+            }
+            best = cost();
+            stall = 0;
+          }
+        }
+
+        stats.check = elapsed(start);
+
+        if (solvingTime)
+          *solvingTime = static_cast<triton::uint32>(stats.check / 1000);
+
+        if (status && !ret.empty())
+          *status = triton::engines::solver::SAT;
+
+        return ret;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> LocalSearchSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::unordered_map<triton::usize, SolverModel> ret;
+        std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+
+        models = this->search(node, {}, 1, status, timeout, solvingTime);
+        if (models.size() > 0)
+          ret = models.front();
+
+        return ret;
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> LocalSearchSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->search(node, {}, limit, status, timeout, solvingTime);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> LocalSearchSolver::getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->search(node, projection, limit, status, timeout, solvingTime);
+      }
+
+
+      bool LocalSearchSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        this->search(node, {}, 1, &st, timeout, solvingTime);
+        if (status)
+          *status = st;
+
+        return (st == triton::engines::solver::SAT);
+      }
+
+
+      std::string LocalSearchSolver::getName(void) const {
+        return "local search";
+      }
+
+
+      triton::engines::solver::SolverStats LocalSearchSolver::getStats(void) const {
+        std::lock_guard<std::mutex> lock(this->statsLock);
+        return this->stats;
+      }
+
+
+      void LocalSearchSolver::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+      }
+
+
+      void LocalSearchSolver::setMemoryLimit(triton::uint32 mem) {
+        this->memoryLimit = mem;
+      }
+
+
+      void LocalSearchSolver::setSeed(triton::uint32 seed) {
+        this->seed = seed;
+      }
+
+
+      void LocalSearchSolver::interrupt(bool enable) {
+        this->interrupted = enable;
+      }
+
+    };
+  };
+};
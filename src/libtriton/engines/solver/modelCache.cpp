@@ -0,0 +1,275 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/modelCache.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Two's complement value of a bitvector */
+      static triton::sint512 signExtend(const triton::uint512& value, triton::uint32 size) {
+        triton::sint512 signedValue = 0;
+
+        if ((value >> (size - 1)) & 1) {
+          signedValue = -1;
+          signedValue = ((signedValue << size) | static_cast<triton::sint512>(value));
+        }
+        else {
+          signedValue = static_cast<triton::sint512>(value);
+        }
+
+        return signedValue;
+      }
+
+
+      ModelCache::ModelCache(triton::usize capacity) {
+        this->capacity = capacity;
+      }
+
+
+      bool ModelCache::evaluate(const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::unordered_map<triton::usize, triton::uint512>& values, triton::uint512& result) {
+        std::unordered_map<const triton::ast::AbstractNode*, triton::uint512> evals;
+
+        for (const auto& node : nodes) {
+          const auto& children = node->getChildren();
+          triton::uint32 size  = node->getBitvectorSize();
+          triton::uint512 mask = node->getBitvectorMask();
+          triton::uint512 a    = 0;
+          triton::uint512 b    = 0;
+          triton::uint512 r    = 0;
+
+          if (children.size() > 0) a = evals.at(children[0].get());
+          if (children.size() > 1) b = evals.at(children[1].get());
+
+          switch (node->getType()) {
+            case triton::ast::ASSERT_NODE:  r = a; break;
+            case triton::ast::BV_NODE:      r = node->evaluate(); break;
+            case triton::ast::INTEGER_NODE: r = reinterpret_cast<triton::ast::IntegerNode*>(node.get())->getInteger(); break;
+            case triton::ast::STRING_NODE:  r = 0; break;
+
+            case triton::ast::REFERENCE_NODE:
+              r = evals.at(reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst().get());
+              break;
+
+            case triton::ast::VARIABLE_NODE: {
+              auto it = values.find(reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable()->getId());
+              r = (it != values.end()) ? (it->second & mask) : node->evaluate();
+              break;
+            }
+
+            case triton::ast::BVADD_NODE:  r = (a + b) & mask; break;
+            case triton::ast::BVSUB_NODE:  r = (a - b) & mask; break;
+            case triton::ast::BVMUL_NODE:  r = (a * b) & mask; break;
+            case triton::ast::BVAND_NODE:  r = a & b; break;
+            case triton::ast::BVOR_NODE:   r = a | b; break;
+            case triton::ast::BVXOR_NODE:  r = a ^ b; break;
+            case triton::ast::BVNAND_NODE: r = ~(a & b) & mask; break;
+            case triton::ast::BVNOR_NODE:  r = ~(a | b) & mask; break;
+            case triton::ast::BVXNOR_NODE: r = ~(a ^ b) & mask; break;
+            case triton::ast::BVNOT_NODE:  r = ~a & mask; break;
+            case triton::ast::BVNEG_NODE:  r = (~a + 1) & mask; break;
+            case triton::ast::BVSHL_NODE:  r = (b >= size) ? 0 : ((a << static_cast<triton::uint32>(b)) & mask); break;
+            case triton::ast::BVLSHR_NODE: r = (b >= size) ? 0 : (a >> static_cast<triton::uint32>(b)); break;
+
+            case triton::ast::BVASHR_NODE: {
+              bool sign = ((a >> (size - 1)) & 1) != 0;
+              if (b >= size)
+                r = sign ? mask : 0;
+              else {
+                r = a >> static_cast<triton::uint32>(b);
+                if (sign)
+                  r |= mask & ~(mask >> static_cast<triton::uint32>(b));
+              }
+              break;
+            }
+
+            case triton::ast::BVROL_NODE: {
+              triton::uint32 rot = static_cast<triton::uint32>(b % size);
+              r = ((a << rot) | (a >> (size - rot))) & mask;
+              break;
+            }
+
+            case triton::ast::BVROR_NODE: {
+              triton::uint32 rot = static_cast<triton::uint32>(b % size);
+              r = ((a >> rot) | (a << (size - rot))) & mask;
+              break;
+            }
+
+            case triton::ast::BVUDIV_NODE: r = (b == 0) ? mask : (a / b); break;
+            case triton::ast::BVUREM_NODE: r = (b == 0) ? a : (a % b); break;
+
+            case triton::ast::BVSDIV_NODE:
+            case triton::ast::BVSREM_NODE:
+            case triton::ast::BVSMOD_NODE: {
+              triton::sint512 sa = signExtend(a, size);
+              triton::sint512 sb = signExtend(b, size);
+              if (node->getType() == triton::ast::BVSDIV_NODE)
+                r = (b == 0) ? (sa < 0 ? 1 : mask) : (static_cast<triton::uint512>(sa / sb) & mask);
+              else if (node->getType() == triton::ast::BVSREM_NODE)
+                r = (b == 0) ? a : (static_cast<triton::uint512>(sa - ((sa / sb) * sb)) & mask);
+              else
+                r = (b == 0) ? a : (static_cast<triton::uint512>(((sa % sb) + sb) % sb) & mask);
+              break;
+            }
+
+            case triton::ast::BVSGE_NODE: r = signExtend(a, children[0]->getBitvectorSize()) >= signExtend(b, children[0]->getBitvectorSize()); break;
+            case triton::ast::BVSGT_NODE: r = signExtend(a, children[0]->getBitvectorSize()) >  signExtend(b, children[0]->getBitvectorSize()); break;
+            case triton::ast::BVSLE_NODE: r = signExtend(a, children[0]->getBitvectorSize()) <= signExtend(b, children[0]->getBitvectorSize()); break;
+            case triton::ast::BVSLT_NODE: r = signExtend(a, children[0]->getBitvectorSize()) <  signExtend(b, children[0]->getBitvectorSize()); break;
+            case triton::ast::BVUGE_NODE: r = a >= b; break;
+            case triton::ast::BVUGT_NODE: r = a >  b; break;
+            case triton::ast::BVULE_NODE: r = a <= b; break;
+            case triton::ast::BVULT_NODE: r = a <  b; break;
+
+            case triton::ast::EQUAL_NODE:    r = (a == b); break;
+            case triton::ast::DISTINCT_NODE: r = (a != b); break;
+            case triton::ast::IFF_NODE:      r = ((a != 0) == (b != 0)); break;
+            case triton::ast::LNOT_NODE:     r = (a == 0); break;
+            case triton::ast::ITE_NODE:      r = a ? b : evals.at(children[2].get()); break;
+
+            case triton::ast::LAND_NODE:
+            case triton::ast::LOR_NODE:
+            case triton::ast::LXOR_NODE: {
+              bool land = true, lor = false, lxor = false;
+              for (const auto& child : children) {
+                bool value = evals.at(child.get()) != 0;
+                land &= value;
+                lor  |= value;
+                lxor ^= value;
+              }
+              r = (node->getType() == triton::ast::LAND_NODE) ? land : (node->getType() == triton::ast::LOR_NODE) ? lor : lxor;
+              break;
+            }
+
+            case triton::ast::CONCAT_NODE:
+              for (const auto& child : children)
+                r = (r << child->getBitvectorSize()) | evals.at(child.get());
+              break;
+
+            case triton::ast::EXTRACT_NODE:
+              r = (evals.at(children[2].get()) >> static_cast<triton::uint32>(b)) & mask;
+              break;
+
+            case triton::ast::ZX_NODE:
+              r = evals.at(children[1].get());
+              break;
+
+            case triton::ast::SX_NODE:
+              r = static_cast<triton::uint512>(signExtend(evals.at(children[1].get()), children[1]->getBitvectorSize())) & mask;
+              break;
+
+            case triton::ast::BSWAP_NODE:
+              r = a & 0xff;
+              for (triton::uint32 index = triton::bitsize::byte; index != size; index += triton::bitsize::byte) {
+                r <<= triton::bitsize::byte;
+                r |= ((a >> index) & 0xff);
+              }
+              break;
+
+            /* Arrays, floating-point and binders are left to the solver */
+            default:
+              return false;
+          }
+
+          evals[node.get()] = r;
+        }
+
+        result = evals.at(nodes.back().get());
+        return true;
+      }
+
+
+      bool ModelCache::lookup(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>* model) {
+        std::unordered_map<triton::usize, triton::uint512> concrete;
+        auto nodes = triton::ast::childrenExtraction(node, true /* unroll*/, true /* revert */);
+        auto candidate = this->models.end();
+        triton::uint512 result = 0;
+
+        /* The concrete values come first, they are already evaluated */
+        if (node->evaluate() != 0) {
+          this->stats.concrete++;
+        }
+        else {
+          for (auto it = this->models.begin(); it != this->models.end(); it++) {
+            if (!this->evaluate(nodes, *it, result))
+              break;
+            if (result != 0) {
+              candidate = it;
+              break;
+            }
+          }
+
+          if (candidate == this->models.end()) {
+            this->stats.misses++;
+            return false;
+          }
+
+          this->models.splice(this->models.begin(), this->models, candidate);
+          this->stats.hits++;
+        }
+
+        if (model) {
+          model->clear();
+          for (const auto& n : nodes) {
+            if (n->getType() != triton::ast::VARIABLE_NODE)
+              continue;
+            const auto& var = reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable();
+            triton::uint512 value = n->evaluate();
+            if (candidate != this->models.end()) {
+              auto it = candidate->find(var->getId());
+              if (it != candidate->end())
+                value = it->second & n->getBitvectorMask();
+            }
+            (*model)[var->getId()] = SolverModel(var, value);
+          }
+        }
+
+        return true;
+      }
+
+
+      void ModelCache::insert(const std::unordered_map<triton::usize, SolverModel>& model) {
+        std::unordered_map<triton::usize, triton::uint512> values;
+
+        if (this->capacity == 0 || model.empty())
+          return;
+
+        for (const auto& m : model)
+          values[m.first] = m.second.getValue();
+
+        this->models.push_front(values);
+        if (this->models.size() > this->capacity)
+          this->models.pop_back();
+      }
+
+
+      void ModelCache::clear(void) {
+        this->models.clear();
+      }
+
+
+      triton::usize ModelCache::size(void) const {
+        return this->models.size();
+      }
+
+
+      const triton::engines::solver::ModelCacheStats& ModelCache::getStats(void) const {
+        return this->stats;
+      }
+
+
+      void ModelCache::clearStats(void) {
+        this->stats = triton::engines::solver::ModelCacheStats();
+      }
+
+    };
+  };
+};
@@ -0,0 +1,1224 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/config.hpp>
+#include <triton/processPoolSolver.hpp>
+
+#if !defined(_WIN32) && (defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE))
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <stack>
+#include <thread>
+#include <tuple>
+#include <unordered_set>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+  #include <sys/prctl.h>
+  #include <sys/syscall.h>
+#endif
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/modes.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+#ifdef TRITON_Z3_INTERFACE
+  #include <triton/z3Solver.hpp>
+#endif
+
+#ifdef TRITON_BITWUZLA_INTERFACE
+  #include <triton/bitwuzlaSolver.hpp>
+#endif
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /*! \class ProcessPoolWorker
+          \brief A worker process of the pool and its socket. */
+      class ProcessPoolWorker {
+        public:
+          //! The process id, 0 if the worker is not running.
+          pid_t pid;
+
+          //! The socket connected to the worker, -1 if it is not running.
+          int fd;
+
+          //! True while a query is sent to the worker.
+          bool busy;
+
+          //! The counters of the worker.
+          SolverWorkerStats stats;
+
+          //! Constructor.
+          ProcessPoolWorker() : pid(0), fd(-1), busy(false) {}
+      };
+
+
+      /*! \class ProcessPoolReader
+          \brief Reads the integers of a message. */
+      class ProcessPoolReader {
+        private:
+          //! The message.
+          const std::string& message;
+
+          //! The offset of the next integer.
+          triton::usize cursor;
+
+        public:
+          //! Constructor.
+          ProcessPoolReader(const std::string& message) : message(message), cursor(0) {}
+
+          //! Reads a little-endian integer of `bytes` bytes.
+          triton::uint64 get(triton::uint32 bytes) {
+            triton::uint64 value = 0;
+
+            if (this->cursor + bytes > this->message.size())
+              throw triton::exceptions::SolverEngine("ProcessPoolSolver: Truncated message.");
+
+            for (triton::uint32 i = 0; i < bytes; i++)
+              value |= static_cast<triton::uint64>(static_cast<triton::uint8>(this->message[this->cursor + i])) << (i * 8);
+
+            this->cursor += bytes;
+            return value;
+          }
+
+          //! Reads a 512-bit integer.
+          triton::uint512 get512(void) {
+            triton::uint512 value = 0;
+            triton::uint64 words[8];
+
+            for (triton::uint32 i = 0; i < 8; i++)
+              words[i] = this->get(8);
+
+            for (triton::uint32 i = 8; i > 0; i--)
+              value = (value << 64) | triton::uint512(words[i - 1]);
+
+            return value;
+          }
+
+          //! Reads a string of `size` bytes.
+          std::string getString(triton::usize size) {
+            if (this->cursor + size > this->message.size())
+              throw triton::exceptions::SolverEngine("ProcessPoolSolver: Truncated message.");
+            this->cursor += size;
+            return this->message.substr(this->cursor - size, size);
+          }
+      };
+
+
+      /*! \class ProcessPoolSolver::Pool
+          \brief The workers of a ProcessPoolSolver and their settings. */
+      class ProcessPoolSolver::Pool {
+        public:
+          //! The workers.
+          std::vector<ProcessPoolWorker> workers;
+
+          //! Guards the workers.
+          std::mutex lock;
+
+          //! Notified when a worker gets idle.
+          std::condition_variable idle;
+
+          //! The solver run by the workers.
+          triton::engines::solver::solver_e backend;
+
+          //! The default timeout of the queries (in milliseconds).
+          std::atomic<triton::uint32> timeout;
+
+          //! The memory limit of the workers (in megabytes).
+          std::atomic<triton::uint32> memoryLimit;
+
+          //! True if the queries are interrupted.
+          std::atomic<bool> interrupted;
+
+          //! The process forking the workers.
+          pid_t spawner;
+
+          //! The socket connected to the spawner. Guarded by `lock`.
+          int control;
+
+          //! The time given to a query without timeout before its worker is killed (in milliseconds).
+          static constexpr triton::uint32 deadline = 10 * 60 * 1000;
+
+          //! The time given to the spawner to answer (in milliseconds).
+          static constexpr triton::uint32 spawnerDeadline = 10 * 1000;
+
+          //! Constructor. Forks the spawner.
+          Pool(triton::engines::solver::solver_e backend);
+
+          //! Destructor. Stops the workers and the spawner.
+          ~Pool();
+
+          //! Forks a worker through the spawner. Called with the lock held.
+          void spawn(ProcessPoolWorker& worker);
+
+          //! Kills a worker and returns its wait status, given by the spawner. Called with the lock held.
+          int stop(ProcessPoolWorker& worker);
+      };
+
+
+      /* Appends a little-endian integer of `bytes` bytes to a message */
+      static void putInteger(std::string& message, triton::uint64 value, triton::uint32 bytes) {
+        for (triton::uint32 i = 0; i < bytes; i++)
+          message.push_back(static_cast<char>((value >> (i * 8)) & 0xff));
+      }
+
+
+      /* Appends a 512-bit integer to a message */
+      static void putInteger512(std::string& message, const triton::uint512& value) {
+        for (triton::uint32 i = 0; i < 8; i++)
+          putInteger(message, static_cast<triton::uint64>((value >> (i * 64)) & 0xffffffffffffffff), 8);
+      }
+
+
+      /* Sends a message prefixed by its size. Returns false if the peer is gone */
+      static bool sendMessage(int fd, const std::string& payload) {
+        std::string message;
+        triton::usize offset = 0;
+
+        putInteger(message, payload.size(), 4);
+        message += payload;
+
+        while (offset < message.size()) {
+          #if defined(MSG_NOSIGNAL)
+          ssize_t n = send(fd, message.data() + offset, message.size() - offset, MSG_NOSIGNAL);
+          #else
+          ssize_t n = send(fd, message.data() + offset, message.size() - offset, 0);
+          #endif
+          if (n < 0 && errno == EINTR)
+            continue;
+          if (n <= 0)
+            return false;
+          offset += n;
+        }
+
+        return true;
+      }
+
+
+      /* Receives `size` bytes before the deadline (none if null). Returns false on timeout or if the peer is gone */
+      static bool receiveBytes(int fd, char* buffer, triton::usize size, const std::chrono::steady_clock::time_point* deadline) {
+        triton::usize offset = 0;
+
+        while (offset < size) {
+          if (deadline) {
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(*deadline - std::chrono::steady_clock::now()).count();
+            struct pollfd pfd = {fd, POLLIN, 0};
+            if (left <= 0)
+              return false;
+            int ready = poll(&pfd, 1, static_cast<int>(std::min<long long>(left, 1000)));
+            if (ready < 0 && errno != EINTR)
+              return false;
+            if (ready <= 0)
+              continue;
+          }
+
+          ssize_t n = recv(fd, buffer + offset, size - offset, 0);
+          if (n < 0 && errno == EINTR)
+            continue;
+          if (n <= 0)
+            return false;
+          offset += n;
+        }
+
+        return true;
+      }
+
+
+      /* Receives a message prefixed by its size */
+      static bool receiveMessage(int fd, std::string& payload, const std::chrono::steady_clock::time_point* deadline) {
+        char header[4];
+
+        if (!receiveBytes(fd, header, sizeof(header), deadline))
+          return false;
+
+        payload.resize(ProcessPoolReader(std::string(header, sizeof(header))).get(4));
+        if (payload.empty())
+          return true;
+
+        return receiveBytes(fd, &payload[0], payload.size(), deadline);
+      }
+
+
+      /* Sends a descriptor over a unix socket. Returns false if the peer is gone */
+      static bool sendDescriptor(int fd, int descriptor) {
+        union {
+          struct cmsghdr header;
+          char buffer[CMSG_SPACE(sizeof(int))];
+        } control;
+        struct msghdr message;
+        struct iovec iov;
+        char byte = 0;
+
+        std::memset(&control, 0, sizeof(control));
+        std::memset(&message, 0, sizeof(message));
+        iov.iov_base = &byte;
+        iov.iov_len = 1;
+        message.msg_iov = &iov;
+        message.msg_iovlen = 1;
+        message.msg_control = control.buffer;
+        message.msg_controllen = sizeof(control.buffer);
+
+        struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+        header->cmsg_level = SOL_SOCKET;
+        header->cmsg_type = SCM_RIGHTS;
+        header->cmsg_len = CMSG_LEN(sizeof(int));
+        std::memcpy(CMSG_DATA(header), &descriptor, sizeof(int));
+
+        while (true) {
+          #if defined(MSG_NOSIGNAL)
+          ssize_t n = sendmsg(fd, &message, MSG_NOSIGNAL);
+          #else
+          ssize_t n = sendmsg(fd, &message, 0);
+          #endif
+          if (n < 0 && errno == EINTR)
+            continue;
+          return (n == 1);
+        }
+      }
+
+
+      /* Receives a descriptor sent by sendDescriptor(), closed on exec. Returns -1 if the peer is gone */
+      static int receiveDescriptor(int fd) {
+        union {
+          struct cmsghdr header;
+          char buffer[CMSG_SPACE(sizeof(int))];
+        } control;
+        struct msghdr message;
+        struct iovec iov;
+        char byte = 0;
+        int descriptor = -1;
+        ssize_t n = 0;
+
+        std::memset(&control, 0, sizeof(control));
+        std::memset(&message, 0, sizeof(message));
+        iov.iov_base = &byte;
+        iov.iov_len = 1;
+        message.msg_iov = &iov;
+        message.msg_iovlen = 1;
+        message.msg_control = control.buffer;
+        message.msg_controllen = sizeof(control.buffer);
+
+        do {
+          #if defined(MSG_CMSG_CLOEXEC)
+          n = recvmsg(fd, &message, MSG_CMSG_CLOEXEC);
+          #else
+          n = recvmsg(fd, &message, 0);
+          #endif
+        } while (n < 0 && errno == EINTR);
+
+        struct cmsghdr* header = CMSG_FIRSTHDR(&message);
+        if (n != 1 || header == nullptr || header->cmsg_level != SOL_SOCKET || header->cmsg_type != SCM_RIGHTS)
+          return -1;
+
+        std::memcpy(&descriptor, CMSG_DATA(header), sizeof(int));
+        fcntl(descriptor, F_SETFD, FD_CLOEXEC);
+
+        return descriptor;
+      }
+
+
+      /* Serializes the DAG of a query in post-order. Sub-trees without symbolic variables are sent as their value */
+      static void serializeNodes(std::string& message, const triton::ast::SharedAbstractNode& root, std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& variables) {
+        std::unordered_map<const triton::ast::AbstractNode*, triton::uint32> indexes;
+        std::stack<std::pair<triton::ast::SharedAbstractNode, bool>> worklist;
+        std::string body;
+        triton::uint32 count = 0;
+
+        worklist.push({root, false});
+        while (!worklist.empty()) {
+          triton::ast::SharedAbstractNode node;
+          bool postOrder;
+          std::tie(node, postOrder) = worklist.top();
+          worklist.pop();
+
+          if (indexes.find(node.get()) != indexes.end())
+            continue;
+
+          bool value = !node->isSymbolized() && !node->isLogical() && !node->isArray() && node->getBitvectorSize() && node->getType() != triton::ast::INTEGER_NODE;
+          const triton::ast::SharedAbstractNode& ast = (node->getType() == triton::ast::REFERENCE_NODE) ? reinterpret_cast<triton::ast::ReferenceNode*>(node.get())->getSymbolicExpression()->getAst() : node;
+
+          if (!postOrder) {
+            worklist.push({node, true});
+            if (value)
+              continue;
+            if (node->getType() == triton::ast::REFERENCE_NODE)
+              worklist.push({ast, false});
+            else {
+              for (const auto& child : node->getChildren())
+                worklist.push({child, false});
+            }
+            continue;
+          }
+
+          /* References are unrolled */
+          if (!value && node->getType() == triton::ast::REFERENCE_NODE) {
+            indexes[node.get()] = indexes.at(ast.get());
+            continue;
+          }
+
+          if (value) {
+            putInteger(body, triton::ast::BV_NODE, 4);
+            putInteger(body, 0, 4);
+            putInteger512(body, node->evaluate());
+            putInteger(body, node->getBitvectorSize(), 4);
+            indexes[node.get()] = count++;
+            continue;
+          }
+
+          switch (node->getType()) {
+            case triton::ast::ARRAY_NODE:
+            case triton::ast::ASSERT_NODE:
+            case triton::ast::BSWAP_NODE:
+            case triton::ast::BVADD_NODE:
+            case triton::ast::BVAND_NODE:
+            case triton::ast::BVASHR_NODE:
+            case triton::ast::BVLSHR_NODE:
+            case triton::ast::BVMUL_NODE:
+            case triton::ast::BVNAND_NODE:
+            case triton::ast::BVNEG_NODE:
+            case triton::ast::BVNOR_NODE:
+            case triton::ast::BVNOT_NODE:
+            case triton::ast::BVOR_NODE:
+            case triton::ast::BVROL_NODE:
+            case triton::ast::BVROR_NODE:
+            case triton::ast::BVSDIV_NODE:
+            case triton::ast::BVSGE_NODE:
+            case triton::ast::BVSGT_NODE:
+            case triton::ast::BVSHL_NODE:
+            case triton::ast::BVSLE_NODE:
+            case triton::ast::BVSLT_NODE:
+            case triton::ast::BVSMOD_NODE:
+            case triton::ast::BVSREM_NODE:
+            case triton::ast::BVSUB_NODE:
+            case triton::ast::BVUDIV_NODE:
+            case triton::ast::BVUGE_NODE:
+            case triton::ast::BVUGT_NODE:
+            case triton::ast::BVULE_NODE:
+            case triton::ast::BVULT_NODE:
+            case triton::ast::BVUREM_NODE:
+            case triton::ast::BVXNOR_NODE:
+            case triton::ast::BVXOR_NODE:
+            case triton::ast::CONCAT_NODE:
+            case triton::ast::DISTINCT_NODE:
+            case triton::ast::EQUAL_NODE:
+            case triton::ast::EXTRACT_NODE:
+            case triton::ast::IFF_NODE:
+            case triton::ast::ITE_NODE:
+            case triton::ast::LAND_NODE:
+            case triton::ast::LNOT_NODE:
+            case triton::ast::LOR_NODE:
+            case triton::ast::LXOR_NODE:
+            case triton::ast::SELECT_NODE:
+            case triton::ast::STORE_NODE:
+            case triton::ast::SX_NODE:
+            case triton::ast::ZX_NODE:
+              putInteger(body, node->getType(), 4);
+              putInteger(body, node->getChildren().size(), 4);
+              for (const auto& child : node->getChildren())
+                putInteger(body, indexes.at(child.get()), 4);
+              break;
+
+            case triton::ast::INTEGER_NODE:
+              putInteger(body, node->getType(), 4);
+              putInteger(body, 0, 4);
+              putInteger512(body, triton::ast::getInteger<triton::uint512>(node));
+              break;
+
+            case triton::ast::VARIABLE_NODE: {
+              const auto& var = reinterpret_cast<triton::ast::VariableNode*>(node.get())->getSymbolicVariable();
+              variables[var->getId()] = var;
+              putInteger(body, node->getType(), 4);
+              putInteger(body, 0, 4);
+              putInteger(body, var->getId(), 8);
+              putInteger(body, var->getSize(), 4);
+              break;
+            }
+
+            default:
+              throw triton::exceptions::SolverEngine("ProcessPoolSolver::query(): Unsupported node.");
+          }
+
+          indexes[node.get()] = count++;
+        }
+
+        putInteger(message, count, 4);
+        message += body;
+        putInteger(message, indexes.at(root.get()), 4);
+      }
+
+
+      /* Rebuilds the DAG of a query in the context of a worker */
+      static triton::ast::SharedAbstractNode deserializeNodes(ProcessPoolReader& reader, triton::ast::AstContext& ast, std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable>& variables) {
+        std::vector<triton::ast::SharedAbstractNode> nodes;
+        triton::uint32 count = static_cast<triton::uint32>(reader.get(4));
+
+        for (triton::uint32 n = 0; n < count; n++) {
+          auto type = static_cast<triton::ast::ast_e>(reader.get(4));
+          std::vector<triton::ast::SharedAbstractNode> c(reader.get(4));
+
+          for (auto& child : c) {
+            triton::uint32 index = static_cast<triton::uint32>(reader.get(4));
+            if (index >= nodes.size())
+              throw triton::exceptions::SolverEngine("ProcessPoolSolver: Invalid node index.");
+            child = nodes[index];
+          }
+
+          auto integer = [&](triton::usize i) {
+            if (i >= c.size() || c[i]->getType() != triton::ast::INTEGER_NODE)
+              throw triton::exceptions::SolverEngine("ProcessPoolSolver: Invalid node operands.");
+            return triton::ast::getInteger<triton::uint32>(c[i]);
+          };
+
+          auto arity = [&](triton::usize size) {
+            if (c.size() != size)
+              throw triton::exceptions::SolverEngine("ProcessPoolSolver: Invalid node operands.");
+          };
+
+          switch (type) {
+            case triton::ast::ARRAY_NODE:    nodes.push_back(ast.array(integer(0))); break;
+            case triton::ast::ASSERT_NODE:   arity(1); nodes.push_back(ast.assert_(c[0])); break;
+            case triton::ast::BSWAP_NODE:    arity(1); nodes.push_back(ast.bswap(c[0])); break;
+            case triton::ast::BVADD_NODE:    arity(2); nodes.push_back(ast.bvadd(c[0], c[1])); break;
+            case triton::ast::BVAND_NODE:    arity(2); nodes.push_back(ast.bvand(c[0], c[1])); break;
+            case triton::ast::BVASHR_NODE:   arity(2); nodes.push_back(ast.bvashr(c[0], c[1])); break;
+            case triton::ast::BVLSHR_NODE:   arity(2); nodes.push_back(ast.bvlshr(c[0], c[1])); break;
+            case triton::ast::BVMUL_NODE:    arity(2); nodes.push_back(ast.bvmul(c[0], c[1])); break;
+            case triton::ast::BVNAND_NODE:   arity(2); nodes.push_back(ast.bvnand(c[0], c[1])); break;
+            case triton::ast::BVNEG_NODE:    arity(1); nodes.push_back(ast.bvneg(c[0])); break;
+            case triton::ast::BVNOR_NODE:    arity(2); nodes.push_back(ast.bvnor(c[0], c[1])); break;
+            case triton::ast::BVNOT_NODE:    arity(1); nodes.push_back(ast.bvnot(c[0])); break;
+            case triton::ast::BVOR_NODE:     arity(2); nodes.push_back(ast.bvor(c[0], c[1])); break;
+            case triton::ast::BVROL_NODE:    arity(2); nodes.push_back(ast.bvrol(c[0], integer(1))); break;
+            case triton::ast::BVROR_NODE:    arity(2); nodes.push_back(ast.bvror(c[0], integer(1))); break;
+            case triton::ast::BVSDIV_NODE:   arity(2); nodes.push_back(ast.bvsdiv(c[0], c[1])); break;
+            case triton::ast::BVSGE_NODE:    arity(2); nodes.push_back(ast.bvsge(c[0], c[1])); break;
+            case triton::ast::BVSGT_NODE:    arity(2); nodes.push_back(ast.bvsgt(c[0], c[1])); break;
+            case triton::ast::BVSHL_NODE:    arity(2); nodes.push_back(ast.bvshl(c[0], c[1])); break;
+            case triton::ast::BVSLE_NODE:    arity(2); nodes.push_back(ast.bvsle(c[0], c[1])); break;
+            case triton::ast::BVSLT_NODE:    arity(2); nodes.push_back(ast.bvslt(c[0], c[1])); break;
+            case triton::ast::BVSMOD_NODE:   arity(2); nodes.push_back(ast.bvsmod(c[0], c[1])); break;
+            case triton::ast::BVSREM_NODE:   arity(2); nodes.push_back(ast.bvsrem(c[0], c[1])); break;
+            case triton::ast::BVSUB_NODE:    arity(2); nodes.push_back(ast.bvsub(c[0], c[1])); break;
+            case triton::ast::BVUDIV_NODE:   arity(2); nodes.push_back(ast.bvudiv(c[0], c[1])); break;
+            case triton::ast::BVUGE_NODE:    arity(2); nodes.push_back(ast.bvuge(c[0], c[1])); break;
+            case triton::ast::BVUGT_NODE:    arity(2); nodes.push_back(ast.bvugt(c[0], c[1])); break;
+            case triton::ast::BVULE_NODE:    arity(2); nodes.push_back(ast.bvule(c[0], c[1])); break;
+            case triton::ast::BVULT_NODE:    arity(2); nodes.push_back(ast.bvult(c[0], c[1])); break;
+            case triton::ast::BVUREM_NODE:   arity(2); nodes.push_back(ast.bvurem(c[0], c[1])); break;
+            case triton::ast::BVXNOR_NODE:   arity(2); nodes.push_back(ast.bvxnor(c[0], c[1])); break;
+            case triton::ast::BVXOR_NODE:    arity(2); nodes.push_back(ast.bvxor(c[0], c[1])); break;
+            case triton::ast::CONCAT_NODE:   nodes.push_back(ast.concat(c)); break;
+            case triton::ast::DISTINCT_NODE: arity(2); nodes.push_back(ast.distinct(c[0], c[1])); break;
+            case triton::ast::EQUAL_NODE:    arity(2); nodes.push_back(ast.equal(c[0], c[1])); break;
+            case triton::ast::EXTRACT_NODE:  arity(3); nodes.push_back(ast.extract(integer(0), integer(1), c[2])); break;
+            case triton::ast::IFF_NODE:      arity(2); nodes.push_back(ast.iff(c[0], c[1])); break;
+            case triton::ast::ITE_NODE:      arity(3); nodes.push_back(ast.ite(c[0], c[1], c[2])); break;
+            case triton::ast::LAND_NODE:     nodes.push_back(ast.land(c)); break;
+            case triton::ast::LNOT_NODE:     arity(1); nodes.push_back(ast.lnot(c[0])); break;
+            case triton::ast::LOR_NODE:      nodes.push_back(ast.lor(c)); break;
+            case triton::ast::LXOR_NODE:     nodes.push_back(ast.lxor(c)); break;
+            case triton::ast::SELECT_NODE:   arity(2); nodes.push_back(ast.select(c[0], c[1])); break;
+            case triton::ast::STORE_NODE:    arity(3); nodes.push_back(ast.store(c[0], c[1], c[2])); break;
+            case triton::ast::SX_NODE:       arity(2); nodes.push_back(ast.sx(integer(0), c[1])); break;
+            case triton::ast::ZX_NODE:       arity(2); nodes.push_back(ast.zx(integer(0), c[1])); break;
+
+            case triton::ast::BV_NODE: {
+              triton::uint512 value = reader.get512();
+              nodes.push_back(ast.bv(value, static_cast<triton::uint32>(reader.get(4))));
+              break;
+            }
+
+            case triton::ast::INTEGER_NODE:
+              nodes.push_back(ast.integer(reader.get512()));
+              break;
+
+            case triton::ast::VARIABLE_NODE: {
+              triton::usize id = static_cast<triton::usize>(reader.get(8));
+              triton::uint32 size = static_cast<triton::uint32>(reader.get(4));
+              auto& var = variables[id];
+              if (var == nullptr)
+                var = std::make_shared<triton::engines::symbolic::SymbolicVariable>(triton::engines::symbolic::UNDEFINED_VARIABLE, 0, id, size, "");
+              nodes.push_back(ast.variable(var));
+              break;
+            }
+
+            default:
+              throw triton::exceptions::SolverEngine("ProcessPoolSolver: Unsupported node.");
+          }
+        }
+
+        triton::uint32 root = static_cast<triton::uint32>(reader.get(4));
+        if (root >= nodes.size())
+          throw triton::exceptions::SolverEngine("ProcessPoolSolver: Invalid node index.");
+
+        return nodes[root];
+      }
+
+
+      /* Lowers the soft limits of the worker for the next query. The hard limits stay, so that the next query may raise them again */
+      static void setWorkerLimits(triton::uint32 timeout, triton::uint32 memoryLimit) {
+        struct rlimit limit;
+
+        if (getrlimit(RLIMIT_AS, &limit) == 0) {
+          limit.rlim_cur = limit.rlim_max;
+          if (memoryLimit) {
+            /* The limit comes on top of the address space inherited from the analysis process */
+            std::ifstream statm("/proc/self/statm");
+            rlim_t pages = 0;
+            if (statm >> pages) {
+              rlim_t bytes = pages * sysconf(_SC_PAGESIZE) + static_cast<rlim_t>(memoryLimit) * 1024 * 1024;
+              if (limit.rlim_max == RLIM_INFINITY || bytes < limit.rlim_max)
+                limit.rlim_cur = bytes;
+            }
+          }
+          setrlimit(RLIMIT_AS, &limit);
+        }
+
+        if (getrlimit(RLIMIT_CPU, &limit) == 0) {
+          limit.rlim_cur = limit.rlim_max;
+          if (timeout) {
+            struct rusage usage;
+            if (getrusage(RUSAGE_SELF, &usage) == 0) {
+              rlim_t seconds = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (timeout + 999) / 1000 + 1;
+              if (limit.rlim_max == RLIM_INFINITY || seconds < limit.rlim_max)
+                limit.rlim_cur = seconds;
+            }
+          }
+          setrlimit(RLIMIT_CPU, &limit);
+        }
+      }
+
+
+      /* The loop of a worker: solves the queries until the analysis process closes the socket */
+      static void serveQueries(int fd, triton::engines::solver::solver_e backend) {
+        std::unique_ptr<triton::engines::solver::SolverInterface> solver;
+        std::string request;
+
+        #ifdef TRITON_Z3_INTERFACE
+        if (backend == triton::engines::solver::SOLVER_Z3)
+          solver.reset(new(std::nothrow) triton::engines::solver::Z3Solver());
+        #endif
+
+        #ifdef TRITON_BITWUZLA_INTERFACE
+        if (backend == triton::engines::solver::SOLVER_BITWUZLA)
+          solver.reset(new(std::nothrow) triton::engines::solver::BitwuzlaSolver());
+        #endif
+
+        while (receiveMessage(fd, request, nullptr)) {
+          std::string response;
+
+          try {
+            std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> variables;
+            std::vector<triton::engines::symbolic::SharedSymbolicVariable> projection;
+            std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+            triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+            triton::uint32 solvingTime = 0;
+            ProcessPoolReader reader(request);
+
+            if (solver == nullptr)
+              throw triton::exceptions::SolverEngine("ProcessPoolSolver: Not enough memory.");
+
+            /* Each query gets a fresh context, the nodes of the previous ones are released */
+            auto ast = std::make_shared<triton::ast::AstContext>(std::make_shared<triton::modes::Modes>());
+            triton::uint32 limit = static_cast<triton::uint32>(reader.get(4));
+            triton::uint32 timeout = static_cast<triton::uint32>(reader.get(4));
+            triton::uint32 memoryLimit = static_cast<triton::uint32>(reader.get(4));
+
+            for (triton::uint32 n = static_cast<triton::uint32>(reader.get(4)); n > 0; n--) {
+              triton::usize id = static_cast<triton::usize>(reader.get(8));
+              triton::uint32 size = static_cast<triton::uint32>(reader.get(4));
+              auto& var = variables[id];
+              if (var == nullptr)
+                var = std::make_shared<triton::engines::symbolic::SymbolicVariable>(triton::engines::symbolic::UNDEFINED_VARIABLE, 0, id, size, "");
+              projection.push_back(var);
+            }
+
+            auto node = deserializeNodes(reader, *ast, variables);
+
+            setWorkerLimits(timeout, memoryLimit);
+            solver->setMemoryLimit(memoryLimit);
+
+            try {
+              if (limit)
+                models = solver->getModels(node, projection, limit, &status, timeout, &solvingTime);
+              else
+                solver->isSat(node, &status, timeout, &solvingTime);
+            }
+            catch (const std::bad_alloc&) {
+              /* The address space limit is reached */
+              models.clear();
+              status = triton::engines::solver::OUTOFMEM;
+            }
+
+            auto stats = solver->getStats();
+            putInteger(response, 0, 4);
+            putInteger(response, status, 4);
+            putInteger(response, solvingTime, 4);
+            putInteger(response, stats.queries, 8);
+            putInteger(response, stats.nodes, 8);
+            putInteger(response, stats.translation, 8);
+            putInteger(response, stats.check, 8);
+            putInteger(response, stats.model, 8);
+            putInteger(response, stats.numeral, 8);
+            putInteger(response, stats.decided, 8);
+            putInteger(response, models.size(), 4);
+            for (const auto& model : models) {
+              putInteger(response, model.size(), 4);
+              for (const auto& item : model) {
+                putInteger(response, item.first, 8);
+                putInteger512(response, item.second.getValue());
+              }
+            }
+          }
+          catch (const std::exception& e) {
+            response.clear();
+            putInteger(response, 1, 4);
+            response += e.what();
+          }
+
+          if (!sendMessage(fd, response))
+            break;
+        }
+      }
+
+
+      /* The requests of the pool to the spawner */
+      enum spawner_e {
+        SPAWN_WORKER, /* Forks a worker, answered by its pid then its socket */
+        REAP_WORKER,  /* Waits for a killed worker, answered by its wait status */
+      };
+
+
+      /* Keeps `fd` as descriptor 3 and the standard streams on /dev/null, and closes the descriptors inherited from the analysis process */
+      static int keepDescriptor(int fd) {
+        int kept = fcntl(fd, F_DUPFD, 3);
+        int null = open("/dev/null", O_RDWR);
+
+        if (kept == -1)
+          _exit(1);
+
+        if (null != -1) {
+          for (int stream = 0; stream < 3; stream++)
+            dup2(null, stream);
+        }
+
+        if (kept != 3) {
+          dup2(kept, 3);
+          kept = 3;
+        }
+
+        #if defined(__linux__) && defined(SYS_close_range)
+        if (syscall(SYS_close_range, 4, ~0U, 0) == 0)
+          return kept;
+        #endif
+
+        struct rlimit limit;
+        int last = 1024;
+        if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY)
+          last = static_cast<int>(std::min<rlim_t>(limit.rlim_cur, 1 << 20));
+        for (int other = 4; other < last; other++)
+          close(other);
+
+        return kept;
+      }
+
+
+      /* The loop of the spawner: forks the workers and reaps them until the analysis process closes the control socket */
+      static void serveSpawns(int control, triton::engines::solver::solver_e backend) {
+        std::unordered_set<pid_t> children;
+        std::string request;
+        pid_t self = getpid();
+
+        while (receiveMessage(control, request, nullptr)) {
+          std::string response;
+          ProcessPoolReader reader(request);
+
+          switch (reader.get(4)) {
+            case SPAWN_WORKER: {
+              int fds[2];
+              pid_t pid = -1;
+
+              if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0) {
+                #if defined(SO_NOSIGPIPE)
+                int enable = 1;
+                setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+                setsockopt(fds[1], SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+                #endif
+
+                pid = fork();
+                if (pid == 0) {
+                  /* The worker only keeps its socket. It exits when the socket is closed or the spawner dies */
+                  #if defined(__linux__)
+                  prctl(PR_SET_PDEATHSIG, SIGKILL);
+                  if (getppid() != self)
+                    _exit(0);
+                  #endif
+                  signal(SIGINT, SIG_DFL);
+                  close(control);
+                  close(fds[0]);
+                  try {
+                    serveQueries(fds[1], backend);
+                  }
+                  catch (...) {
+                  }
+                  _exit(0);
+                }
+                close(fds[1]);
+                if (pid < 0)
+                  close(fds[0]);
+              }
+
+              putInteger(response, static_cast<triton::uint64>(static_cast<triton::sint64>(pid)), 8);
+              if (!sendMessage(control, response))
+                pid = -1;
+              if (pid > 0) {
+                children.insert(pid);
+                bool sent = sendDescriptor(control, fds[0]);
+                close(fds[0]);
+                if (!sent)
+                  break;
+              }
+              continue;
+            }
+
+            case REAP_WORKER: {
+              pid_t pid = static_cast<pid_t>(static_cast<triton::sint64>(reader.get(8)));
+              int wstatus = 0;
+
+              if (children.erase(pid))
+                while (waitpid(pid, &wstatus, 0) == -1 && errno == EINTR);
+
+              putInteger(response, static_cast<triton::uint32>(wstatus), 4);
+              if (!sendMessage(control, response))
+                break;
+              continue;
+            }
+
+            default:
+              break;
+          }
+          break;
+        }
+
+        /* The analysis process is gone, its workers go with it */
+        for (pid_t pid : children) {
+          kill(pid, SIGKILL);
+          while (waitpid(pid, nullptr, 0) == -1 && errno == EINTR);
+        }
+      }
+
+
+      ProcessPoolSolver::Pool::Pool(triton::engines::solver::solver_e backend)
+        : backend(backend), timeout(0), memoryLimit(0), interrupted(false), spawner(0), control(-1) {
+        int fds[2];
+
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+          throw triton::exceptions::SolverEngine("ProcessPoolSolver: Cannot create the socket of the spawner.");
+
+        #if defined(SO_NOSIGPIPE)
+        int enable = 1;
+        setsockopt(fds[0], SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+        #endif
+
+        /*
+         * The workers are forked by a spawner forked here, once, rather than by the threads sending
+         * the queries. Its memory is the one of the analysis process when the pool is created, and it
+         * forks from its single thread, so that workers do not inherit a lock held by another thread.
+         */
+        pid_t pid = fork();
+        if (pid < 0) {
+          close(fds[0]);
+          close(fds[1]);
+          throw triton::exceptions::SolverEngine("ProcessPoolSolver: Cannot fork the spawner.");
+        }
+
+        if (pid == 0) {
+          /* The spawner never returns into the analysis. A Ctrl-C handled by the analysis does not stop it */
+          signal(SIGINT, SIG_IGN);
+          int control = keepDescriptor(fds[1]);
+          try {
+            serveSpawns(control, backend);
+          }
+          catch (...) {
+          }
+          _exit(0);
+        }
+
+        close(fds[1]);
+        fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+        this->control = fds[0];
+        this->spawner = pid;
+      }
+
+
+      ProcessPoolSolver::Pool::~Pool() {
+        /* Workers get an EOF, then the spawner kills and reaps the ones still running */
+        for (auto& worker : this->workers) {
+          if (worker.fd != -1)
+            close(worker.fd);
+          if (worker.pid > 0)
+            kill(worker.pid, SIGKILL);
+        }
+
+        close(this->control);
+        while (waitpid(this->spawner, nullptr, 0) == -1 && errno == EINTR);
+      }
+
+
+      void ProcessPoolSolver::Pool::spawn(ProcessPoolWorker& worker) {
+        auto expiry = std::chrono::steady_clock::now() + std::chrono::milliseconds(Pool::spawnerDeadline);
+        std::string request;
+        std::string response;
+        int fd = -1;
+
+        putInteger(request, SPAWN_WORKER, 4);
+        if (!sendMessage(this->control, request) || !receiveMessage(this->control, response, &expiry))
+          throw triton::exceptions::SolverEngine("ProcessPoolSolver: The spawner is gone.");
+
+        ProcessPoolReader reader(response);
+        pid_t pid = static_cast<pid_t>(static_cast<triton::sint64>(reader.get(8)));
+        if (pid <= 0)
+          throw triton::exceptions::SolverEngine("ProcessPoolSolver: Cannot fork a worker.");
+
+        if ((fd = receiveDescriptor(this->control)) == -1) {
+          kill(pid, SIGKILL);
+          throw triton::exceptions::SolverEngine("ProcessPoolSolver: The spawner is gone.");
+        }
+
+        worker.fd = fd;
+        worker.pid = pid;
+        worker.stats.pid = pid;
+      }
+
+
+      int ProcessPoolSolver::Pool::stop(ProcessPoolWorker& worker) {
+        auto expiry = std::chrono::steady_clock::now() + std::chrono::milliseconds(Pool::spawnerDeadline);
+        std::string response;
+        int wstatus = 0;
+
+        if (worker.fd != -1)
+          close(worker.fd);
+
+        if (worker.pid > 0) {
+          std::string request;
+          kill(worker.pid, SIGKILL);
+          putInteger(request, REAP_WORKER, 4);
+          putInteger(request, static_cast<triton::uint64>(static_cast<triton::sint64>(worker.pid)), 8);
+          if (sendMessage(this->control, request) && receiveMessage(this->control, response, &expiry) && response.size() == 4)
+            wstatus = static_cast<int>(ProcessPoolReader(response).get(4));
+        }
+
+        worker.fd = -1;
+        worker.pid = 0;
+        worker.stats.pid = 0;
+
+        return wstatus;
+      }
+
+
+      ProcessPoolSolver::ProcessPoolSolver(triton::uint32 workers, triton::engines::solver::solver_e backend) {
+        if (backend == triton::engines::solver::SOLVER_INVALID) {
+          #if defined(TRITON_Z3_INTERFACE)
+          backend = triton::engines::solver::SOLVER_Z3;
+          #else
+          backend = triton::engines::solver::SOLVER_BITWUZLA;
+          #endif
+        }
+
+        switch (backend) {
+          #ifdef TRITON_Z3_INTERFACE
+          case triton::engines::solver::SOLVER_Z3:
+          #endif
+          #ifdef TRITON_BITWUZLA_INTERFACE
+          case triton::engines::solver::SOLVER_BITWUZLA:
+          #endif
+            break;
+          default:
+            throw triton::exceptions::SolverEngine("ProcessPoolSolver::ProcessPoolSolver(): The workers only run z3 or Bitwuzla.");
+        }
+
+        this->pool = std::make_shared<Pool>(backend);
+        this->setWorkers(workers);
+      }
+
+
+      ProcessPoolSolver::ProcessPoolSolver(const ProcessPoolSolver& other)
+        : SolverInterface(other) {
+        this->pool = other.pool;
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> ProcessPoolSolver::query(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 memoryLimit = this->pool->memoryLimit;
+        triton::uint32 time = 0;
+        std::string request;
+        std::string response;
+        triton::usize index = 0;
+        bool answered = false;
+        bool expired = false;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("ProcessPoolSolver::query(): node cannot be null.");
+
+        if (timeout == 0)
+          timeout = this->pool->timeout;
+
+        /* Serialize the query before taking a worker */
+        putInteger(request, limit, 4);
+        putInteger(request, timeout, 4);
+        putInteger(request, memoryLimit, 4);
+        putInteger(request, projection.size(), 4);
+        for (const auto& var : projection) {
+          variables[var->getId()] = var;
+          putInteger(request, var->getId(), 8);
+          putInteger(request, var->getSize(), 4);
+        }
+        serializeNodes(request, node, variables);
+
+        this->stats = SolverStats();
+
+        if (this->pool->interrupted) {
+          if (status)
+            *status = triton::engines::solver::UNKNOWN;
+          if (solvingTime)
+            *solvingTime = 0;
+          return ret;
+        }
+
+        /* Take an idle worker, preferably a running one */
+        {
+          std::unique_lock<std::mutex> guard(this->pool->lock);
+          auto& workers = this->pool->workers;
+          this->pool->idle.wait(guard, [&] {
+            return std::any_of(workers.begin(), workers.end(), [](const ProcessPoolWorker& w) { return !w.busy; });
+          });
+          for (index = 0; index < workers.size() && (workers[index].busy || workers[index].pid == 0); index++);
+          if (index == workers.size())
+            for (index = 0; workers[index].busy; index++);
+          if (workers[index].pid == 0)
+            this->pool->spawn(workers[index]);
+          workers[index].busy = true;
+        }
+
+        /* The worker gets a grace period over the timeout to answer, or a default deadline, it is killed afterwards */
+        triton::uint32 grace = timeout ? 1000 : 0;
+        auto start = std::chrono::steady_clock::now();
+        auto deadline = start + std::chrono::milliseconds(timeout ? timeout + grace : Pool::deadline);
+        int fd = this->pool->workers[index].fd;
+
+        if (sendMessage(fd, request) && receiveMessage(fd, response, &deadline)) {
+          try {
+            ProcessPoolReader reader(response);
+            if (reader.get(4) != 0)
+              response = reader.getString(response.size() - 4);
+            else {
+              st = static_cast<triton::engines::solver::status_e>(reader.get(4));
+              time = static_cast<triton::uint32>(reader.get(4));
+              this->stats.queries = reader.get(8);
+              this->stats.nodes = reader.get(8);
+              this->stats.translation = reader.get(8);
+              this->stats.check = reader.get(8);
+              this->stats.model = reader.get(8);
+              this->stats.numeral = reader.get(8);
+              this->stats.decided = reader.get(8);
+              ret.resize(reader.get(4));
+              for (auto& model : ret) {
+                for (triton::uint32 n = static_cast<triton::uint32>(reader.get(4)); n > 0; n--) {
+                  triton::usize id = static_cast<triton::usize>(reader.get(8));
+                  triton::uint512 value = reader.get512();
+                  model[id] = SolverModel(variables.at(id), value);
+                }
+              }
+              response.clear();
+            }
+            answered = true;
+          }
+          catch (const std::exception&) {
+            ret.clear();
+          }
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        expired = std::chrono::steady_clock::now() >= deadline - std::chrono::milliseconds(grace);
+
+        {
+          std::lock_guard<std::mutex> guard(this->pool->lock);
+          auto& worker = this->pool->workers[index];
+
+          /* A worker which crashed, exceeded its limits or did not answer in time is restarted by the next query */
+          if (!answered) {
+            int wstatus = this->pool->stop(worker);
+            worker.stats.crashes++;
+
+            if (expired || (WIFSIGNALED(wstatus) && WTERMSIG(wstatus) == SIGXCPU))
+              st = triton::engines::solver::TIMEOUT;
+            else if (this->pool->interrupted)
+              st = triton::engines::solver::UNKNOWN;
+            else if (memoryLimit)
+              st = triton::engines::solver::OUTOFMEM;
+            else
+              st = triton::engines::solver::UNKNOWN;
+
+            time = static_cast<triton::uint32>(elapsed / 1000);
+          }
+
+          worker.stats.queries++;
+          worker.stats.time += elapsed;
+          if (st == triton::engines::solver::TIMEOUT)
+            worker.stats.timeouts++;
+          worker.busy = false;
+        }
+        this->pool->idle.notify_all();
+
+        /* Errors of the worker are errors of the query */
+        if (answered && !response.empty())
+          throw triton::exceptions::SolverEngine(response);
+
+        if (status)
+          *status = st;
+
+        if (solvingTime)
+          *solvingTime = time;
+
+        return ret;
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> ProcessPoolSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::unordered_map<triton::usize, SolverModel> ret;
+        std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+
+        models = this->getModels(node, 1, status, timeout, solvingTime);
+        if (models.size() > 0)
+          ret = models.front();
+
+        return ret;
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> ProcessPoolSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->getModels(node, {}, limit, status, timeout, solvingTime);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> ProcessPoolSolver::getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        if (limit == 0)
+          return {};
+        return this->query(node, projection, limit, status, timeout, solvingTime);
+      }
+
+
+      bool ProcessPoolSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        this->query(node, {}, 0, &st, timeout, solvingTime);
+        if (status)
+          *status = st;
+
+        return (st == triton::engines::solver::SAT);
+      }
+
+
+      std::string ProcessPoolSolver::getName(void) const {
+        #ifdef TRITON_Z3_INTERFACE
+        if (this->pool->backend == triton::engines::solver::SOLVER_Z3)
+          return "process pool (z3)";
+        #endif
+        return "process pool (bitwuzla)";
+      }
+
+
+      triton::engines::solver::SolverStats ProcessPoolSolver::getStats(void) const {
+        return this->stats;
+      }
+
+
+      std::vector<triton::engines::solver::SolverWorkerStats> ProcessPoolSolver::getWorkerStats(void) const {
+        std::vector<triton::engines::solver::SolverWorkerStats> ret;
+        std::lock_guard<std::mutex> guard(this->pool->lock);
+
+        for (const auto& worker : this->pool->workers)
+          ret.push_back(worker.stats);
+
+        return ret;
+      }
+
+
+      void ProcessPoolSolver::setWorkers(triton::uint32 workers) {
+        std::unique_lock<std::mutex> guard(this->pool->lock);
+        auto& current = this->pool->workers;
+
+        if (workers == 0)
+          workers = std::max<triton::uint32>(std::thread::hardware_concurrency(), 1);
+
+        /* Workers are only resized while none is solving */
+        this->pool->idle.wait(guard, [&] {
+          return std::none_of(current.begin(), current.end(), [](const ProcessPoolWorker& w) { return w.busy; });
+        });
+
+        for (triton::usize i = workers; i < current.size(); i++)
+          this->pool->stop(current[i]);
+
+        current.resize(workers);
+        this->pool->idle.notify_all();
+      }
+
+
+      void ProcessPoolSolver::interrupt(bool enable) {
+        this->pool->interrupted = enable;
+        if (!enable)
+          return;
+
+        /* The queries being solved get an EOF and report UNKNOWN */
+        std::lock_guard<std::mutex> guard(this->pool->lock);
+        for (const auto& worker : this->pool->workers) {
+          if (worker.busy && worker.pid > 0)
+            kill(worker.pid, SIGKILL);
+        }
+      }
+
+
+      void ProcessPoolSolver::setTimeout(triton::uint32 ms) {
+        this->pool->timeout = ms;
+      }
+
+
+      void ProcessPoolSolver::setMemoryLimit(triton::uint32 mem) {
+        this->pool->memoryLimit = mem;
+      }
+
+    };
+  };
+};
+
+#endif
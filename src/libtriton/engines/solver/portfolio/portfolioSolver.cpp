@@ -0,0 +1,258 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <triton/exceptions.hpp>
+#include <triton/localSearchSolver.hpp>
+#include <triton/portfolioSolver.hpp>
+
+#ifdef TRITON_Z3_INTERFACE
+  #include <triton/z3Solver.hpp>
+#endif
+
+#ifdef TRITON_BITWUZLA_INTERFACE
+  #include <triton/bitwuzlaSolver.hpp>
+#endif
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      PortfolioSolver::PortfolioSolver(triton::uint32 seeds) {
+        this->timeout     = 0;
+        this->memoryLimit = 0;
+        this->build(seeds);
+      }
+
+
+      void PortfolioSolver::build(triton::uint32 seeds) {
+        this->backends.clear();
+        this->names.clear();
+        this->wins.clear();
+        this->last = 0;
+        this->localSearch = 0;
+
+        #ifdef TRITON_Z3_INTERFACE
+        for (triton::uint32 seed = 0; seed <= seeds; seed++) {
+          auto* solver = new(std::nothrow) triton::engines::solver::Z3Solver();
+          if (solver == nullptr)
+            throw triton::exceptions::SolverEngine("PortfolioSolver::PortfolioSolver(): Not enough memory.");
+          solver->setSeed(seed);
+          this->backends.emplace_back(solver);
+          this->names.push_back(seed ? "z3 (seed " + std::to_string(seed) + ")" : "z3");
+        }
+        #endif
+
+        #ifdef TRITON_BITWUZLA_INTERFACE
+        auto* solver = new(std::nothrow) triton::engines::solver::BitwuzlaSolver();
+        if (solver == nullptr)
+          throw triton::exceptions::SolverEngine("PortfolioSolver::PortfolioSolver(): Not enough memory.");
+        this->backends.emplace_back(solver);
+        this->names.push_back(solver->getName());
+        #endif
+
+        if (this->backends.empty())
+          throw triton::exceptions::SolverEngine("PortfolioSolver::PortfolioSolver(): No solver available.");
+
+        /* The local search only answers SAT, it cannot be the only backend */
+        auto* search = new(std::nothrow) triton::engines::solver::LocalSearchSolver();
+        if (search == nullptr)
+          throw triton::exceptions::SolverEngine("PortfolioSolver::PortfolioSolver(): Not enough memory.");
+        this->backends.emplace_back(search);
+        this->names.push_back(search->getName());
+        this->localSearch = this->backends.size() - 1;
+
+        for (auto&& backend : this->backends) {
+          if (this->timeout)
+            backend->setTimeout(this->timeout);
+          if (this->memoryLimit)
+            backend->setMemoryLimit(this->memoryLimit);
+        }
+
+        this->wins.resize(this->backends.size(), 0);
+      }
+
+
+      void PortfolioSolver::setSeeds(triton::uint32 seeds) {
+        std::lock_guard<std::mutex> guard(this->winsLock);
+        this->build(seeds);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> PortfolioSolver::race(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::usize count = this->backends.size();
+        std::vector<std::vector<std::unordered_map<triton::usize, SolverModel>>> models(count);
+        std::vector<triton::engines::solver::status_e> states(count, triton::engines::solver::UNKNOWN);
+        std::vector<triton::uint32> times(count, 0);
+        std::vector<std::exception_ptr> errors(count);
+        std::vector<std::thread> threads;
+        triton::usize winner = count;
+        std::mutex lock;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("PortfolioSolver::race(): node cannot be null.");
+
+        for (auto&& backend : this->backends)
+          backend->interrupt(false);
+
+        auto run = [&](triton::usize i) {
+          /* The local search cannot tell that all models are enumerated */
+          if (limit > 1 && i == this->localSearch)
+            return;
+
+          try {
+            if (limit)
+              models[i] = this->backends[i]->getModels(node, projection, limit, &states[i], timeout, &times[i]);
+            else
+              this->backends[i]->isSat(node, &states[i], timeout, &times[i]);
+          }
+          catch (...) {
+            errors[i] = std::current_exception();
+            return;
+          }
+
+          /* The first definitive answer wins, the other backends are stopped */
+          if (states[i] == triton::engines::solver::SAT || states[i] == triton::engines::solver::UNSAT) {
+            std::lock_guard<std::mutex> guard(lock);
+            if (winner == count) {
+              winner = i;
+              for (triton::usize j = 0; j < count; j++) {
+                if (j != i)
+                  this->backends[j]->interrupt(true);
+              }
+            }
+          }
+        };
+
+        for (triton::usize i = 1; i < count; i++)
+          threads.emplace_back(run, i);
+        run(0);
+
+        for (auto&& thread : threads)
+          thread.join();
+
+        for (auto&& backend : this->backends)
+          backend->interrupt(false);
+
+        if (winner == count) {
+          for (auto&& error : errors) {
+            if (error)
+              std::rethrow_exception(error);
+          }
+          /* Nobody won, report the answer of the first backend (e.g. a timeout) */
+          winner = 0;
+        }
+
+        {
+          std::lock_guard<std::mutex> guard(this->winsLock);
+          if (states[winner] == triton::engines::solver::SAT || states[winner] == triton::engines::solver::UNSAT)
+            this->wins[winner]++;
+          this->last = winner;
+        }
+
+        if (status)
+          *status = states[winner];
+
+        if (solvingTime)
+          *solvingTime = times[winner];
+
+        return models[winner];
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> PortfolioSolver::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::unordered_map<triton::usize, SolverModel> ret;
+        std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+
+        models = this->getModels(node, 1, status, timeout, solvingTime);
+        if (models.size() > 0)
+          ret = models.front();
+
+        return ret;
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> PortfolioSolver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->getModels(node, {}, limit, status, timeout, solvingTime);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> PortfolioSolver::getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        if (limit == 0)
+          return {};
+        return this->race(node, projection, limit, status, timeout, solvingTime);
+      }
+
+
+      bool PortfolioSolver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+
+        this->race(node, {}, 0, &st, timeout, solvingTime);
+        if (status)
+          *status = st;
+
+        return (st == triton::engines::solver::SAT);
+      }
+
+
+      std::string PortfolioSolver::getName(void) const {
+        return "portfolio";
+      }
+
+
+      triton::engines::solver::SolverStats PortfolioSolver::getStats(void) const {
+        std::lock_guard<std::mutex> guard(this->winsLock);
+        return this->backends[this->last]->getStats();
+      }
+
+
+      std::map<std::string, triton::usize> PortfolioSolver::getWins(void) const {
+        std::map<std::string, triton::usize> ret;
+        std::lock_guard<std::mutex> guard(this->winsLock);
+
+        for (triton::usize i = 0; i < this->backends.size(); i++)
+          ret[this->names[i]] = this->wins[i];
+
+        return ret;
+      }
+
+
+      void PortfolioSolver::clearWins(void) {
+        std::lock_guard<std::mutex> guard(this->winsLock);
+        std::fill(this->wins.begin(), this->wins.end(), 0);
+      }
+
+
+      void PortfolioSolver::interrupt(bool enable) {
+        for (auto&& backend : this->backends)
+          backend->interrupt(enable);
+      }
+
+
+      void PortfolioSolver::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
+        for (auto&& backend : this->backends)
+          backend->setTimeout(ms);
+      }
+
+
+      void PortfolioSolver::setMemoryLimit(triton::uint32 mem) {
+        this->memoryLimit = mem;
+        for (auto&& backend : this->backends)
+          backend->setMemoryLimit(mem);
+      }
+
+    };
+  };
+};
@@ -0,0 +1,377 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+
+#include <triton/coreUtils.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/modelCache.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Mixes a value into both lanes of a structural hash */
+      static void mix(std::pair<triton::uint64, triton::uint64>& hash, triton::uint64 value) {
+        hash.first  = (hash.first ^ value) * 0x100000001b3;
+        hash.second = hash.second + value * 0x9e3779b97f4a7c15;
+        hash.second = ((hash.second << 31) | (hash.second >> 33)) * 0xbf58476d1ce4e5b9;
+      }
+
+
+      template <typename T>
+      static void put(std::vector<triton::uint8>& buffer, T value) {
+        for (triton::usize i = 0; i < sizeof(T); i++) {
+          buffer.push_back(static_cast<triton::uint8>(value & 0xff));
+          value = static_cast<T>(value >> 8);
+        }
+      }
+
+
+      template <typename T>
+      static T get(const std::vector<triton::uint8>& buffer, triton::usize& cursor) {
+        T value = 0;
+
+        if (cursor + sizeof(T) > buffer.size())
+          throw triton::exceptions::SolverEngine("SolverCache::load(): Truncated cache file.");
+
+        for (triton::usize i = 0; i < sizeof(T); i++)
+          value |= static_cast<T>(static_cast<T>(buffer[cursor + i]) << (i * 8));
+        cursor += sizeof(T);
+
+        return value;
+      }
+
+
+      SolverCache::SolverCache(triton::usize capacity) {
+        this->capacity = capacity;
+      }
+
+
+      SolverQuery SolverCache::canonicalize(const triton::ast::SharedAbstractNode& node) const {
+        std::unordered_map<const triton::ast::AbstractNode*, std::pair<triton::uint64, triton::uint64>> hashes;
+        std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::unordered_map<triton::usize, triton::uint64> ranks;
+        SolverQuery query;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverCache::canonicalize(): node cannot be null.");
+
+        auto nodes = triton::ast::childrenExtraction(node, true /* unroll*/, true /* revert */);
+
+        /* Variables are numbered by id ordering, so alpha-equivalent queries get the same key */
+        for (auto&& n : nodes) {
+          if (n->getType() == triton::ast::VARIABLE_NODE) {
+            const auto& var = reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable();
+            variables[var->getId()] = var;
+          }
+        }
+
+        for (auto&& var : variables) {
+          ranks[var.first] = query.variables.size();
+          query.variables.push_back(var.second);
+        }
+
+        for (auto&& n : nodes) {
+          std::pair<triton::uint64, triton::uint64> hash = {0xcbf29ce484222325, 0x6a09e667f3bcc909};
+
+          switch (n->getType()) {
+            /* References are transparent */
+            case triton::ast::REFERENCE_NODE:
+              hashes[n.get()] = hashes.at(reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst().get());
+              continue;
+
+            case triton::ast::INTEGER_NODE: {
+              triton::uint512 value = reinterpret_cast<triton::ast::IntegerNode*>(n.get())->getInteger();
+              mix(hash, n->getType());
+              for (triton::uint32 i = 0; i < 8; i++) {
+                mix(hash, static_cast<triton::uint64>(value & 0xffffffffffffffff));
+                value >>= 64;
+              }
+              break;
+            }
+
+            case triton::ast::ARRAY_NODE:
+              mix(hash, n->getType());
+              mix(hash, reinterpret_cast<triton::ast::ArrayNode*>(n.get())->getIndexSize());
+              break;
+
+            case triton::ast::STRING_NODE:
+              mix(hash, n->getType());
+              mix(hash, std::hash<std::string>{}(reinterpret_cast<triton::ast::StringNode*>(n.get())->getString()));
+              break;
+
+            case triton::ast::VARIABLE_NODE: {
+              const auto& var = reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable();
+              mix(hash, n->getType());
+              mix(hash, ranks.at(var->getId()));
+              mix(hash, var->getSize());
+              break;
+            }
+
+            default:
+              mix(hash, n->getType());
+              break;
+          }
+
+          for (auto&& child : n->getChildren()) {
+            const auto& chash = hashes.at(child.get());
+            mix(hash, chash.first);
+            mix(hash, chash.second);
+          }
+
+          hashes[n.get()] = hash;
+        }
+
+        query.key = hashes.at(node.get());
+        query.nodes = std::move(nodes);
+        return query;
+      }
+
+
+      SolverCache::Entry& SolverCache::record(const std::pair<triton::uint64, triton::uint64>& key) {
+        auto it = this->entries.find(key);
+        if (it != this->entries.end()) {
+          this->lru.splice(this->lru.begin(), this->lru, it->second.lru);
+          return it->second;
+        }
+
+        if (this->capacity && this->entries.size() >= this->capacity) {
+          this->entries.erase(this->lru.back());
+          this->lru.pop_back();
+          this->stats.evictions++;
+        }
+
+        this->lru.push_front(key);
+        Entry& entry   = this->entries[key];
+        entry.status   = triton::engines::solver::UNKNOWN;
+        entry.timeout  = 0;
+        entry.hasModel = false;
+        entry.lru      = this->lru.begin();
+
+        return entry;
+      }
+
+
+      bool SolverCache::check(const SolverQuery& query, const Entry& entry) const {
+        std::unordered_map<triton::usize, triton::uint512> values;
+        triton::uint512 result = 0;
+
+        if (entry.status != triton::engines::solver::SAT || !entry.hasModel || query.nodes.empty())
+          return true;
+
+        for (const auto& value : entry.model) {
+          if (value.first < query.variables.size())
+            values[query.variables[value.first]->getId()] = value.second;
+        }
+
+        /* Arrays and floating-point queries cannot be evaluated, their model is trusted */
+        if (!triton::engines::solver::ModelCache::evaluate(query.nodes, values, result))
+          return true;
+
+        return result != 0;
+      }
+
+
+      bool SolverCache::lookup(const SolverQuery& query, triton::uint32 timeout, triton::engines::solver::status_e* status, std::unordered_map<triton::usize, SolverModel>* model) {
+        auto it = this->entries.find(query.key);
+
+        /* A timeout is only reused if the query does not allow more time */
+        if (it == this->entries.end() ||
+            (model != nullptr && !it->second.hasModel) ||
+            (it->second.status == triton::engines::solver::TIMEOUT && (timeout == 0 || (it->second.timeout && timeout > it->second.timeout)))) {
+          this->stats.misses++;
+          return false;
+        }
+
+        /* A hash collision or a corrupted file, the query is solved again */
+        if (!this->check(query, it->second)) {
+          this->lru.erase(it->second.lru);
+          this->entries.erase(it);
+          this->stats.rejections++;
+          this->stats.misses++;
+          return false;
+        }
+
+        const Entry& entry = it->second;
+        this->lru.splice(this->lru.begin(), this->lru, entry.lru);
+        this->stats.hits++;
+
+        if (status)
+          *status = entry.status;
+
+        if (model) {
+          model->clear();
+          for (const auto& value : entry.model) {
+            if (value.first >= query.variables.size())
+              continue;
+            SolverModel m(query.variables[value.first], value.second);
+            (*model)[m.getId()] = m;
+          }
+        }
+
+        return true;
+      }
+
+
+      void SolverCache::insert(const SolverQuery& query, triton::uint32 timeout, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, SolverModel>* model) {
+        /* Out of memory and unknown results depend on the environment */
+        if (status != triton::engines::solver::SAT && status != triton::engines::solver::UNSAT && status != triton::engines::solver::TIMEOUT)
+          return;
+
+        Entry& entry = this->record(query.key);
+
+        /* Keep a known model when the same status is recorded by isSat() */
+        if (model == nullptr && entry.hasModel && entry.status == status)
+          return;
+
+        entry.status   = status;
+        entry.timeout  = timeout;
+        entry.hasModel = (model != nullptr);
+        entry.model.clear();
+
+        if (model) {
+          for (triton::uint32 i = 0; i < query.variables.size(); i++) {
+            auto it = model->find(query.variables[i]->getId());
+            if (it != model->end())
+              entry.model.push_back({i, it->second.getValue()});
+          }
+        }
+      }
+
+
+      void SolverCache::clear(void) {
+        this->entries.clear();
+        this->lru.clear();
+      }
+
+
+      triton::usize SolverCache::size(void) const {
+        return this->entries.size();
+      }
+
+
+      const triton::engines::solver::SolverCacheStats& SolverCache::getStats(void) const {
+        return this->stats;
+      }
+
+
+      void SolverCache::clearStats(void) {
+        this->stats = triton::engines::solver::SolverCacheStats();
+      }
+
+
+      void SolverCache::load(const std::string& path) {
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+        triton::uint8 value[64];
+        triton::usize cursor = 0;
+
+        if (!stream.is_open())
+          throw triton::exceptions::SolverEngine("SolverCache::load(): Cannot open " + path + ".");
+
+        std::vector<triton::uint8> buffer((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+        if (buffer.size() < sizeof(cacheFormat::magic) || std::memcmp(buffer.data(), cacheFormat::magic, sizeof(cacheFormat::magic)) != 0)
+          throw triton::exceptions::SolverEngine("SolverCache::load(): Invalid cache magic.");
+
+        cursor = sizeof(cacheFormat::magic);
+        if (get<triton::uint32>(buffer, cursor) != cacheFormat::version)
+          throw triton::exceptions::SolverEngine("SolverCache::load(): Unsupported cache version.");
+
+        /* Entries are stored from the least to the most recently used, they are added once all are valid */
+        std::vector<std::pair<std::pair<triton::uint64, triton::uint64>, Entry>> loaded;
+        triton::uint64 count = get<triton::uint64>(buffer, cursor);
+        for (triton::uint64 i = 0; i < count; i++) {
+          std::pair<triton::uint64, triton::uint64> key;
+          Entry entry;
+
+          key.first      = get<triton::uint64>(buffer, cursor);
+          key.second     = get<triton::uint64>(buffer, cursor);
+          entry.status   = static_cast<triton::engines::solver::status_e>(get<triton::uint32>(buffer, cursor));
+          entry.timeout  = get<triton::uint32>(buffer, cursor);
+          triton::uint8 hasModel = get<triton::uint8>(buffer, cursor);
+          entry.hasModel = (hasModel != 0);
+
+          if (entry.status != triton::engines::solver::SAT && entry.status != triton::engines::solver::UNSAT && entry.status != triton::engines::solver::TIMEOUT)
+            throw triton::exceptions::SolverEngine("SolverCache::load(): Corrupted cache file.");
+
+          triton::uint32 size = get<triton::uint32>(buffer, cursor);
+          if (hasModel > 1 || (size && (!entry.hasModel || entry.status != triton::engines::solver::SAT)) || size > buffer.size() - cursor)
+            throw triton::exceptions::SolverEngine("SolverCache::load(): Corrupted cache file.");
+
+          for (triton::uint32 j = 0; j < size; j++) {
+            triton::uint32 index = get<triton::uint32>(buffer, cursor);
+            triton::uint8  vsize = get<triton::uint8>(buffer, cursor);
+            if (vsize > sizeof(value) || cursor + vsize > buffer.size() || (j && index <= entry.model.back().first))
+              throw triton::exceptions::SolverEngine("SolverCache::load(): Corrupted cache file.");
+            std::memset(value, 0x00, sizeof(value));
+            std::memcpy(value, buffer.data() + cursor, vsize);
+            cursor += vsize;
+            entry.model.push_back({index, triton::utils::cast<triton::uint512>(value)});
+          }
+
+          loaded.push_back({key, std::move(entry)});
+        }
+
+        if (cursor != buffer.size())
+          throw triton::exceptions::SolverEngine("SolverCache::load(): Corrupted cache file.");
+
+        for (auto& item : loaded) {
+          Entry& entry   = this->record(item.first);
+          entry.status   = item.second.status;
+          entry.timeout  = item.second.timeout;
+          entry.hasModel = item.second.hasModel;
+          entry.model    = std::move(item.second.model);
+        }
+      }
+
+
+      void SolverCache::save(const std::string& path) const {
+        std::vector<triton::uint8> buffer;
+        triton::uint8 value[64];
+
+        buffer.insert(buffer.end(), cacheFormat::magic, cacheFormat::magic + sizeof(cacheFormat::magic));
+        put<triton::uint32>(buffer, cacheFormat::version);
+        put<triton::uint64>(buffer, this->entries.size());
+
+        for (auto key = this->lru.rbegin(); key != this->lru.rend(); key++) {
+          const Entry& entry = this->entries.at(*key);
+          put<triton::uint64>(buffer, key->first);
+          put<triton::uint64>(buffer, key->second);
+          put<triton::uint32>(buffer, entry.status);
+          put<triton::uint32>(buffer, entry.timeout);
+          put<triton::uint8>(buffer, entry.hasModel);
+          put<triton::uint32>(buffer, static_cast<triton::uint32>(entry.model.size()));
+          for (const auto& m : entry.model) {
+            /* Leading zero bytes are dropped, the reader zero-extends the value */
+            triton::utils::fromUintToBuffer(m.second, value);
+            triton::uint8 size = sizeof(value);
+            while (size && value[size - 1] == 0)
+              size--;
+            put<triton::uint32>(buffer, m.first);
+            put<triton::uint8>(buffer, size);
+            buffer.insert(buffer.end(), value, value + size);
+          }
+        }
+
+        std::ofstream stream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!stream.is_open())
+          throw triton::exceptions::SolverEngine("SolverCache::save(): Cannot open " + path + ".");
+
+        stream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+      }
+
+    };
+  };
+};
@@ -5,9 +5,18 @@
 **  This program is under the terms of the Apache License 2.0.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <thread>
+
+#include <triton/astContext.hpp>
 #include <triton/config.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/solverEngine.hpp>
+#include <triton/symbolicExpression.hpp>
 
 
 
@@ -15,8 +24,11 @@ namespace triton {
   namespace engines {
     namespace solver {
 
-      SolverEngine::SolverEngine() {
+      SolverEngine::SolverEngine(const triton::modes::SharedModes& modes)
+        : modes(modes) {
         this->kind = triton::engines::solver::SOLVER_INVALID;
+        this->timeout = 0;
+        this->memoryLimit = 0;
         #if defined(TRITON_Z3_INTERFACE)
         /* By default we initialized the z3 solver */
         this->setSolver(triton::engines::solver::SOLVER_Z3);
@@ -38,33 +50,55 @@ namespace triton {
       }
 
 
-      void SolverEngine::setSolver(triton::engines::solver::solver_e kind) {
+      triton::engines::solver::SolverInterface* SolverEngine::newSolver(triton::engines::solver::solver_e kind) const {
+        triton::engines::solver::SolverInterface* solver = nullptr;
+
         /* Allocate and init the good solver */
         switch (kind) {
           #ifdef TRITON_Z3_INTERFACE
           case triton::engines::solver::SOLVER_Z3:
-            /* init the new instance */
-            this->solver.reset(new(std::nothrow) triton::engines::solver::Z3Solver());
-            if (this->solver == nullptr)
-              throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): Not enough memory.");
+            solver = new(std::nothrow) triton::engines::solver::Z3Solver();
             break;
           #endif
           #ifdef TRITON_BITWUZLA_INTERFACE
           case triton::engines::solver::SOLVER_BITWUZLA:
-            /* init the new instance */
-            this->solver.reset(new(std::nothrow) triton::engines::solver::BitwuzlaSolver());
-            if (this->solver == nullptr)
-              throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): Not enough memory.");
+            solver = new(std::nothrow) triton::engines::solver::BitwuzlaSolver();
+            break;
+          #endif
+          #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+          case triton::engines::solver::SOLVER_PORTFOLIO:
+            solver = new(std::nothrow) triton::engines::solver::PortfolioSolver();
+            break;
+          #endif
+          case triton::engines::solver::SOLVER_LOCAL_SEARCH:
+            solver = new(std::nothrow) triton::engines::solver::LocalSearchSolver();
+            break;
+          #if !defined(_WIN32) && (defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE))
+          case triton::engines::solver::SOLVER_PROCESS_POOL:
+            solver = new(std::nothrow) triton::engines::solver::ProcessPoolSolver();
             break;
           #endif
 
           default:
-            throw triton::exceptions::SolverEngine("SolverEngine::setSolver(): Solver not supported.");
+            throw triton::exceptions::SolverEngine("SolverEngine::newSolver(): Solver not supported.");
             break;
         }
 
+        if (solver == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::newSolver(): Not enough memory.");
+
+        return solver;
+      }
+
+
+      void SolverEngine::setSolver(triton::engines::solver::solver_e kind) {
+        /* init the new instance */
+        this->solver.reset(this->newSolver(kind));
+
         /* Setup global variables */
         this->kind = kind;
+        this->timeout = 0;
+        this->memoryLimit = 0;
       }
 
 
@@ -77,6 +111,8 @@ namespace triton {
 
         /* Setup global variables */
         this->kind = triton::engines::solver::SOLVER_CUSTOM;
+        this->timeout = 0;
+        this->memoryLimit = 0;
       }
 
 
@@ -87,24 +123,413 @@ namespace triton {
       }
 
 
+      triton::ast::SharedAbstractNode SolverEngine::sliceIndependentConstraints(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>& concrete) const {
+        std::vector<triton::ast::SharedAbstractNode> conjuncts;
+        std::vector<triton::ast::SharedAbstractNode> worklist = {node};
+        std::unordered_map<triton::usize, triton::usize> owners;
+        std::vector<triton::usize> parents;
+
+        /* Flattens the conjunction */
+        while (!worklist.empty()) {
+          auto n = worklist.back();
+          worklist.pop_back();
+          if (n->getType() == triton::ast::LAND_NODE) {
+            const auto& children = n->getChildren();
+            worklist.insert(worklist.end(), children.rbegin(), children.rend());
+          }
+          else {
+            conjuncts.push_back(n);
+          }
+        }
+
+        /* Conjuncts sharing a variable are merged into the same cluster */
+        std::function<triton::usize(triton::usize)> find = [&](triton::usize i) {
+          while (parents[i] != i)
+            i = parents[i] = parents[parents[i]];
+          return i;
+        };
+
+        std::vector<std::deque<triton::ast::SharedAbstractNode>> variables(conjuncts.size());
+        for (triton::usize i = 0; i < conjuncts.size(); i++) {
+          parents.push_back(i);
+          variables[i] = triton::ast::search(conjuncts[i], triton::ast::VARIABLE_NODE);
+          for (const auto& var : variables[i]) {
+            triton::usize id = reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable()->getId();
+            auto it = owners.find(id);
+            if (it == owners.end())
+              owners[id] = i;
+            else
+              parents[find(i)] = find(it->second);
+          }
+        }
+
+        /* A cluster is kept if one of its conjuncts is not satisfied by the concrete values */
+        std::vector<bool> kept(conjuncts.size(), false);
+        for (triton::usize i = 0; i < conjuncts.size(); i++) {
+          if (conjuncts[i]->evaluate() == 0)
+            kept[find(i)] = true;
+        }
+
+        std::vector<triton::ast::SharedAbstractNode> slice;
+        for (triton::usize i = 0; i < conjuncts.size(); i++) {
+          if (kept[find(i)]) {
+            slice.push_back(conjuncts[i]);
+            continue;
+          }
+          for (const auto& var : variables[i]) {
+            SolverModel model(reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable(), var->evaluate());
+            concrete[model.getId()] = model;
+          }
+        }
+
+        if (slice.size() == conjuncts.size())
+          return node;
+
+        if (slice.empty())
+          return nullptr;
+
+        if (slice.size() == 1)
+          return slice.front();
+
+        return node->getContext()->land(slice);
+      }
+
+
+      triton::ast::SharedAbstractNode SolverEngine::getOptimisticQuery(const triton::ast::SharedAbstractNode& node) const {
+        triton::ast::SharedAbstractNode n = node;
+
+        while (n->getType() == triton::ast::REFERENCE_NODE)
+          n = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression()->getAst();
+
+        if (n->getType() != triton::ast::LAND_NODE)
+          return nullptr;
+
+        return n->getChildren().back();
+      }
+
+
+      bool SolverEngine::lookup(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>* model, triton::uint32 timeout, triton::engines::solver::status_e& status, triton::engines::solver::SolverQuery& query) const {
+        triton::uint32 tmout = timeout ? timeout : this->timeout;
+        bool reused = this->modes->isModeEnabled(triton::modes::MODEL_REUSE);
+
+        /* A query known to be true holds for the concrete values, one known to be false is unsat */
+        if (this->modes->isModeEnabled(triton::modes::ABSTRACT_INTERPRETATION)) {
+          auto value = node->getAbstractValue();
+          if (value.isTrue() || value.isFalse()) {
+            status = value.isTrue() ? triton::engines::solver::SAT : triton::engines::solver::UNSAT;
+            if (model)
+              model->clear();
+            if (model && value.isTrue()) {
+              for (const auto& var : triton::ast::search(node, triton::ast::VARIABLE_NODE)) {
+                SolverModel m(reinterpret_cast<triton::ast::VariableNode*>(var.get())->getSymbolicVariable(), var->evaluate());
+                (*model)[m.getId()] = m;
+              }
+            }
+            this->stats.decided++;
+            return true;
+          }
+        }
+
+        /* A known assignment satisfying the query spares the solver */
+        if (reused && this->models.lookup(node, model)) {
+          status = triton::engines::solver::SAT;
+          return true;
+        }
+
+        if (!this->modes->isModeEnabled(triton::modes::SOLVER_CACHE))
+          return false;
+
+        query = this->cache.canonicalize(node);
+        if (!this->cache.lookup(query, tmout, &status, model))
+          return false;
+
+        if (reused && model && status == triton::engines::solver::SAT)
+          this->models.insert(*model);
+
+        return true;
+      }
+
+
+      void SolverEngine::record(const triton::ast::SharedAbstractNode& node, const triton::engines::solver::SolverQuery& query, const std::unordered_map<triton::usize, SolverModel>* model, triton::uint32 timeout, triton::engines::solver::status_e status, triton::uint32 solvingTime) const {
+        triton::uint32 tmout = timeout ? timeout : this->timeout;
+
+        if (this->recorder.isEnabled())
+          this->recorder.write(node, this->getName(), tmout, status, solvingTime);
+
+        if (this->modes->isModeEnabled(triton::modes::SOLVER_CACHE))
+          this->cache.insert(query, tmout, status, model);
+
+        if (this->modes->isModeEnabled(triton::modes::MODEL_REUSE) && model && status == triton::engines::solver::SAT)
+          this->models.insert(*model);
+      }
+
+
+      triton::engines::solver::status_e SolverEngine::solve(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>* model, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        triton::engines::solver::SolverQuery query;
+
+        if (this->lookup(node, model, timeout, status, query)) {
+          if (solvingTime)
+            *solvingTime = 0;
+          return status;
+        }
+
+        triton::uint32 time = 0;
+        if (model)
+          *model = this->solver->getModel(node, &status, timeout, &time);
+        else
+          this->solver->isSat(node, &status, timeout, &time);
+        this->stats += this->solver->getStats();
+
+        if (solvingTime)
+          *solvingTime = time;
+
+        this->record(node, query, model, timeout, status, time);
+
+        return status;
+      }
+
+
       std::unordered_map<triton::usize, SolverModel> SolverEngine::getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::unordered_map<triton::usize, SolverModel> concrete;
+        std::unordered_map<triton::usize, SolverModel> model;
+        triton::ast::SharedAbstractNode query = node;
+        triton::engines::solver::status_e st = triton::engines::solver::SAT;
+
         if (!this->solver)
           return std::unordered_map<triton::usize, SolverModel>{};
-        return this->solver->getModel(node, status, timeout, solvingTime);
+
+        if (this->modes->isModeEnabled(triton::modes::CONSTRAINT_INDEPENDENCE))
+          query = this->sliceIndependentConstraints(node, concrete);
+
+        if (query != nullptr)
+          st = this->solve(query, &model, timeout, solvingTime);
+        else if (solvingTime)
+          *solvingTime = 0;
+
+        /* Variables of the dropped clusters keep their concrete values */
+        if (st == triton::engines::solver::SAT)
+          model.insert(concrete.begin(), concrete.end());
+
+        /* The last conjunct, e.g. a negated branch, is solved alone and other variables keep the current input */
+        else if (this->modes->isModeEnabled(triton::modes::OPTIMISTIC_SOLVING) && (st == triton::engines::solver::UNSAT || st == triton::engines::solver::TIMEOUT)) {
+          auto branch = this->getOptimisticQuery(node);
+          if (branch != nullptr) {
+            std::unordered_map<triton::usize, SolverModel> optimistic;
+            triton::uint32 time = 0;
+            if (this->solve(branch, &optimistic, timeout, &time) == triton::engines::solver::SAT) {
+              for (auto& m : optimistic)
+                m.second.setOptimistic(true);
+              model = std::move(optimistic);
+              st = triton::engines::solver::SAT;
+            }
+            if (solvingTime)
+              *solvingTime += time;
+          }
+        }
+
+        if (status)
+          *status = st;
+
+        return model;
       }
 
 
       std::vector<std::unordered_map<triton::usize, SolverModel>> SolverEngine::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->getModels(node, {}, limit, status, timeout, solvingTime);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> SolverEngine::getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::vector<std::unordered_map<triton::usize, SolverModel>> models;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 time = 0;
+
         if (!this->solver)
           return std::vector<std::unordered_map<triton::usize, SolverModel>>{};
-        return this->solver->getModels(node, limit, status, timeout, solvingTime);
+
+        models = this->solver->getModels(node, projection, limit, &st, timeout, &time);
+        this->stats += this->solver->getStats();
+
+        if (this->recorder.isEnabled())
+          this->recorder.write(node, this->getName(), timeout ? timeout : this->timeout, st, time);
+
+        if (status)
+          *status = st;
+
+        if (solvingTime)
+          *solvingTime = time;
+
+        return models;
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> SolverEngine::getModels(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 threads, std::vector<triton::engines::solver::status_e>* status, triton::uint32 timeout, std::vector<triton::uint32>* solvingTime) const {
+        std::vector<std::unordered_map<triton::usize, SolverModel>> models(nodes.size());
+        std::vector<std::unordered_map<triton::usize, SolverModel>> concrete(nodes.size());
+        std::vector<triton::engines::solver::status_e> states(nodes.size(), triton::engines::solver::SAT);
+        std::vector<triton::engines::solver::SolverQuery> queries(nodes.size());
+        std::vector<triton::ast::SharedAbstractNode> slices(nodes);
+        std::vector<triton::uint32> times(nodes.size(), 0);
+        std::vector<triton::usize> pending;
+
+        if (!this->solver)
+          return std::vector<std::unordered_map<triton::usize, SolverModel>>{};
+
+        /* Slicing and caches are not thread-safe, they run on the calling thread */
+        for (triton::usize i = 0; i < nodes.size(); i++) {
+          if (nodes[i] == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
+
+          if (this->modes->isModeEnabled(triton::modes::CONSTRAINT_INDEPENDENCE))
+            slices[i] = this->sliceIndependentConstraints(nodes[i], concrete[i]);
+
+          if (slices[i] != nullptr && !this->lookup(slices[i], &models[i], timeout, states[i], queries[i]))
+            pending.push_back(i);
+        }
+
+        this->solveConcurrently(slices, pending, threads, timeout, models, states, times);
+
+        for (triton::usize i : pending)
+          this->record(slices[i], queries[i], &models[i], timeout, states[i], times[i]);
+
+        /* Variables of the dropped clusters keep their concrete values */
+        for (triton::usize i = 0; i < nodes.size(); i++) {
+          if (states[i] == triton::engines::solver::SAT)
+            models[i].insert(concrete[i].begin(), concrete[i].end());
+        }
+
+        /* Queries which are unsat or time out are solved again on their last conjunct */
+        if (this->modes->isModeEnabled(triton::modes::OPTIMISTIC_SOLVING)) {
+          std::vector<std::unordered_map<triton::usize, SolverModel>> optimistic(nodes.size());
+          std::vector<triton::engines::solver::status_e> ostates(nodes.size(), triton::engines::solver::UNKNOWN);
+          std::vector<triton::engines::solver::SolverQuery> oqueries(nodes.size());
+          std::vector<triton::ast::SharedAbstractNode> branches(nodes.size());
+          std::vector<triton::uint32> otimes(nodes.size(), 0);
+          std::vector<triton::usize> retried;
+
+          pending.clear();
+          for (triton::usize i = 0; i < nodes.size(); i++) {
+            if (states[i] != triton::engines::solver::UNSAT && states[i] != triton::engines::solver::TIMEOUT)
+              continue;
+            if ((branches[i] = this->getOptimisticQuery(nodes[i])) == nullptr)
+              continue;
+            retried.push_back(i);
+            if (!this->lookup(branches[i], &optimistic[i], timeout, ostates[i], oqueries[i]))
+              pending.push_back(i);
+          }
+
+          this->solveConcurrently(branches, pending, threads, timeout, optimistic, ostates, otimes);
+
+          for (triton::usize i : pending)
+            this->record(branches[i], oqueries[i], &optimistic[i], timeout, ostates[i], otimes[i]);
+
+          for (triton::usize i : retried) {
+            times[i] += otimes[i];
+            if (ostates[i] != triton::engines::solver::SAT)
+              continue;
+            for (auto& m : optimistic[i])
+              m.second.setOptimistic(true);
+            models[i] = std::move(optimistic[i]);
+            states[i] = triton::engines::solver::SAT;
+          }
+        }
+
+        if (status)
+          *status = states;
+
+        if (solvingTime)
+          *solvingTime = times;
+
+        return models;
+      }
+
+
+      void SolverEngine::solveConcurrently(const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::vector<triton::usize>& pending, triton::uint32 threads, triton::uint32 timeout, std::vector<std::unordered_map<triton::usize, SolverModel>>& models, std::vector<triton::engines::solver::status_e>& status, std::vector<triton::uint32>& solvingTime) const {
+        std::vector<std::unique_ptr<triton::engines::solver::SolverInterface>> solvers;
+        std::vector<triton::engines::solver::SolverStats> phases(nodes.size());
+        std::vector<std::exception_ptr> errors;
+        std::vector<std::thread> workers;
+        std::atomic<triton::usize> next(0);
+        triton::usize count = threads ? threads : std::thread::hardware_concurrency();
+
+        /* Workers take the next pending query until none is left */
+        auto work = [&](const triton::engines::solver::SolverInterface* solver, std::exception_ptr& error) {
+          try {
+            for (triton::usize n = next++; n < pending.size(); n = next++) {
+              triton::usize i = pending[n];
+              models[i] = solver->getModel(nodes[i], &status[i], timeout, &solvingTime[i]);
+              phases[i] = solver->getStats();
+            }
+          }
+          catch (...) {
+            error = std::current_exception();
+          }
+        };
+
+        /* A custom solver cannot be instantiated again */
+        if (this->kind == triton::engines::solver::SOLVER_CUSTOM)
+          count = 1;
+
+        count = std::max<triton::usize>(std::min<triton::usize>(count, pending.size()), 1);
+        errors.resize(count);
+
+        /* Each worker translates its queries into the context of its own solver */
+        if (count == 1) {
+          work(this->solver.get(), errors[0]);
+        }
+        else {
+          for (triton::usize w = 0; w < count; w++) {
+            #if !defined(_WIN32) && (defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE))
+            /* The threads share the worker processes of the pool, which bound the concurrency */
+            if (this->kind == triton::engines::solver::SOLVER_PROCESS_POOL) {
+              auto* pool = new(std::nothrow) triton::engines::solver::ProcessPoolSolver(*static_cast<const triton::engines::solver::ProcessPoolSolver*>(this->solver.get()));
+              if (pool == nullptr)
+                throw triton::exceptions::SolverEngine("SolverEngine::solveConcurrently(): Not enough memory.");
+              solvers.emplace_back(pool);
+              continue;
+            }
+            #endif
+            solvers.emplace_back(this->newSolver(this->kind));
+            solvers.back()->setTimeout(this->timeout);
+            solvers.back()->setMemoryLimit(this->memoryLimit);
+          }
+          for (triton::usize w = 0; w < count; w++)
+            workers.emplace_back(work, solvers[w].get(), std::ref(errors[w]));
+          for (auto& worker : workers)
+            worker.join();
+        }
+
+        for (triton::usize i : pending)
+          this->stats += phases[i];
+
+        for (const auto& error : errors) {
+          if (error)
+            std::rethrow_exception(error);
+        }
       }
 
 
       bool SolverEngine::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::unordered_map<triton::usize, SolverModel> concrete;
+        triton::ast::SharedAbstractNode query = node;
+        triton::engines::solver::status_e st = triton::engines::solver::SAT;
+
         if (!this->solver)
           return false;
-        return this->solver->isSat(node, status, timeout, solvingTime);
+
+        if (this->modes->isModeEnabled(triton::modes::CONSTRAINT_INDEPENDENCE))
+          query = this->sliceIndependentConstraints(node, concrete);
+
+        if (query != nullptr)
+          st = this->solve(query, nullptr, timeout, solvingTime);
+        else if (solvingTime)
+          *solvingTime = 0;
+
+        if (status)
+          *status = st;
+
+        return st == triton::engines::solver::SAT;
       }
 
 
@@ -115,7 +540,56 @@ namespace triton {
       }
 
 
+      void SolverEngine::pushScope(void) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::pushScope(): Solver undefined.");
+        this->solver->pushScope();
+      }
+
+
+      void SolverEngine::popScope(void) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::popScope(): Solver undefined.");
+        this->solver->popScope();
+      }
+
+
+      void SolverEngine::assertConstraint(const triton::ast::SharedAbstractNode& node) {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::assertConstraint(): Solver undefined.");
+        this->solver->assertConstraint(node);
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> SolverEngine::checkWithAssumption(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        std::unordered_map<triton::usize, SolverModel> model;
+
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::checkWithAssumption(): Solver undefined.");
+
+        model = this->solver->checkWithAssumption(node, status, timeout, solvingTime);
+        this->stats += this->solver->getStats();
+
+        return model;
+      }
+
+
+      void SolverEngine::resetSession(void) {
+        if (this->solver) {
+          this->solver->resetSession();
+        }
+      }
+
+
+      triton::usize SolverEngine::getSessionSize(void) const {
+        if (!this->solver)
+          throw triton::exceptions::SolverEngine("SolverEngine::getSessionSize(): Solver undefined.");
+        return this->solver->getSessionSize();
+      }
+
+
       void SolverEngine::setTimeout(triton::uint32 ms) {
+        this->timeout = ms;
         if (this->solver) {
           this->solver->setTimeout(ms);
         }
@@ -123,11 +597,86 @@ namespace triton {
 
 
       void SolverEngine::setMemoryLimit(triton::uint32 limit) {
+        this->memoryLimit = limit;
         if (this->solver) {
           this->solver->setMemoryLimit(limit);
         }
       }
 
+
+      void SolverEngine::setPortfolioSeeds(triton::uint32 seeds) {
+        #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+        if (this->solver && this->kind == triton::engines::solver::SOLVER_PORTFOLIO) {
+          static_cast<triton::engines::solver::PortfolioSolver*>(this->solver.get())->setSeeds(seeds);
+          return;
+        }
+        #endif
+        throw triton::exceptions::SolverEngine("SolverEngine::setPortfolioSeeds(): Solver must be a SOLVER_PORTFOLIO.");
+      }
+
+
+      void SolverEngine::setWorkers(triton::uint32 workers) {
+        #if !defined(_WIN32) && (defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE))
+        if (this->solver && this->kind == triton::engines::solver::SOLVER_PROCESS_POOL) {
+          static_cast<triton::engines::solver::ProcessPoolSolver*>(this->solver.get())->setWorkers(workers);
+          return;
+        }
+        #endif
+        throw triton::exceptions::SolverEngine("SolverEngine::setWorkers(): Solver must be a SOLVER_PROCESS_POOL.");
+      }
+
+
+      const triton::engines::solver::SolverCacheStats& SolverEngine::getCacheStats(void) const {
+        return this->cache.getStats();
+      }
+
+
+      void SolverEngine::clearCache(void) {
+        this->cache.clear();
+        this->cache.clearStats();
+      }
+
+
+      const triton::engines::solver::ModelCacheStats& SolverEngine::getModelCacheStats(void) const {
+        return this->models.getStats();
+      }
+
+
+      void SolverEngine::clearModelCache(void) {
+        this->models.clear();
+        this->models.clearStats();
+      }
+
+
+      void SolverEngine::loadCache(const std::string& path) {
+        this->cache.load(path);
+      }
+
+
+      void SolverEngine::saveCache(const std::string& path) const {
+        this->cache.save(path);
+      }
+
+
+      const triton::engines::solver::SolverStats& SolverEngine::getStats(void) const {
+        return this->stats;
+      }
+
+
+      void SolverEngine::clearStats(void) {
+        this->stats = triton::engines::solver::SolverStats();
+      }
+
+
+      void SolverEngine::setRecordDirectory(const std::string& path) {
+        this->recorder.setDirectory(path);
+      }
+
+
+      const std::string& SolverEngine::getRecordDirectory(void) const {
+        return this->recorder.getDirectory();
+      }
+
     };
   };
 };
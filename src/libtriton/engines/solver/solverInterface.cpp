@@ -0,0 +1,73 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/solverInterface.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> SolverInterface::getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
+        triton::engines::solver::status_e st = triton::engines::solver::UNKNOWN;
+        triton::uint32 total = 0;
+
+        if (projection.empty())
+          return this->getModels(node, limit, status, timeout, solvingTime);
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverInterface::getModels(): node cannot be null.");
+
+        auto actx  = node->getContext();
+        auto query = (node->getType() == triton::ast::ASSERT_NODE) ? node->getChildren()[0] : node;
+
+        for (triton::uint32 i = 0; i < limit; i++) {
+          std::unordered_map<triton::usize, SolverModel> projected;
+          std::vector<triton::ast::SharedAbstractNode> blocking;
+          triton::engines::solver::status_e current = triton::engines::solver::UNKNOWN;
+          triton::uint32 time = 0;
+
+          auto model = this->getModel(query, &current, timeout, &time);
+          total += time;
+
+          /* The status is the one of the first check, as with getModels() */
+          if (i == 0)
+            st = current;
+
+          if (current != triton::engines::solver::SAT)
+            break;
+
+          for (const auto& var : projection) {
+            /* A variable missing from the model is unconstrained, any value fits */
+            auto it = model.find(var->getId());
+            SolverModel m = (it != model.end()) ? it->second : SolverModel(var, 0);
+            projected[m.getId()] = m;
+            blocking.push_back(actx->distinct(actx->variable(var), actx->bv(m.getValue(), var->getSize())));
+          }
+
+          ret.push_back(projected);
+
+          /* Next models differ on the projected variables */
+          query = actx->land(query, blocking.size() == 1 ? blocking.front() : actx->lor(blocking));
+        }
+
+        if (status)
+          *status = st;
+
+        if (solvingTime)
+          *solvingTime = total;
+
+        return ret;
+      }
+
+    };
+  };
+};
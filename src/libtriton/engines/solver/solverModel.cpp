@@ -17,13 +17,15 @@ namespace triton {
     namespace solver {
 
       SolverModel::SolverModel() {
-        this->value = 0;
+        this->value      = 0;
+        this->optimistic = false;
       }
 
 
       SolverModel::SolverModel(const triton::engines::symbolic::SharedSymbolicVariable& variable, triton::uint512 value) {
-        this->value    = value;
-        this->variable = variable;
+        this->value      = value;
+        this->variable   = variable;
+        this->optimistic = false;
       }
 
 
@@ -33,8 +35,9 @@ namespace triton {
 
 
       void SolverModel::copy(const SolverModel& other) {
-        this->value    = other.value;
-        this->variable = other.variable;
+        this->value      = other.value;
+        this->variable   = other.variable;
+        this->optimistic = other.optimistic;
       }
 
 
@@ -58,6 +61,16 @@ namespace triton {
       }
 
 
+      bool SolverModel::isOptimistic(void) const {
+        return this->optimistic;
+      }
+
+
+      void SolverModel::setOptimistic(bool flag) {
+        this->optimistic = flag;
+      }
+
+
       SolverModel& SolverModel::operator=(const SolverModel& other) {
         this->copy(other);
         return *this;
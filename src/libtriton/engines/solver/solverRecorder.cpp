@@ -0,0 +1,150 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <unordered_set>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/liftingToSMT.hpp>
+#include <triton/solverRecorder.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/symbolicVariable.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Returns the name of a status in the metadata of a recorded query */
+      static const char* statusName(triton::engines::solver::status_e status) {
+        switch (status) {
+          case triton::engines::solver::SAT:      return "sat";
+          case triton::engines::solver::UNSAT:    return "unsat";
+          case triton::engines::solver::TIMEOUT:  return "timeout";
+          case triton::engines::solver::OUTOFMEM: return "outofmem";
+          default:                                return "unknown";
+        }
+      }
+
+
+      /* Switches an AST context to a representation mode and restores the previous one when leaving the scope */
+      class RepresentationGuard {
+        private:
+          triton::ast::SharedAstContext astCtxt;
+          triton::ast::representations::mode_e mode;
+
+        public:
+          RepresentationGuard(const triton::ast::SharedAstContext& astCtxt, triton::ast::representations::mode_e mode) : astCtxt(astCtxt) {
+            this->mode = astCtxt->getRepresentationMode();
+            astCtxt->setRepresentationMode(mode);
+          }
+
+          ~RepresentationGuard() {
+            this->astCtxt->setRepresentationMode(this->mode);
+          }
+
+          RepresentationGuard(const RepresentationGuard&) = delete;
+          RepresentationGuard& operator=(const RepresentationGuard&) = delete;
+      };
+
+
+      SolverRecorder::SolverRecorder() {
+        this->count = 0;
+      }
+
+
+      void SolverRecorder::setDirectory(const std::string& path) {
+        this->directory = path;
+        this->count = 0;
+      }
+
+
+      const std::string& SolverRecorder::getDirectory(void) const {
+        return this->directory;
+      }
+
+
+      bool SolverRecorder::isEnabled(void) const {
+        return !this->directory.empty();
+      }
+
+
+      triton::usize SolverRecorder::size(void) const {
+        return this->count;
+      }
+
+
+      void SolverRecorder::write(const triton::ast::SharedAbstractNode& node, const std::string& backend, triton::uint32 timeout, triton::engines::solver::status_e status, triton::uint32 solvingTime) {
+        std::map<triton::usize, triton::engines::symbolic::SharedSymbolicVariable> variables;
+        std::unordered_set<triton::usize> references;
+        std::ostringstream path;
+        std::ostringstream body;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverRecorder::write(): node cannot be null.");
+
+        if (!this->isEnabled())
+          return;
+
+        path << this->directory << "/query-" << std::setw(6) << std::setfill('0') << this->count << recordFormat::extension;
+
+        std::ofstream stream(path.str(), std::ios::out | std::ios::trunc);
+        if (!stream.is_open())
+          throw triton::exceptions::SolverEngine("SolverRecorder::write(): Cannot open " + path.str() + ".");
+
+        /* The AST representation mode is restored even if the lifting throws */
+        auto astCtxt = node->getContext();
+        RepresentationGuard guard(astCtxt, triton::ast::representations::SMT_REPRESENTATION);
+
+        auto nodes = triton::ast::childrenExtraction(node, true /* unroll*/, true /* revert */);
+
+        for (auto&& n : nodes) {
+          if (n->getType() == triton::ast::VARIABLE_NODE) {
+            const auto& var = reinterpret_cast<triton::ast::VariableNode*>(n.get())->getSymbolicVariable();
+            variables[var->getId()] = var;
+          }
+        }
+
+        for (const auto& var : variables)
+          body << astCtxt->declare(astCtxt->variable(var.second)) << std::endl;
+
+        /* References are defined before their users, children being on top of the list */
+        for (auto&& n : nodes) {
+          if (n->getType() == triton::ast::REFERENCE_NODE) {
+            const auto& expr = reinterpret_cast<triton::ast::ReferenceNode*>(n.get())->getSymbolicExpression();
+            if (references.insert(expr->getId()).second)
+              body << expr->getFormattedExpression() << std::endl;
+          }
+        }
+
+        body << "(assert " << node << ")" << std::endl;
+        body << "(check-sat)" << std::endl;
+
+        stream << recordFormat::prefix << "backend: " << backend << std::endl;
+        stream << recordFormat::prefix << "timeout: " << timeout << std::endl;
+        stream << recordFormat::prefix << "status: " << statusName(status) << std::endl;
+        stream << recordFormat::prefix << "time: " << solvingTime << std::endl;
+        for (const auto& var : variables) {
+          const auto& name = var.second->getAlias().empty() ? var.second->getName() : var.second->getAlias();
+          stream << recordFormat::prefix << "variable: " << name << " " << var.second->getSize() << std::endl;
+        }
+        stream << std::endl;
+
+        triton::engines::lifters::LiftingToSMT::requiredFunctions(stream);
+        stream << body.str();
+
+        this->count++;
+      }
+
+    };
+  };
+};
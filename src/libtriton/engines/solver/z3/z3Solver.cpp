@@ -6,6 +6,8 @@
 */
 
 #include <chrono>
+#include <limits>
+#include <mutex>
 #include <string>
 
 #include <triton/astContext.hpp>
@@ -23,6 +25,12 @@ namespace triton {
   namespace engines {
     namespace solver {
 
+      /* Returns the microseconds elapsed since `start` */
+      static triton::uint64 elapsed(const std::chrono::steady_clock::time_point& start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+      }
+
+
       z3::expr Z3Solver::mk_or(z3::expr_vector args) {
         std::vector<Z3_ast> array;
 
@@ -33,19 +41,75 @@ namespace triton {
       }
 
 
+      /* Registers the context of a query while it is solved, so that interrupt() can cancel it */
+      class Z3Solver::RunningContext {
+        private:
+          const Z3Solver* solver;
+          z3::context* ctx;
+
+        public:
+          RunningContext(const Z3Solver* solver, z3::context& ctx) : solver(solver), ctx(nullptr) {
+            std::lock_guard<std::mutex> lock(solver->runningLock);
+            if (!solver->interrupted) {
+              this->ctx = &ctx;
+              solver->running.insert(this->ctx);
+            }
+          }
+
+          ~RunningContext() {
+            if (this->ctx) {
+              std::lock_guard<std::mutex> lock(this->solver->runningLock);
+              this->solver->running.erase(this->ctx);
+            }
+          }
+
+          /* z3 drops an interrupt which lands before check() starts, so this is re-checked right before each check() */
+          bool isInterrupted(void) const {
+            std::lock_guard<std::mutex> lock(this->solver->runningLock);
+            return this->ctx == nullptr || this->solver->interrupted;
+          }
+      };
+
+
+      /* The counters of a query, published as the ones of the last query when it returns or throws */
+      class Z3Solver::QueryStats : public triton::engines::solver::SolverStats {
+        private:
+          const Z3Solver* solver;
+
+        public:
+          QueryStats(const Z3Solver* solver) : solver(solver) {
+            this->queries = 1;
+          }
+
+          ~QueryStats() {
+            std::lock_guard<std::mutex> lock(this->solver->statsLock);
+            this->solver->stats = *this;
+          }
+      };
+
+
       Z3Solver::Z3Solver() {
         this->timeout = 0;
         this->memoryLimit = 0;
+        this->seed = 0;
+        this->interrupted = false;
+        this->sessionScopes = 0;
       }
 
 
       std::vector<std::unordered_map<triton::usize, SolverModel>> Z3Solver::getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
+        return this->getModels(node, {}, limit, status, timeout, solvingTime);
+      }
+
+
+      std::vector<std::unordered_map<triton::usize, SolverModel>> Z3Solver::getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
         std::vector<std::unordered_map<triton::usize, SolverModel>> ret;
         triton::ast::SharedAbstractNode onode = node;
-        triton::ast::TritonToZ3 z3Ast{false};
+        std::unique_ptr<triton::ast::TritonToZ3> local;
+        std::unique_lock<std::mutex> shared(this->translatorLock, std::defer_lock);
+        triton::ast::TritonToZ3& z3Ast = this->getTranslator(shared, local);
 
-        std::string onodeString = triton::utils::toString(onode);
-        //std::cout << "onodeString: " << onodeString << std::endl;
+        QueryStats stats(this);
 
         try {
           if (onode == nullptr)
@@ -58,14 +122,22 @@ namespace triton {
           if (onode->isLogical() == false)
             throw triton::exceptions::SolverEngine("Z3Solver::getModels(): Must be a logical node.");
 
+          auto translation = std::chrono::steady_clock::now();
           z3::expr      expr = z3Ast.convert(onode);
-
-          std::string exprString = triton::utils::toString(expr);
-          //std::cout << "exprString: " << exprString << std::endl;
+          stats.translation = elapsed(translation);
+          stats.nodes = z3Ast.getTranslatedCount();
 
           z3::context&  ctx  = expr.ctx();
           z3::solver    solver(ctx);
 
+          /* The context is cancelled by interrupt() while the query is solved */
+          RunningContext running(this, ctx);
+          if (running.isInterrupted()) {
+            if (status)
+              *status = triton::engines::solver::UNKNOWN;
+            return {};
+          }
+
           /* Create a solver and add the expression */
           solver.add(expr);
 
@@ -84,13 +156,25 @@ namespace triton {
             p.set(":max_memory", this->memoryLimit);
           }
 
+          /* Define the random seed */
+          if (this->seed) {
+            p.set("random_seed", this->seed);
+          }
+
           solver.set(p);
 
           /* Get time of solving start */
           auto start = std::chrono::system_clock::now();
 
           /* Get first model */
+          if (running.isInterrupted()) {
+            if (status)
+              *status = triton::engines::solver::UNKNOWN;
+            return {};
+          }
+          auto check = std::chrono::steady_clock::now();
           z3::check_result res = solver.check();
+          stats.check += elapsed(check);
 
           /* Write back the status code of the first constraint */
           this->writeBackStatus(solver, res, status);
@@ -98,41 +182,50 @@ namespace triton {
           /* Check if it is sat */
           while (res == z3::sat && limit >= 1) {
             /* Get model */
+            auto model = std::chrono::steady_clock::now();
+            triton::uint64 numerals = 0;
             z3::model m = solver.get_model();
 
-            /* Traversing the model */
             std::unordered_map<triton::usize, SolverModel> smodel;
             z3::expr_vector args(ctx);
-            for (triton::uint32 i = 0; i < m.size(); i++) {
 
-              /* Get the z3 variable */
-              z3::func_decl z3Variable = m[i];
-
-              /* Get the name as std::string from a z3 variable */
-              std::string varName = z3Variable.name().str();
-
-              /* Get z3 expr */
-              z3::expr exp = m.get_const_interp(z3Variable);
-
-              /* Get the size of a z3 expr */
-              triton::uint32 bvSize = exp.get_sort().bv_size();
+            /* Records the value of a variable and blocks it for the next model */
+            auto record = [&](const triton::engines::symbolic::SharedSymbolicVariable& symVar, const z3::expr& constant, const z3::expr& exp) {
+              triton::uint512 value = 0;
+              triton::uint64 value64 = 0;
 
-              /* Get the value of a z3 expr */
-              std::string svalue = Z3_get_numeral_string(ctx, exp);
+              /* Small values are read directly, without going through a decimal string */
+              auto numeral = std::chrono::steady_clock::now();
+              if (exp.get_sort().bv_size() <= 64 && Z3_get_numeral_uint64(ctx, exp, &value64))
+                value = value64;
+              else
+                value = triton::uint512(Z3_get_numeral_string(ctx, exp));
+              numerals += elapsed(numeral);
 
-              /* Convert a string value to a integer value */
-              triton::uint512 value = triton::uint512(svalue.c_str());
-
-              /* Create a triton model */
-              SolverModel trionModel = SolverModel(z3Ast.variables[varName], value);
-
-              /* Map the result */
+              SolverModel trionModel = SolverModel(symVar, value);
               smodel[trionModel.getId()] = trionModel;
-
-              /* Uniq result */
-              if (exp.get_sort().is_bv())
-                args.push_back(ctx.bv_const(varName.c_str(), bvSize) != ctx.bv_val(svalue.c_str(), bvSize));
+              args.push_back(constant != exp);
+            };
+
+            if (projection.empty()) {
+              /* Traversing the model */
+              for (triton::uint32 i = 0; i < m.size(); i++) {
+                z3::func_decl z3Variable = m[i];
+                z3::expr exp = m.get_const_interp(z3Variable);
+                if (exp.get_sort().is_bv())
+                  record(z3Ast.variables[z3Variable.name().str()], z3Variable(), exp);
+              }
             }
+            else {
+              /* Only the projected variables are extracted and blocked, unconstrained ones being completed */
+              for (const auto& symVar : projection) {
+                z3::expr constant = ctx.bv_const(symVar->getName().c_str(), symVar->getSize());
+                record(symVar, constant, m.eval(constant, true));
+              }
+            }
+
+            stats.numeral += numerals;
+            stats.model   += elapsed(model) - numerals;
 
             /* Check that model is available */
             if (smodel.empty())
@@ -148,16 +241,11 @@ namespace triton {
               }
 
               /* Get next model */
+              if (running.isInterrupted())
+                break;
+              check = std::chrono::steady_clock::now();
               res = solver.check();
-
-              std::string resString = triton::utils::toString(res);
-              std::cout << "resString: " << resString << std::endl;
-
-              switch (res) {
-              case z3::sat:   std::cout << "It is valid\n"; break;
-              case z3::unsat:     std::cout << "It is not valid\n"; break;
-              case z3::unknown: std::cout << "unknown\n"; break;
-              }
+              stats.check += elapsed(check);
             }
           }
 
@@ -182,7 +270,8 @@ namespace triton {
 
 
       bool Z3Solver::isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const {
-        triton::ast::TritonToZ3 z3Ast{false};
+        std::unique_ptr<triton::ast::TritonToZ3> local;
+        std::unique_lock<std::mutex> shared(this->translatorLock, std::defer_lock);
 
         if (node == nullptr)
           throw triton::exceptions::SolverEngine("Z3Solver::isSat(): node cannot be null.");
@@ -190,11 +279,27 @@ namespace triton {
         if (node->isLogical() == false)
           throw triton::exceptions::SolverEngine("Z3Solver::isSat(): Must be a logical node.");
 
+        QueryStats stats(this);
+
         try {
+          triton::ast::TritonToZ3& z3Ast = this->getTranslator(shared, local);
+
+          auto translation = std::chrono::steady_clock::now();
           z3::expr      expr = z3Ast.convert(node);
+          stats.translation = elapsed(translation);
+          stats.nodes = z3Ast.getTranslatedCount();
+
           z3::context&  ctx  = expr.ctx();
           z3::solver    solver(ctx);
 
+          /* The context is cancelled by interrupt() while the query is solved */
+          RunningContext running(this, ctx);
+          if (running.isInterrupted()) {
+            if (status)
+              *status = triton::engines::solver::UNKNOWN;
+            return false;
+          }
+
           /* Create a solver and add the expression */
           solver.add(expr);
 
@@ -213,15 +318,26 @@ namespace triton {
             p.set(":max_memory", this->memoryLimit);
           }
 
+          /* Define the random seed */
+          if (this->seed) {
+            p.set("random_seed", this->seed);
+          }
+
           solver.set(p);
 
           /* Get time of solving start */
           auto start = std::chrono::system_clock::now();
 
+          if (running.isInterrupted()) {
+            if (status)
+              *status = triton::engines::solver::UNKNOWN;
+            return false;
+          }
           z3::check_result res = solver.check();
 
           /* Get time of solving end */
           auto end = std::chrono::system_clock::now();
+          stats.check = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
 
           if (solvingTime)
             *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
@@ -302,6 +418,25 @@ namespace triton {
       }
 
 
+      triton::ast::TritonToZ3& Z3Solver::getTranslator(std::unique_lock<std::mutex>& lock, std::unique_ptr<triton::ast::TritonToZ3>& local) const {
+        /* A query solved concurrently on the same instance cannot share the z3's context */
+        if (lock.try_lock()) {
+          if (this->translator == nullptr) {
+            this->translator.reset(new(std::nothrow) triton::ast::TritonToZ3(false));
+            if (this->translator == nullptr)
+              throw triton::exceptions::SolverEngine("Z3Solver::getTranslator(): Not enough memory.");
+          }
+          return *this->translator;
+        }
+
+        local.reset(new(std::nothrow) triton::ast::TritonToZ3(false));
+        if (local == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::getTranslator(): Not enough memory.");
+
+        return *local;
+      }
+
+
       void Z3Solver::writeBackStatus(z3::solver& solver, z3::check_result res, triton::engines::solver::status_e* status) const {
         if (status != nullptr) {
           switch (res) {
@@ -329,11 +464,191 @@ namespace triton {
       }
 
 
+      void Z3Solver::initSession(void) {
+        if (this->session != nullptr)
+          return;
+
+        this->sessionAst.reset(new(std::nothrow) triton::ast::TritonToZ3(false));
+        if (this->sessionAst == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::initSession(): Not enough memory.");
+
+        this->session.reset(new(std::nothrow) z3::solver(this->sessionAst->getContext()));
+        if (this->session == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::initSession(): Not enough memory.");
+      }
+
+
+      void Z3Solver::pushScope(void) {
+        this->initSession();
+        this->session->push();
+        this->sessionScopes++;
+      }
+
+
+      void Z3Solver::popScope(void) {
+        if (this->sessionScopes == 0)
+          throw triton::exceptions::SolverEngine("Z3Solver::popScope(): No scope to pop.");
+
+        this->session->pop();
+        this->sessionScopes--;
+      }
+
+
+      void Z3Solver::assertConstraint(const triton::ast::SharedAbstractNode& node) {
+        triton::ast::SharedAbstractNode onode = node;
+
+        if (onode == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Solver::assertConstraint(): node cannot be null.");
+
+        /* Z3 does not need an assert() as root node */
+        if (node->getType() == triton::ast::ASSERT_NODE)
+          onode = node->getChildren()[0];
+
+        if (onode->isLogical() == false)
+          throw triton::exceptions::SolverEngine("Z3Solver::assertConstraint(): Must be a logical node.");
+
+        try {
+          this->initSession();
+          this->session->add(this->sessionAst->convert(onode));
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::assertConstraint(): ") + e.msg());
+        }
+      }
+
+
+      std::unordered_map<triton::usize, SolverModel> Z3Solver::checkWithAssumption(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) {
+        std::unordered_map<triton::usize, SolverModel> ret;
+        triton::ast::SharedAbstractNode onode = node;
+
+        /* Z3 does not need an assert() as root node */
+        if (node != nullptr && node->getType() == triton::ast::ASSERT_NODE)
+          onode = node->getChildren()[0];
+
+        if (onode != nullptr && onode->isLogical() == false)
+          throw triton::exceptions::SolverEngine("Z3Solver::checkWithAssumption(): Must be a logical node.");
+
+        QueryStats stats(this);
+
+        /* The assumption lives in its own scope, so that it does not outlive this query */
+        bool scoped = false;
+
+        try {
+          this->initSession();
+
+          z3::context& ctx = this->sessionAst->getContext();
+
+          if (onode != nullptr) {
+            auto translation = std::chrono::steady_clock::now();
+            this->session->push();
+            scoped = true;
+            this->session->add(this->sessionAst->convert(onode));
+            stats.translation = elapsed(translation);
+            stats.nodes = this->sessionAst->getTranslatedCount();
+          }
+
+          z3::params p(ctx);
+
+          /* Define the timeout. The session keeps its parameters, so no timeout must be explicit */
+          triton::uint32 tmout = timeout ? timeout : this->timeout;
+          p.set(":timeout", tmout ? tmout : std::numeric_limits<unsigned>::max());
+
+          /* Define memory limit */
+          if (this->memoryLimit) {
+            p.set(":max_memory", this->memoryLimit);
+          }
+
+          this->session->set(p);
+
+          /* Get time of solving start */
+          auto start = std::chrono::system_clock::now();
+
+          z3::check_result res = this->session->check();
+
+          /* Get time of solving end */
+          auto end = std::chrono::system_clock::now();
+          stats.check = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+          if (solvingTime)
+            *solvingTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+          this->writeBackStatus(*this->session, res, status);
+
+          if (res == z3::sat) {
+            auto model = std::chrono::steady_clock::now();
+            z3::model m = this->session->get_model();
+            for (triton::uint32 i = 0; i < m.size(); i++) {
+              z3::func_decl z3Variable = m[i];
+
+              auto it = this->sessionAst->variables.find(z3Variable.name().str());
+              if (it == this->sessionAst->variables.end())
+                continue;
+
+              z3::expr exp = m.get_const_interp(z3Variable);
+              auto numeral = std::chrono::steady_clock::now();
+              triton::uint512 value = triton::uint512(Z3_get_numeral_string(ctx, exp));
+              stats.numeral += elapsed(numeral);
+
+              SolverModel trionModel = SolverModel(it->second, value);
+              ret[trionModel.getId()] = trionModel;
+            }
+            stats.model = elapsed(model) - stats.numeral;
+          }
+
+          if (scoped) {
+            scoped = false;
+            this->session->pop();
+          }
+        }
+        catch (const z3::exception& e) {
+          if (scoped) {
+            this->session->pop();
+          }
+          if (!strcmp(e.msg(), "max. memory exceeded")) {
+            if (status) {
+              *status = triton::engines::solver::OUTOFMEM;
+            }
+            return {};
+          }
+          throw triton::exceptions::SolverEngine(std::string("Z3Solver::checkWithAssumption(): ") + e.msg());
+        }
+        catch (...) {
+          if (scoped) {
+            this->session->pop();
+          }
+          throw;
+        }
+
+        return ret;
+      }
+
+
+      void Z3Solver::resetSession(void) {
+        /* The solver must be released before the context it belongs to */
+        this->session.reset();
+        this->sessionAst.reset();
+        this->sessionScopes = 0;
+      }
+
+
+      triton::usize Z3Solver::getSessionSize(void) const {
+        if (this->session == nullptr)
+          return 0;
+        return this->session->assertions().size();
+      }
+
+
       std::string Z3Solver::getName(void) const {
         return "z3";
       }
 
 
+      triton::engines::solver::SolverStats Z3Solver::getStats(void) const {
+        std::lock_guard<std::mutex> lock(this->statsLock);
+        return this->stats;
+      }
+
+
       void Z3Solver::setTimeout(triton::uint32 ms) {
         this->timeout = ms;
       }
@@ -343,6 +658,22 @@ namespace triton {
         this->memoryLimit = limit;
       }
 
+
+      void Z3Solver::setSeed(triton::uint32 seed) {
+        this->seed = seed;
+      }
+
+
+      void Z3Solver::interrupt(bool enable) {
+        std::lock_guard<std::mutex> lock(this->runningLock);
+
+        this->interrupted = enable;
+        if (enable) {
+          for (auto* ctx : this->running)
+            ctx->interrupt();
+        }
+      }
+
     };
   };
 };
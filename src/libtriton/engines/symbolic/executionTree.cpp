@@ -0,0 +1,265 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <memory>
+
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/executionTree.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      ExecutionTree::ExecutionTree() {
+        this->clear();
+      }
+
+
+      triton::usize& ExecutionTree::counter(triton::engines::symbolic::branch_e state) {
+        switch (state) {
+          case triton::engines::symbolic::UNEXPLORED_BRANCH:  return this->stats.unexplored;
+          case triton::engines::symbolic::PENDING_BRANCH:     return this->stats.pending;
+          case triton::engines::symbolic::EXPLORED_BRANCH:    return this->stats.explored;
+          case triton::engines::symbolic::INFEASIBLE_BRANCH:  return this->stats.infeasible;
+          case triton::engines::symbolic::TIMEOUT_BRANCH:     return this->stats.timeout;
+          default:
+            throw triton::exceptions::PathManager("ExecutionTree::counter(): Invalid branch state.");
+        }
+      }
+
+
+      void ExecutionTree::setState(triton::uint32 edge, triton::engines::symbolic::branch_e state) {
+        Edge& e = this->edges[edge];
+
+        if (e.state == state)
+          return;
+
+        this->counter(e.state)--;
+        this->counter(state)++;
+        e.state = state;
+        e.awaiting = false;
+
+        /* The predicates are only needed while the direction may be handed out */
+        if (state == triton::engines::symbolic::EXPLORED_BRANCH || state == triton::engines::symbolic::INFEASIBLE_BRANCH)
+          this->branches.erase(edge);
+      }
+
+
+      triton::uint32 ExecutionTree::getEdge(triton::uint32 node, triton::uint64 destination, bool& added) {
+        triton::uint32 last = ExecutionTree::none;
+
+        added = false;
+
+        for (triton::uint32 e = this->nodes[node].edges; e != ExecutionTree::none; e = this->edges[e].next) {
+          if (this->edges[e].destination == destination)
+            return e;
+          last = e;
+        }
+
+        if (this->edges.size() >= ExecutionTree::none)
+          throw triton::exceptions::PathManager("ExecutionTree::getEdge(): Too many branches.");
+
+        /* Edges keep the order of the branch constraints */
+        triton::uint32 edge = static_cast<triton::uint32>(this->edges.size());
+        this->edges.push_back({destination, node, ExecutionTree::none, ExecutionTree::none, triton::engines::symbolic::UNEXPLORED_BRANCH, 0, false});
+        this->stats.unexplored++;
+
+        if (last == ExecutionTree::none)
+          this->nodes[node].edges = edge;
+        else
+          this->edges[last].next = edge;
+        added = true;
+
+        return edge;
+      }
+
+
+      triton::uint32 ExecutionTree::getNode(triton::uint32 edge, triton::uint64 source, triton::uint32 threadId, bool& added) {
+        added = false;
+
+        for (triton::uint32 n = this->edges[edge].child; n != ExecutionTree::none; n = this->nodes[n].sibling) {
+          if (this->nodes[n].source == source && this->nodes[n].threadId == threadId)
+            return n;
+        }
+
+        if (this->nodes.size() >= ExecutionTree::none)
+          throw triton::exceptions::PathManager("ExecutionTree::getNode(): Too many branch instructions.");
+
+        triton::uint32 node = static_cast<triton::uint32>(this->nodes.size());
+        this->nodes.push_back({source, threadId, edge, this->edges[edge].child, ExecutionTree::none});
+        this->edges[edge].child = node;
+        this->stats.nodes++;
+        added = true;
+
+        return node;
+      }
+
+
+      triton::usize ExecutionTree::merge(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::usize followed) {
+        if (followed >= this->edges.size())
+          throw triton::exceptions::PathManager("ExecutionTree::merge(): Invalid branch id.");
+
+        auto path = std::make_shared<std::vector<triton::ast::SharedAbstractNode>>();
+        triton::usize length = 0;
+        triton::usize count = 0;
+        triton::uint32 edge = 0;
+
+        for (const auto& pc : pathConstraints) {
+          const auto& branches = pc.getBranchConstraints();
+          triton::uint32 taken = ExecutionTree::none;
+          triton::ast::SharedAbstractNode predicate;
+          bool added = false;
+
+          if (branches.empty())
+            continue;
+
+          triton::uint32 node = this->getNode(edge, std::get<1>(branches[0]), pc.getThreadId(), added);
+          count += added;
+
+          for (const auto& branch : branches) {
+            triton::uint32 e = this->getEdge(node, std::get<2>(branch), added);
+            if (std::get<0>(branch)) {
+              this->setState(e, triton::engines::symbolic::EXPLORED_BRANCH);
+              predicate = std::get<3>(branch);
+              taken = e;
+            }
+            /* A direction is queued once, when it is discovered */
+            else if (added) {
+              this->branches[e] = {std::get<3>(branch), path, path->size()};
+              this->frontier.push_back(e);
+              length = path->size();
+            }
+          }
+
+          if (taken == ExecutionTree::none)
+            throw triton::exceptions::PathManager("ExecutionTree::merge(): A path constraint has no taken branch.");
+
+          path->push_back(predicate);
+          edge = taken;
+        }
+
+        /* The predicates taken after the last discovered direction are not kept */
+        path->resize(length);
+
+        /* The satisfiable direction followed by the run diverged from its model if the run did not take it */
+        if (followed != 0 && this->edges[followed].awaiting) {
+          triton::uint32 e = static_cast<triton::uint32>(followed);
+          this->stats.diverged++;
+          if (++this->edges[e].divergences < 2) {
+            this->setState(e, triton::engines::symbolic::UNEXPLORED_BRANCH);
+            this->frontier.push_back(e);
+          }
+          else {
+            this->setState(e, triton::engines::symbolic::TIMEOUT_BRANCH);
+          }
+        }
+
+        return count;
+      }
+
+
+      bool ExecutionTree::getNextFrontier(ExecutionFrontier& frontier) {
+        while (!this->frontier.empty()) {
+          triton::uint32 edge = this->frontier.front();
+          this->frontier.pop_front();
+
+          /* A later run may have taken the direction */
+          if (this->edges[edge].state != triton::engines::symbolic::UNEXPLORED_BRANCH)
+            continue;
+
+          this->setState(edge, triton::engines::symbolic::PENDING_BRANCH);
+
+          const Edge& e = this->edges[edge];
+          const Node& n = this->nodes[e.node];
+          const Branch& b = this->branches.at(edge);
+          std::vector<triton::ast::SharedAbstractNode> predicates(b.path->begin(), b.path->begin() + b.length);
+
+          auto astCtxt = b.predicate->getContext();
+
+          frontier.id          = edge;
+          frontier.source      = n.source;
+          frontier.destination = e.destination;
+          frontier.threadId    = n.threadId;
+
+          switch (predicates.size()) {
+            case 0:  frontier.prefix = nullptr; break;
+            case 1:  frontier.prefix = predicates[0]; break;
+            default: frontier.prefix = astCtxt->land(predicates); break;
+          }
+
+          predicates.push_back(b.predicate);
+          frontier.predicate = (predicates.size() == 1) ? b.predicate : astCtxt->land(predicates);
+
+          return true;
+        }
+
+        return false;
+      }
+
+
+      void ExecutionTree::resolve(triton::usize id, triton::engines::solver::status_e status) {
+        if (this->getState(id) != triton::engines::symbolic::PENDING_BRANCH)
+          return;
+
+        switch (status) {
+          case triton::engines::solver::SAT:
+            this->edges[id].awaiting = true;
+            break;
+          case triton::engines::solver::UNSAT:
+            this->setState(static_cast<triton::uint32>(id), triton::engines::symbolic::INFEASIBLE_BRANCH);
+            break;
+          default:
+            this->setState(static_cast<triton::uint32>(id), triton::engines::symbolic::TIMEOUT_BRANCH);
+            break;
+        }
+      }
+
+
+      void ExecutionTree::retryTimeouts(void) {
+        for (triton::uint32 edge = 1; edge < this->edges.size(); edge++) {
+          if (this->edges[edge].state == triton::engines::symbolic::TIMEOUT_BRANCH) {
+            this->setState(edge, triton::engines::symbolic::UNEXPLORED_BRANCH);
+            this->frontier.push_back(edge);
+          }
+        }
+      }
+
+
+      triton::engines::symbolic::branch_e ExecutionTree::getState(triton::usize id) const {
+        if (id == 0 || id >= this->edges.size())
+          throw triton::exceptions::PathManager("ExecutionTree::getState(): Invalid branch id.");
+        return this->edges[id].state;
+      }
+
+
+      const triton::engines::symbolic::ExecutionTreeStats& ExecutionTree::getStats(void) const {
+        return this->stats;
+      }
+
+
+      triton::usize ExecutionTree::size(void) const {
+        return this->nodes.size();
+      }
+
+
+      void ExecutionTree::clear(void) {
+        this->nodes.clear();
+        this->edges.clear();
+        this->frontier.clear();
+        this->branches.clear();
+        this->stats = triton::engines::symbolic::ExecutionTreeStats();
+
+        /* The virtual edge leading to the roots is not counted */
+        this->edges.push_back({0, ExecutionTree::none, ExecutionTree::none, ExecutionTree::none, triton::engines::symbolic::EXPLORED_BRANCH, 0, false});
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
@@ -0,0 +1,426 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/functionSummaries.hpp>
+#include <triton/memoryAccess.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      FunctionSummaries::FunctionSummaries(triton::arch::Architecture* architecture,
+                                           const triton::modes::SharedModes& modes,
+                                           triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                           triton::engines::taint::TaintEngine* taintEngine,
+                                           const triton::ast::SharedAstContext& astCtxt)
+        : astCtxt(astCtxt), modes(modes) {
+
+        if (architecture == nullptr)
+          throw triton::exceptions::FunctionSummaries("FunctionSummaries::FunctionSummaries(): The architecture API must be defined.");
+
+        if (symbolicEngine == nullptr)
+          throw triton::exceptions::FunctionSummaries("FunctionSummaries::FunctionSummaries(): The symbolic engine API must be defined.");
+
+        if (taintEngine == nullptr)
+          throw triton::exceptions::FunctionSummaries("FunctionSummaries::FunctionSummaries(): The taint engines API must be defined.");
+
+        this->architecture   = architecture;
+        this->symbolicEngine = symbolicEngine;
+        this->taintEngine    = taintEngine;
+        this->bound          = 64;
+        this->abi            = DEFAULT_ABI;
+      }
+
+
+      bool FunctionSummaries::getKind(const std::string& name, summary_e& kind) {
+        static const std::map<std::string, summary_e> kinds = {
+          {"memcmp",  SUMMARY_MEMCMP},
+          {"memcpy",  SUMMARY_MEMCPY},
+          {"memmove", SUMMARY_MEMMOVE},
+          {"mempcpy", SUMMARY_MEMPCPY},
+          {"memset",  SUMMARY_MEMSET},
+          {"strcmp",  SUMMARY_STRCMP},
+          {"strlen",  SUMMARY_STRLEN},
+          {"strncmp", SUMMARY_STRNCMP},
+          {"strnlen", SUMMARY_STRNLEN},
+        };
+
+        auto it = kinds.find(name);
+        if (it == kinds.end())
+          return false;
+
+        kind = it->second;
+        return true;
+      }
+
+
+      bool FunctionSummaries::isSupported(const std::string& name) {
+        summary_e kind;
+        return FunctionSummaries::getKind(name, kind);
+      }
+
+
+      triton::engines::symbolic::abi_e FunctionSummaries::getAbi(triton::engines::symbolic::abi_e abi) const {
+        switch (this->architecture->getArchitecture()) {
+          case triton::arch::ARCH_X86:
+            if (abi == DEFAULT_ABI || abi == SYSTEMV_ABI)
+              return SYSTEMV_ABI;
+            break;
+
+          case triton::arch::ARCH_X86_64:
+            if (abi == DEFAULT_ABI || abi == SYSTEMV_ABI)
+              return SYSTEMV_ABI;
+            if (abi == MS_ABI)
+              return MS_ABI;
+            break;
+
+          case triton::arch::ARCH_AARCH64:
+            if (abi == DEFAULT_ABI || abi == AAPCS64_ABI)
+              return AAPCS64_ABI;
+            break;
+
+          default:
+            throw triton::exceptions::FunctionSummaries("FunctionSummaries::getAbi(): Architecture not supported.");
+        }
+
+        throw triton::exceptions::FunctionSummaries("FunctionSummaries::getAbi(): Calling convention not supported by the architecture.");
+      }
+
+
+      void FunctionSummaries::addSummary(triton::uint64 addr, const std::string& name, triton::engines::symbolic::abi_e abi) {
+        summary_e kind;
+
+        if (FunctionSummaries::getKind(name, kind) == false)
+          throw triton::exceptions::FunctionSummaries("FunctionSummaries::addSummary(): No summary for " + name + ".");
+
+        this->summaries[addr] = std::make_tuple(name, kind, this->getAbi(abi));
+      }
+
+
+      triton::usize FunctionSummaries::addSummaries(triton::uint64 base, const std::map<std::string, triton::uint64>& symbols, triton::engines::symbolic::abi_e abi) {
+        triton::usize count = 0;
+
+        /* Reject the whole map before registering anything */
+        abi = this->getAbi(abi);
+
+        for (const auto& symbol : symbols) {
+          if (FunctionSummaries::isSupported(symbol.first)) {
+            this->addSummary(base + symbol.second, symbol.first, abi);
+            count++;
+          }
+        }
+
+        return count;
+      }
+
+
+      void FunctionSummaries::clearSummaries(void) {
+        this->summaries.clear();
+        this->hits.clear();
+      }
+
+
+      bool FunctionSummaries::isSummarized(triton::uint64 addr) const {
+        if (this->summaries.empty())
+          return false;
+        return this->summaries.find(addr) != this->summaries.end();
+      }
+
+
+      void FunctionSummaries::setBound(triton::uint32 bound) {
+        this->bound = bound;
+      }
+
+
+      triton::uint32 FunctionSummaries::getBound(void) const {
+        return this->bound;
+      }
+
+
+      const std::map<std::string, triton::usize>& FunctionSummaries::getHits(void) const {
+        return this->hits;
+      }
+
+
+      triton::arch::OperandWrapper FunctionSummaries::getArgument(triton::uint32 index) const {
+        static const triton::arch::register_e systemv[] = {triton::arch::ID_REG_X86_RDI, triton::arch::ID_REG_X86_RSI, triton::arch::ID_REG_X86_RDX};
+        static const triton::arch::register_e ms[] = {triton::arch::ID_REG_X86_RCX, triton::arch::ID_REG_X86_RDX, triton::arch::ID_REG_X86_R8};
+        static const triton::arch::register_e aarch64[] = {triton::arch::ID_REG_AARCH64_X0, triton::arch::ID_REG_AARCH64_X1, triton::arch::ID_REG_AARCH64_X2};
+
+        switch (this->architecture->getArchitecture()) {
+          case triton::arch::ARCH_X86_64:
+            if (this->abi == MS_ABI)
+              return triton::arch::OperandWrapper(this->architecture->getRegister(ms[index]));
+            return triton::arch::OperandWrapper(this->architecture->getRegister(systemv[index]));
+
+          case triton::arch::ARCH_AARCH64:
+            return triton::arch::OperandWrapper(this->architecture->getRegister(aarch64[index]));
+
+          /* cdecl, arguments are pushed on the stack above the return address */
+          case triton::arch::ARCH_X86: {
+            const triton::arch::Register& stack = this->architecture->getStackPointer();
+            triton::uint64 sp = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(stack));
+            return triton::arch::OperandWrapper(triton::arch::MemoryAccess(sp + (index + 1) * triton::size::dword, triton::size::dword));
+          }
+
+          default:
+            throw triton::exceptions::FunctionSummaries("FunctionSummaries::getArgument(): Architecture not supported.");
+        }
+      }
+
+
+      triton::uint64 FunctionSummaries::getConcreteArgument(triton::arch::Instruction& inst, triton::uint32 index) {
+        return static_cast<triton::uint64>(this->symbolicEngine->getOperandAst(inst, this->getArgument(index))->evaluate());
+      }
+
+
+      const triton::arch::Register& FunctionSummaries::getReturnRegister(void) const {
+        switch (this->architecture->getArchitecture()) {
+          case triton::arch::ARCH_X86_64:
+            return this->architecture->getRegister(triton::arch::ID_REG_X86_RAX);
+
+          case triton::arch::ARCH_X86:
+            return this->architecture->getRegister(triton::arch::ID_REG_X86_EAX);
+
+          case triton::arch::ARCH_AARCH64:
+            return this->architecture->getRegister(triton::arch::ID_REG_AARCH64_X0);
+
+          default:
+            throw triton::exceptions::FunctionSummaries("FunctionSummaries::getReturnRegister(): Architecture not supported.");
+        }
+      }
+
+
+      void FunctionSummaries::setReturnValue(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, bool tainted) {
+        auto dst  = triton::arch::OperandWrapper(this->getReturnRegister());
+        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "Return value");
+        expr->isTainted = this->taintEngine->setTaint(dst, tainted);
+      }
+
+
+      /* Same as the ret instruction of the stub */
+      void FunctionSummaries::returnToCaller(triton::arch::Instruction& inst) {
+        auto pc = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+
+        if (this->architecture->getArchitecture() == triton::arch::ARCH_AARCH64) {
+          auto lr   = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::ID_REG_AARCH64_X30));
+          auto expr = this->symbolicEngine->createSymbolicExpression(inst, this->symbolicEngine->getOperandAst(inst, lr), pc, "Program Counter");
+          expr->isTainted = this->taintEngine->taintAssignment(pc, lr);
+          inst.setControlFlow(true);
+          this->symbolicEngine->pushPathConstraint(inst, expr);
+          return;
+        }
+
+        const triton::arch::Register& stack = this->architecture->getStackPointer();
+        triton::uint64 stackValue = static_cast<triton::uint64>(this->architecture->getConcreteRegisterValue(stack));
+        auto sp   = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
+        auto dst  = triton::arch::OperandWrapper(stack);
+        auto expr = this->symbolicEngine->createSymbolicExpression(inst, this->symbolicEngine->getOperandAst(inst, sp), pc, "Program Counter");
+        expr->isTainted = this->taintEngine->taintAssignment(pc, sp);
+
+        auto node = this->astCtxt->bvadd(this->symbolicEngine->getOperandAst(inst, dst), this->astCtxt->bv(stack.getSize(), dst.getBitSize()));
+        auto alig = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "Stack alignment");
+        alig->isTainted = this->taintEngine->isTainted(dst);
+
+        inst.setControlFlow(true);
+        this->symbolicEngine->pushPathConstraint(inst, expr);
+      }
+
+
+      /* memcpy, memmove and mempcpy: expressions of the source bytes are shared with the destination */
+      void FunctionSummaries::copy(triton::arch::Instruction& inst, bool end) {
+        auto dstOp         = this->getArgument(0);
+        auto dstNode       = this->symbolicEngine->getOperandAst(inst, dstOp);
+        triton::uint64 dst = static_cast<triton::uint64>(dstNode->evaluate());
+        triton::uint64 src = this->getConcreteArgument(inst, 1);
+        triton::usize size = static_cast<triton::usize>(this->getConcreteArgument(inst, 2));
+
+        std::vector<triton::uint8> values = this->architecture->getConcreteMemoryAreaValue(src, size);
+        std::vector<bool> tainted(size);
+
+        for (triton::usize index = 0; index < size; index++) {
+          tainted[index] = this->taintEngine->isMemoryTainted(src + index);
+        }
+
+        if (this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY)) {
+          std::vector<triton::ast::SharedAbstractNode> nodes;
+          nodes.reserve(size);
+          for (triton::usize index = 0; index < size; index++) {
+            nodes.push_back(this->symbolicEngine->getMemoryAst(triton::arch::MemoryAccess(src + index, triton::size::byte)));
+          }
+          for (triton::usize index = 0; index < size; index++) {
+            this->symbolicEngine->createSymbolicMemoryExpression(inst, nodes[index], triton::arch::MemoryAccess(dst + index, triton::size::byte), "Copy summary");
+          }
+        }
+        else {
+          this->symbolicEngine->copySymbolicMemory(dst, src, size);
+        }
+
+        this->architecture->setConcreteMemoryAreaValue(dst, values);
+        for (triton::usize index = 0; index < size; index++) {
+          this->taintEngine->setTaintMemory(triton::arch::MemoryAccess(dst + index, triton::size::byte), tainted[index]);
+        }
+
+        if (end) {
+          dstNode = this->astCtxt->bvadd(dstNode, this->astCtxt->bv(size, dstNode->getBitvectorSize()));
+        }
+
+        this->setReturnValue(inst, dstNode, this->taintEngine->isTainted(dstOp));
+      }
+
+
+      /* memset */
+      void FunctionSummaries::set(triton::arch::Instruction& inst) {
+        auto dstOp         = this->getArgument(0);
+        auto valOp         = this->getArgument(1);
+        auto dstNode       = this->symbolicEngine->getOperandAst(inst, dstOp);
+        auto byte          = this->astCtxt->extract(7, 0, this->symbolicEngine->getOperandAst(inst, valOp));
+        triton::uint64 dst = static_cast<triton::uint64>(dstNode->evaluate());
+        triton::usize size = static_cast<triton::usize>(this->getConcreteArgument(inst, 2));
+        bool tainted       = this->taintEngine->isTainted(valOp);
+
+        if (byte->isSymbolized()) {
+          for (triton::usize index = 0; index < size; index++) {
+            this->symbolicEngine->createSymbolicMemoryExpression(inst, byte, triton::arch::MemoryAccess(dst + index, triton::size::byte), "Set summary");
+          }
+        }
+        else {
+          for (triton::usize index = 0; index < size; index++) {
+            this->symbolicEngine->concretizeMemory(dst + index);
+          }
+        }
+
+        this->architecture->setConcreteMemoryAreaValue(dst, std::vector<triton::uint8>(size, static_cast<triton::uint8>(byte->evaluate())));
+        for (triton::usize index = 0; index < size; index++) {
+          this->taintEngine->setTaintMemory(triton::arch::MemoryAccess(dst + index, triton::size::byte), tainted);
+        }
+
+        this->setReturnValue(inst, dstNode, this->taintEngine->isTainted(dstOp));
+      }
+
+
+      /*
+       * strlen and strnlen: the result is an ITE chain over the symbolic bytes
+       * located before the concrete terminator, at most `bound` of them.
+       */
+      void FunctionSummaries::length(triton::arch::Instruction& inst, bool bounded) {
+        triton::uint32 bits = this->getReturnRegister().getBitSize();
+        triton::uint64 str  = this->getConcreteArgument(inst, 0);
+        triton::uint64 max  = bounded ? this->getConcreteArgument(inst, 1) : std::numeric_limits<triton::uint64>::max();
+        triton::uint64 len  = 0;
+        bool tainted        = false;
+
+        while (len < max && this->architecture->getConcreteMemoryValue(str + len) != 0) {
+          tainted |= this->taintEngine->isMemoryTainted(str + len);
+          len++;
+        }
+
+        auto node = this->astCtxt->bv(len, bits);
+        for (triton::uint64 index = std::min<triton::uint64>(len, this->bound); index-- > 0;) {
+          auto byte = this->symbolicEngine->getMemoryAst(inst, triton::arch::MemoryAccess(str + index, triton::size::byte));
+          /* A concrete byte located before the terminator is never null */
+          if (byte->isSymbolized() == false)
+            continue;
+          node = this->astCtxt->ite(this->astCtxt->equal(byte, this->astCtxt->bv(0, triton::bitsize::byte)), this->astCtxt->bv(index, bits), node);
+        }
+
+        this->setReturnValue(inst, node, tainted);
+      }
+
+
+      /*
+       * strcmp, strncmp and memcmp: the result is an ITE chain over the bytes
+       * located before the first concrete difference, at most `bound` of them.
+       */
+      void FunctionSummaries::compare(triton::arch::Instruction& inst, bool bounded, bool string) {
+        triton::uint32 bits = this->getReturnRegister().getBitSize();
+        triton::uint64 s1   = this->getConcreteArgument(inst, 0);
+        triton::uint64 s2   = this->getConcreteArgument(inst, 1);
+        triton::uint64 max  = bounded ? this->getConcreteArgument(inst, 2) : std::numeric_limits<triton::uint64>::max();
+        triton::uint64 end  = 0;
+        bool tainted        = false;
+
+        while (end < max) {
+          triton::uint8 c1 = this->architecture->getConcreteMemoryValue(s1 + end);
+          triton::uint8 c2 = this->architecture->getConcreteMemoryValue(s2 + end);
+          tainted |= this->taintEngine->isMemoryTainted(s1 + end) || this->taintEngine->isMemoryTainted(s2 + end);
+          if (c1 != c2 || (string && c1 == 0))
+            break;
+          end++;
+        }
+
+        auto diff = [&](triton::uint64 index) {
+          auto b1 = this->symbolicEngine->getMemoryAst(inst, triton::arch::MemoryAccess(s1 + index, triton::size::byte));
+          auto b2 = this->symbolicEngine->getMemoryAst(inst, triton::arch::MemoryAccess(s2 + index, triton::size::byte));
+          return std::make_tuple(b1, b2, this->astCtxt->bvsub(this->astCtxt->zx(bits - triton::bitsize::byte, b1), this->astCtxt->zx(bits - triton::bitsize::byte, b2)));
+        };
+
+        triton::ast::SharedAbstractNode node = this->astCtxt->bv(0, bits);
+        if (end < max) {
+          node = std::get<2>(diff(end));
+        }
+
+        /* Bytes beyond the bound keep their concrete outcome */
+        triton::uint64 start = end;
+        if (end > this->bound) {
+          node  = this->astCtxt->bv(node->evaluate(), bits);
+          start = this->bound;
+        }
+
+        for (triton::uint64 index = start; index-- > 0;) {
+          auto d = diff(index);
+          if (std::get<0>(d)->isSymbolized() == false && std::get<1>(d)->isSymbolized() == false)
+            continue;
+          auto cond = this->astCtxt->lnot(this->astCtxt->equal(std::get<0>(d), std::get<1>(d)));
+          if (string)
+            cond = this->astCtxt->lor(cond, this->astCtxt->equal(std::get<0>(d), this->astCtxt->bv(0, triton::bitsize::byte)));
+          node = this->astCtxt->ite(cond, std::get<2>(d), node);
+        }
+
+        this->setReturnValue(inst, node, tainted);
+      }
+
+
+      triton::arch::exception_e FunctionSummaries::apply(triton::arch::Instruction& inst) {
+        auto it = this->summaries.find(inst.getAddress());
+        if (it == this->summaries.end())
+          throw triton::exceptions::FunctionSummaries("FunctionSummaries::apply(): No summary at this address.");
+
+        /* The architecture may have changed since the summary was registered */
+        this->abi = this->getAbi(std::get<2>(it->second));
+
+        switch (std::get<1>(it->second)) {
+          case SUMMARY_MEMCMP:  this->compare(inst, true, false); break;
+          case SUMMARY_MEMCPY:  this->copy(inst, false);          break;
+          case SUMMARY_MEMMOVE: this->copy(inst, false);          break;
+          case SUMMARY_MEMPCPY: this->copy(inst, true);           break;
+          case SUMMARY_MEMSET:  this->set(inst);                  break;
+          case SUMMARY_STRCMP:  this->compare(inst, false, true); break;
+          case SUMMARY_STRLEN:  this->length(inst, false);        break;
+          case SUMMARY_STRNCMP: this->compare(inst, true, true);  break;
+          case SUMMARY_STRNLEN: this->length(inst, true);         break;
+        }
+
+        this->returnToCaller(inst);
+        inst.setDisassembly(std::get<0>(it->second) + " (summary)");
+        this->hits[std::get<0>(it->second)]++;
+
+        return triton::arch::NO_FAULT;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
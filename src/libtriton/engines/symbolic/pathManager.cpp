@@ -24,6 +24,7 @@ namespace triton {
       PathManager::PathManager(const PathManager& other)
         : modes(other.modes), astCtxt(other.astCtxt) {
         this->pathConstraints = other.pathConstraints;
+        this->executionTree   = other.executionTree;
       }
 
 
@@ -31,6 +32,7 @@ namespace triton {
         this->astCtxt         = other.astCtxt;
         this->modes           = other.modes;
         this->pathConstraints = other.pathConstraints;
+        this->executionTree   = other.executionTree;
         return *this;
       }
 
@@ -272,6 +274,22 @@ namespace triton {
         this->pathConstraints.clear();
       }
 
+
+      /* Merges the current path constraints into the execution tree. */
+      triton::usize PathManager::mergePathConstraints(triton::usize frontier) {
+        return this->executionTree.merge(this->pathConstraints, frontier);
+      }
+
+
+      triton::engines::symbolic::ExecutionTree& PathManager::getExecutionTree(void) {
+        return this->executionTree;
+      }
+
+
+      const triton::engines::symbolic::ExecutionTree& PathManager::getExecutionTree(void) const {
+        return this->executionTree;
+      }
+
     }; /* symbolic namespace */
   }; /* engines namespace */
 }; /*triton namespace */
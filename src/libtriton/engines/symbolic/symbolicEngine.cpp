@@ -8,6 +8,7 @@
 #include <cstring>
 #include <new>
 #include <set>
+#include <unordered_set>
 
 #include <triton/exceptions.hpp>
 #include <triton/coreUtils.hpp>
@@ -39,6 +40,9 @@ namespace triton {
         this->uniqueSymExprId   = 0;
         this->uniqueSymVarId    = 0;
         this->memoryArray       = nullptr;
+        this->lazyInstruction   = nullptr;
+        this->lazyAddress       = 0;
+        this->deferredFlags     = false;
 
         this->symbolicReg.resize(this->numberOfRegisters);
       }
@@ -61,11 +65,19 @@ namespace triton {
         this->symbolicVariables      = other.symbolicVariables;
         this->uniqueSymExprId        = other.uniqueSymExprId;
         this->uniqueSymVarId         = other.uniqueSymVarId;
+        this->budget                 = other.budget;
+        this->budgetStats            = other.budgetStats;
+        this->lazyFlags              = other.lazyFlags;
+        this->lazyDisassembly        = other.lazyDisassembly;
+        this->lazyInstruction        = other.lazyInstruction;
+        this->lazyAddress            = other.lazyAddress;
+        this->deferredFlags          = other.deferredFlags;
       }
 
 
       SymbolicEngine::~SymbolicEngine() {
         /* See #828: Release ownership before calling container destructor */
+        this->lazyFlags.clear();
         this->memoryBitvector.clear();
         this->symbolicReg.clear();
         this->memoryArray = nullptr;
@@ -88,6 +100,13 @@ namespace triton {
         this->symbolicVariables      = other.symbolicVariables;
         this->uniqueSymExprId        = other.uniqueSymExprId;
         this->uniqueSymVarId         = other.uniqueSymVarId;
+        this->budget                 = other.budget;
+        this->budgetStats            = other.budgetStats;
+        this->lazyFlags              = other.lazyFlags;
+        this->lazyDisassembly        = other.lazyDisassembly;
+        this->lazyInstruction        = other.lazyInstruction;
+        this->lazyAddress            = other.lazyAddress;
+        this->deferredFlags          = other.deferredFlags;
 
         return *this;
       }
@@ -101,6 +120,23 @@ namespace triton {
       void SymbolicEngine::concretizeRegister(const triton::arch::Register& reg) {
         triton::arch::register_e parentId = reg.getParent();
 
+        /* A pending flag must synchronize its concrete value first */
+        this->materializeLazyFlag(parentId);
+
+        if (this->architecture->isRegisterValid(parentId)) {
+          this->symbolicReg[parentId] = nullptr;
+        }
+      }
+
+
+      /* Same as concretizeRegister but the previous value of the register is not needed */
+      void SymbolicEngine::concretizeOverwrittenRegister(const triton::arch::Register& reg) {
+        triton::arch::register_e parentId = reg.getParent();
+
+        if (!this->lazyFlags.empty()) {
+          this->lazyFlags.erase(parentId);
+        }
+
         if (this->architecture->isRegisterValid(parentId)) {
           this->symbolicReg[parentId] = nullptr;
         }
@@ -109,6 +145,7 @@ namespace triton {
 
       /* Same as concretizeRegister but with all registers */
       void SymbolicEngine::concretizeAllRegister(void) {
+        this->materializeLazyFlags();
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
           this->symbolicReg[i] = nullptr;
         }
@@ -150,6 +187,32 @@ namespace triton {
       }
 
 
+      /* Copies the symbolic expressions of a memory area. Overlapping areas are handled like memmove */
+      void SymbolicEngine::copySymbolicMemory(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        std::vector<SharedSymbolicExpression> exprs;
+
+        if (this->isArrayMode()) {
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::copySymbolicMemory(): Not supported with the MEMORY_ARRAY mode.");
+        }
+
+        /* Snapshot the source first, the areas may overlap */
+        exprs.reserve(size);
+        for (triton::usize index = 0; index < size; index++) {
+          exprs.push_back(this->getSymbolicMemory(src + index));
+        }
+
+        this->removeAlignedMemory(dst, static_cast<triton::uint32>(size));
+        for (triton::usize index = 0; index < size; index++) {
+          if (exprs[index] != nullptr) {
+            this->addBitvectorMemory(dst + index, exprs[index]);
+          }
+          else {
+            this->memoryBitvector.erase(dst + index);
+          }
+        }
+      }
+
+
       /* Same as concretizeMemory but with all address memory */
       void SymbolicEngine::concretizeAllMemory(void) {
         this->memoryArray = nullptr;          /* abv logic */
@@ -222,6 +285,48 @@ namespace triton {
       }
 
 
+      /*
+       * Returns the forwarded AST if every byte of [address, address+size) is an
+       * extract of the same stored AST at consecutive offsets. This is the shape
+       * produced by createSymbolicMemoryExpression, assignSymbolicExpressionToMemory
+       * and symbolizeMemory. Otherwise returns nullptr.
+       */
+      triton::ast::SharedAbstractNode SymbolicEngine::getForwardedMemory(triton::uint64 address, triton::uint32 size) const {
+        triton::ast::SharedAbstractNode origin = nullptr;
+        triton::uint32 low = 0;
+
+        for (triton::uint32 index = 0; index < size; index++) {
+          const SharedSymbolicExpression& symMem = this->getSymbolicMemory(address + index);
+          if (symMem == nullptr) {
+            return nullptr;
+          }
+
+          const triton::ast::SharedAbstractNode& cell = symMem->getAst();
+          if (cell->getType() != triton::ast::EXTRACT_NODE) {
+            return nullptr;
+          }
+
+          auto& children = cell->getChildren();
+          auto  hi       = triton::ast::getInteger<triton::uint32>(children[0]);
+          auto  lo       = triton::ast::getInteger<triton::uint32>(children[1]);
+
+          if ((hi - lo + 1) != bitsize::byte) {
+            return nullptr;
+          }
+
+          if (index == 0) {
+            origin = children[2];
+            low    = lo;
+          }
+          else if (children[2] != origin || lo != low + (index * bitsize::byte)) {
+            return nullptr;
+          }
+        }
+
+        return this->astCtxt->extract(low + (size * bitsize::byte) - 1, low, origin);
+      }
+
+
       /* Returns the reference memory if it's referenced otherwise returns nullptr */
       SharedSymbolicExpression SymbolicEngine::getSymbolicMemory(triton::uint64 addr) const {
         auto it = this->memoryBitvector.find(addr);
@@ -391,6 +496,14 @@ namespace triton {
 
       /* Creates a new symbolic expression with comment */
       SharedSymbolicExpression SymbolicEngine::newSymbolicExpression(const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type, const std::string& comment) {
+        /* Replaces the AST by its concrete value if it exceeds the budget */
+        if (this->modes->isModeEnabled(triton::modes::CONCRETIZE_ON_BUDGET)) {
+          triton::ast::SharedAbstractNode cst = this->applyConcretizationBudget(node);
+          if (cst != nullptr) {
+            return this->newSymbolicExpression(cst, type, comment);
+          }
+        }
+
         if (this->modes->isModeEnabled(triton::modes::AST_OPTIMIZATIONS)) {
           /*
            * Create volatile expression for extended part to avoid long
@@ -410,24 +523,13 @@ namespace triton {
         /* Each symbolic expression must have an unique id */
         triton::usize id = this->getUniqueSymExprId();
 
-        std::string nodeStr = triton::utils::toString(node);
-   /*     std::cout << "nodeStr: " << nodeStr << std::endl;*/
         /* Performes transformation if there are rules recorded */
         const triton::ast::SharedAbstractNode& snode = this->simplify(node);
-        std::string snodeStr = triton::utils::toString(snode);
-        //std::cout << "sondeStr: " << snodeStr << std::endl;
 
-        
         /* Allocates the new shared symbolic expression */
         SharedSymbolicExpression expr = std::make_shared<SymbolicExpression>(snode, id, type, comment);
         if (comment == "COMISS operation")
           expr->fp32 = true;
-        std::string exprStr = triton::utils::toString(expr);
-        //std::cout << "exprStr: " << exprStr << std::endl;
-        std::string exprAstStr = triton::utils::toString(expr->getAst());
-        //std::cout << "exprAstStr: " << exprAstStr << std::endl;
-        std::string exprAstUnrollStr = triton::utils::toString(unroll(expr->getAst()));
-        //std::cout << "exprAstUnrollStr: " << exprAstUnrollStr << std::endl;
 
         if (expr == nullptr) {
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicExpression(): not enough memory");
@@ -638,13 +740,13 @@ namespace triton {
             this->addBitvectorMemory(memAddr + index, se);
           }
         }
-        std::string symVarStr = triton::utils::toString(symVar);
-     /*   std::cout << "symVarStr: " << symVarStr << std::endl;*/
         return symVar; 
       }
 
 
       SharedSymbolicVariable SymbolicEngine::symbolizeRegister(const triton::arch::Register& reg, const std::string& symVarAlias) {
+        this->materializeLazyFlag(reg.getParent());
+
         const triton::arch::Register& parent  = this->architecture->getRegister(reg.getParent());
         triton::uint32 symVarSize             = reg.getBitSize();
         triton::uint512 cv                    = this->architecture->getConcreteRegisterValue(reg);
@@ -891,6 +993,17 @@ namespace triton {
           return this->getAlignedMemory(address, size)->getAst();
         }
 
+        /*
+         * Symbolic optimization
+         * If all bytes of the access come from the same store, extract them at once.
+         */
+        if (this->isArrayMode() == false && this->isForwardingMode() && size > 1) {
+          const triton::ast::SharedAbstractNode& node = this->getForwardedMemory(address, size);
+          if (node) {
+            return node;
+          }
+        }
+
         cells.reserve(size);
         while (size) {
           /* Symbolic Array */
@@ -941,6 +1054,8 @@ namespace triton {
 
       /* Returns the AST corresponding to the register */
       triton::ast::SharedAbstractNode SymbolicEngine::getRegisterAst(const triton::arch::Register& reg) {
+        this->materializeLazyFlag(reg.getParent());
+
         triton::ast::SharedAbstractNode node = nullptr;
         triton::uint32 bvSize                = reg.getBitSize();
         triton::uint32 high                  = reg.getHigh();
@@ -952,10 +1067,6 @@ namespace triton {
         if (symReg) node = this->astCtxt->extract(high, low, this->astCtxt->reference(symReg));
         else        node = this->astCtxt->bv(value, bvSize);
 
-        std::string nodeStr = triton::utils::toString(node);
- /*       std::cout << "nodeStr: " << nodeStr << std::endl;*/
-
-
         /* extend AST if it's a extend operand (mainly used for AArch64) */
         if (reg.getExtendType() != triton::arch::arm::ID_EXTEND_INVALID) {
           return this->getExtendAst(static_cast<const triton::arch::arm::ArmOperandProperties>(reg), node);
@@ -988,9 +1099,6 @@ namespace triton {
         if (symReg) node = this->astCtxt->to_fp32(this->astCtxt->extract(31, 0, this->astCtxt->reference(symReg)));
         else        node = this->astCtxt->bv(value, bvSize);
 
-        std::string nodeStr = triton::utils::toString(node);
-        //std::cout << "getFp32Ast nodeStr: " << nodeStr << std::endl;
-
         return node;
       }
 
@@ -1007,9 +1115,6 @@ namespace triton {
         if (symReg) node = this->astCtxt->to_fp64(this->astCtxt->extract(64, 0, this->astCtxt->reference(symReg)));
         else        node = this->astCtxt->bv(value, bvSize);
 
-        std::string nodeStr = triton::utils::toString(node);
-        //std::cout << "getFp64Ast nodeStr: " << nodeStr << std::endl;
-
         return node;
       }
 
@@ -1041,6 +1146,16 @@ namespace triton {
         triton::uint32 writeSize            = mem.getSize();
         triton::usize id                    = this->uniqueSymExprId;
 
+        /* Concrete results are written to the memory without being recorded */
+        if (this->isConcreteAssignment(node) && this->isArrayMode() == false) {
+          se = this->newConcreteExpression(inst, node, MEMORY_EXPRESSION, "Original memory access - " + comment);
+          se->setOriginMemory(mem);
+          this->setImplicitReadRegisterFromEffectiveAddress(inst, mem);
+          this->concretizeMemory(mem, false);
+          this->architecture->setConcreteMemoryValue(mem, node->evaluate());
+          return inst.symbolicExpressions.back();
+        }
+
         /* Record the aligned memory for a symbolic optimization */
         if (this->isAlignedMode() && this->isArrayMode() == false) {
           const SharedSymbolicExpression& aligned = this->newSymbolicExpression(node, MEMORY_EXPRESSION, "Aligned optimization - " + comment);
@@ -1175,7 +1290,21 @@ namespace triton {
         triton::usize id = this->uniqueSymExprId;
         SharedSymbolicExpression se = nullptr;
 
-        se = this->newSymbolicExpression(this->insertSubRegisterInParent(reg, node), REGISTER_EXPRESSION, comment);
+        const triton::ast::SharedAbstractNode& full = this->insertSubRegisterInParent(reg, node);
+
+        /* Concrete results are written to the CPU without being recorded */
+        if (this->isConcreteAssignment(full)) {
+          const triton::arch::Register& parent = this->architecture->getParentRegister(reg);
+          se = this->newConcreteExpression(inst, full, REGISTER_EXPRESSION, comment);
+          se->setOriginRegister(parent);
+          this->concretizeOverwrittenRegister(parent);
+          if (parent.isMutable()) {
+            this->architecture->setConcreteRegisterValue(parent, full->evaluate());
+          }
+          return inst.symbolicExpressions.back();
+        }
+
+        se = this->newSymbolicExpression(full, REGISTER_EXPRESSION, comment);
         this->assignSymbolicExpressionToRegister(se, this->architecture->getParentRegister(reg));
 
         inst.setWrittenRegister(reg, node);
@@ -1183,6 +1312,85 @@ namespace triton {
       }
 
 
+      /* Assigns a flag, its AST is built on the first read in the LAZY_FLAGS mode */
+      void SymbolicEngine::createSymbolicFlagExpression(triton::arch::Instruction& inst, const std::function<triton::ast::SharedAbstractNode(void)>& builder, const triton::arch::Register& flag, const std::string& comment, bool tainted) {
+        if (!this->deferredFlags && !this->modes->isModeEnabled(triton::modes::LAZY_FLAGS)) {
+          const SharedSymbolicExpression& se = this->createSymbolicRegisterExpression(inst, builder(), flag, comment);
+          se->isTainted = tainted;
+          return;
+        }
+
+        /* All flags of an instruction share the same disassembly */
+        if (this->lazyDisassembly == nullptr || this->lazyInstruction != &inst || this->lazyAddress != inst.getAddress()) {
+          this->lazyDisassembly = std::make_shared<const std::string>(triton::utils::toString(inst));
+          this->lazyInstruction = &inst;
+          this->lazyAddress     = inst.getAddress();
+        }
+
+        triton::engines::symbolic::LazyFlag& lazy = this->lazyFlags[flag.getParent()];
+        lazy.builder     = builder;
+        lazy.comment     = comment;
+        lazy.disassembly = this->lazyDisassembly;
+        lazy.address     = inst.getAddress();
+        lazy.tainted     = tainted;
+        lazy.instruction = this->deferredFlags ? &inst : nullptr;
+      }
+
+
+      void SymbolicEngine::materializeLazyFlag(triton::arch::register_e id) {
+        if (this->lazyFlags.empty())
+          return;
+
+        auto it = this->lazyFlags.find(id);
+        if (it == this->lazyFlags.end())
+          return;
+
+        triton::engines::symbolic::LazyFlag lazy = std::move(it->second);
+        this->lazyFlags.erase(it);
+
+        const triton::arch::Register& flag = this->architecture->getRegister(id);
+        const triton::ast::SharedAbstractNode& node = lazy.builder();
+        const SharedSymbolicExpression& se = this->newSymbolicExpression(this->insertSubRegisterInParent(flag, node), REGISTER_EXPRESSION, lazy.comment);
+        this->assignSymbolicExpressionToRegister(se, flag);
+
+        se->isTainted = lazy.tainted;
+        se->setAddress(lazy.address);
+        se->writeBackDisassembly(*lazy.disassembly);
+
+        /* A deferred flag is live, it belongs to the instruction which assigned it */
+        if (lazy.instruction != nullptr) {
+          lazy.instruction->symbolicExpressions.push_back(se);
+          lazy.instruction->setWrittenRegister(flag, node);
+        }
+      }
+
+
+      void SymbolicEngine::materializeLazyFlag(const triton::arch::Register& reg) {
+        /* The value of EFLAGS is composed of all the flags */
+        if (reg.getParent() == triton::arch::ID_REG_X86_EFLAGS) {
+          this->materializeLazyFlags();
+          return;
+        }
+        this->materializeLazyFlag(reg.getParent());
+      }
+
+
+      void SymbolicEngine::materializeLazyFlags(void) {
+        while (!this->lazyFlags.empty()) {
+          this->materializeLazyFlag(this->lazyFlags.begin()->first);
+        }
+      }
+
+
+      void SymbolicEngine::deferFlags(bool flag) {
+        /* Flags still pending are live at the end of the deferral */
+        if (this->deferredFlags && !flag) {
+          this->materializeLazyFlags();
+        }
+        this->deferredFlags = flag;
+      }
+
+
       /* Returns the new symbolic volatile expression */
       const SharedSymbolicExpression& SymbolicEngine::createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment) {
         triton::usize id = this->uniqueSymExprId;
@@ -1191,6 +1399,22 @@ namespace triton {
       }
 
 
+      /*
+       * With ONLY_ON_SYMBOLIZED, an unsymbolized expression would be removed
+       * right after the instruction is built. It is neither indexed nor linked
+       * to symbolic registers or memory, it only lives in the instruction so
+       * that the semantics can still refer to it (e.g. flags of a result).
+       */
+      SharedSymbolicExpression SymbolicEngine::newConcreteExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type, const std::string& comment) {
+        SharedSymbolicExpression expr = std::make_shared<SymbolicExpression>(node, this->getUniqueSymExprId(), type, comment);
+        if (expr == nullptr) {
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::newConcreteExpression(): not enough memory");
+        }
+        inst.symbolicExpressions.push_back(expr);
+        return expr;
+      }
+
+
       /* Adds a symbolic expression to the bitvector memory model */
       inline void SymbolicEngine::addBitvectorMemory(triton::uint64 mem, const SharedSymbolicExpression& expr) {
         this->memoryBitvector[mem] = expr;
@@ -1215,6 +1439,11 @@ namespace triton {
         se->setType(REGISTER_EXPRESSION);
         se->setOriginRegister(reg);
 
+        /* The register is overwritten, a pending flag is not needed anymore */
+        if (!this->lazyFlags.empty()) {
+          this->lazyFlags.erase(reg.getId());
+        }
+
         if (reg.isMutable()) {
           /* Assign if this register is mutable */
           this->symbolicReg[id] = se;
@@ -1399,6 +1628,96 @@ namespace triton {
       }
 
 
+      /* Returns the concrete constant replacing the node if it exceeds the concretization budget */
+      triton::ast::SharedAbstractNode SymbolicEngine::applyConcretizationBudget(const triton::ast::SharedAbstractNode& node) {
+        triton::usize* counter = nullptr;
+
+        /* Arrays and logical nodes have no bitvector constant, concrete nodes do not need it */
+        if (node->isArray() || node->isLogical() || !node->isSymbolized()) {
+          return nullptr;
+        }
+
+        /* The level is maintained by nodes, check it first */
+        if (this->budget.level && node->getLevel() > this->budget.level) {
+          counter = &this->budgetStats.level;
+        }
+
+        /* The DAG is walked, references unrolled, until a threshold is exceeded */
+        else if (this->budget.nodes || this->budget.variables) {
+          std::vector<triton::ast::AbstractNode*> worklist;
+          std::unordered_set<const triton::ast::AbstractNode*> visited;
+          triton::usize variables = 0;
+
+          worklist.push_back(node.get());
+          while (!worklist.empty() && counter == nullptr) {
+            triton::ast::AbstractNode* current = worklist.back();
+            worklist.pop_back();
+
+            if (visited.insert(current).second == false) {
+              continue;
+            }
+
+            if (this->budget.nodes && visited.size() > this->budget.nodes) {
+              counter = &this->budgetStats.nodes;
+              break;
+            }
+
+            if (current->getType() == triton::ast::VARIABLE_NODE) {
+              if (this->budget.variables && ++variables > this->budget.variables) {
+                counter = &this->budgetStats.variables;
+                break;
+              }
+            }
+
+            else if (current->getType() == triton::ast::REFERENCE_NODE) {
+              worklist.push_back(reinterpret_cast<const triton::ast::ReferenceNode*>(current)->getSymbolicExpression()->getAst().get());
+            }
+
+            else {
+              for (const triton::ast::SharedAbstractNode& child : current->getChildren()) {
+                worklist.push_back(child.get());
+              }
+            }
+          }
+        }
+
+        if (counter == nullptr) {
+          return nullptr;
+        }
+
+        (*counter)++;
+        triton::ast::SharedAbstractNode cst = this->astCtxt->bv(node->evaluate(), node->getBitvectorSize());
+
+        /* Keeps the concretization sound for the solver */
+        if (this->budget.pin) {
+          this->pushPathConstraint(this->astCtxt->equal(node, cst), "Concretization budget");
+          this->budgetStats.pinned++;
+        }
+
+        return cst;
+      }
+
+
+      void SymbolicEngine::setConcretizationBudget(const triton::engines::symbolic::ConcretizationBudget& budget) {
+        this->budget = budget;
+      }
+
+
+      const triton::engines::symbolic::ConcretizationBudget& SymbolicEngine::getConcretizationBudget(void) const {
+        return this->budget;
+      }
+
+
+      const triton::engines::symbolic::ConcretizationStats& SymbolicEngine::getConcretizationStats(void) const {
+        return this->budgetStats;
+      }
+
+
+      void SymbolicEngine::clearConcretizationStats(void) {
+        this->budgetStats = triton::engines::symbolic::ConcretizationStats();
+      }
+
+
       inline bool SymbolicEngine::isAlignedMode(void) const {
         return this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY);
       }
@@ -1408,6 +1727,16 @@ namespace triton {
         return this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY);
       }
 
+
+      inline bool SymbolicEngine::isForwardingMode(void) const {
+        return this->modes->isModeEnabled(triton::modes::STORE_LOAD_FORWARDING);
+      }
+
+
+      inline bool SymbolicEngine::isConcreteAssignment(const triton::ast::SharedAbstractNode& node) const {
+        return this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) && !node->isSymbolized();
+      }
+
     }; /* symbolic namespace */
   }; /* engines namespace */
 }; /*triton namespace */
@@ -244,6 +244,9 @@ namespace triton {
         if (!old || !old->canReplaceNodeWithoutUpdate(ast)) {
           this->ast->initParents();
         }
+        else {
+          this->ast->reviseParents();
+        }
       }
 
 
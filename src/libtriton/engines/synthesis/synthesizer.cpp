@@ -6,12 +6,14 @@
 */
 
 #include <chrono>
+#include <memory>
 #include <stack>
 #include <unordered_set>
 #include <vector>
 
 #include <triton/ast.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/modes.hpp>
 #include <triton/oracleEntry.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/synthesizer.hpp>
@@ -23,7 +25,7 @@ namespace triton {
     namespace synthesis {
 
       Synthesizer::Synthesizer(triton::engines::symbolic::SymbolicEngine* symbolic)
-        : symbolic(symbolic) {
+        : solver(std::make_shared<triton::modes::Modes>()), symbolic(symbolic) {
         #ifdef TRITON_Z3_INTERFACE
         this->solver.setSolver(triton::engines::solver::SOLVER_Z3);
         #endif
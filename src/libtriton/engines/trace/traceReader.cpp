@@ -0,0 +1,268 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <triton/coreUtils.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/traceReader.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace trace {
+
+      TraceReader::TraceReader(const std::string& path) {
+        this->data   = nullptr;
+        this->size   = 0;
+        this->cursor = 0;
+        this->limit  = 0;
+        this->arch   = triton::arch::ARCH_INVALID;
+
+        #if defined(_WIN32)
+        this->mapping = nullptr;
+        this->file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (this->file == INVALID_HANDLE_VALUE)
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): Cannot open " + path + ".");
+
+        LARGE_INTEGER fsize;
+        if (!::GetFileSizeEx(this->file, &fsize)) {
+          this->unmap();
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): Cannot stat " + path + ".");
+        }
+        this->size = static_cast<triton::usize>(fsize.QuadPart);
+
+        if (this->size) {
+          this->mapping = ::CreateFileMappingA(this->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+          if (this->mapping == nullptr) {
+            this->unmap();
+            throw triton::exceptions::Trace("TraceReader::TraceReader(): Cannot map " + path + ".");
+          }
+          this->data = static_cast<const triton::uint8*>(::MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+        }
+        #else
+        this->fd = ::open(path.c_str(), O_RDONLY);
+        if (this->fd < 0)
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): Cannot open " + path + ".");
+
+        struct stat st;
+        if (::fstat(this->fd, &st) != 0) {
+          this->unmap();
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): Cannot stat " + path + ".");
+        }
+        this->size = static_cast<triton::usize>(st.st_size);
+
+        if (this->size) {
+          void* view = ::mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, this->fd, 0);
+          if (view != MAP_FAILED) {
+            /* Records are decoded front to back, let the kernel read ahead */
+            ::madvise(view, this->size, MADV_SEQUENTIAL);
+            this->data = static_cast<const triton::uint8*>(view);
+          }
+        }
+        #endif
+
+        if (this->data == nullptr) {
+          this->unmap();
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): Cannot map " + path + ".");
+        }
+
+        if (this->size < format::headerSize) {
+          this->unmap();
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): Truncated trace.");
+        }
+
+        this->limit = this->size;
+        if (std::memcmp(this->data, format::magic, sizeof(format::magic)) != 0) {
+          this->unmap();
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): Invalid trace magic.");
+        }
+
+        this->cursor = sizeof(format::magic);
+        if (this->get<triton::uint32>() != format::version) {
+          this->unmap();
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): Unsupported trace version.");
+        }
+
+        this->arch = static_cast<triton::arch::architecture_e>(this->get<triton::uint32>());
+      }
+
+
+      TraceReader::~TraceReader() {
+        this->unmap();
+      }
+
+
+      void TraceReader::unmap(void) {
+        #if defined(_WIN32)
+        if (this->data)
+          ::UnmapViewOfFile(this->data);
+        if (this->mapping)
+          ::CloseHandle(this->mapping);
+        if (this->file != INVALID_HANDLE_VALUE)
+          ::CloseHandle(this->file);
+        this->mapping = nullptr;
+        this->file    = INVALID_HANDLE_VALUE;
+        #else
+        if (this->data)
+          ::munmap(const_cast<triton::uint8*>(this->data), this->size);
+        if (this->fd >= 0)
+          ::close(this->fd);
+        this->fd = -1;
+        #endif
+        this->data   = nullptr;
+        this->size   = 0;
+        this->cursor = 0;
+        this->limit  = 0;
+      }
+
+
+      void TraceReader::need(triton::usize n) const {
+        if (this->cursor + n > this->limit)
+          throw triton::exceptions::Trace("TraceReader::need(): Truncated trace.");
+      }
+
+
+      template <typename T>
+      T TraceReader::get(void) {
+        T value = 0;
+
+        this->need(sizeof(T));
+        for (triton::usize i = 0; i < sizeof(T); i++)
+          value |= static_cast<T>(static_cast<T>(this->data[this->cursor + i]) << (i * 8));
+        this->cursor += sizeof(T);
+
+        return value;
+      }
+
+
+      triton::arch::architecture_e TraceReader::getArchitecture(void) const {
+        return this->arch;
+      }
+
+
+      bool TraceReader::next(triton::engines::trace::TraceRecord& record) {
+        triton::uint8 value[64];
+
+        if (this->cursor >= this->limit)
+          return false;
+
+        record.clear();
+
+        triton::uint32 rsize = this->get<triton::uint32>();
+        this->need(rsize);
+        triton::usize end = this->cursor + rsize;
+
+        record.address  = this->get<triton::uint64>();
+        record.threadId = this->get<triton::uint32>();
+
+        triton::uint8 opSize = this->get<triton::uint8>();
+        this->need(opSize);
+        record.opcode.assign(this->data + this->cursor, this->data + this->cursor + opSize);
+        this->cursor += opSize;
+
+        triton::uint16 nbRegs = this->get<triton::uint16>();
+        record.registers.reserve(nbRegs);
+        for (triton::uint16 i = 0; i < nbRegs; i++) {
+          auto id = static_cast<triton::arch::register_e>(this->get<triton::uint32>());
+          triton::uint8 vsize = this->get<triton::uint8>();
+          if (vsize > sizeof(value))
+            throw triton::exceptions::Trace("TraceReader::next(): Invalid register value size.");
+          this->need(vsize);
+          std::memset(value, 0x00, sizeof(value));
+          std::memcpy(value, this->data + this->cursor, vsize);
+          this->cursor += vsize;
+          record.registers.push_back({id, triton::utils::cast<triton::uint512>(value)});
+        }
+
+        triton::uint16 nbMems = this->get<triton::uint16>();
+        record.memory.reserve(nbMems);
+        for (triton::uint16 i = 0; i < nbMems; i++) {
+          triton::uint64 addr = this->get<triton::uint64>();
+          triton::uint8 vsize = this->get<triton::uint8>();
+          this->need(vsize);
+          record.memory.push_back({addr, std::vector<triton::uint8>(this->data + this->cursor, this->data + this->cursor + vsize)});
+          this->cursor += vsize;
+        }
+
+        if (this->cursor != end)
+          throw triton::exceptions::Trace("TraceReader::next(): Corrupted record.");
+
+        return true;
+      }
+
+
+      void TraceReader::rewind(void) {
+        this->cursor = format::headerSize;
+        this->limit  = this->size;
+      }
+
+
+      void TraceReader::seek(const triton::engines::trace::TraceChunk& chunk) {
+        if (chunk.offset < format::headerSize || chunk.offset + chunk.size > this->size)
+          throw triton::exceptions::Trace("TraceReader::seek(): The chunk is out of the trace.");
+
+        this->cursor = static_cast<triton::usize>(chunk.offset);
+        this->limit  = static_cast<triton::usize>(chunk.offset + chunk.size);
+      }
+
+
+      std::vector<triton::engines::trace::TraceChunk> TraceReader::split(triton::usize recordsPerChunk) const {
+        std::vector<triton::engines::trace::TraceChunk> chunks;
+        triton::engines::trace::TraceChunk chunk;
+        triton::usize offset = format::headerSize;
+        triton::usize index  = 0;
+
+        if (recordsPerChunk == 0)
+          throw triton::exceptions::Trace("TraceReader::split(): The number of records per chunk cannot be zero.");
+
+        chunk.offset = offset;
+        while (offset < this->size) {
+          if (offset + sizeof(triton::uint32) > this->size)
+            throw triton::exceptions::Trace("TraceReader::split(): Truncated trace.");
+
+          triton::uint32 rsize = 0;
+          for (triton::usize i = 0; i < sizeof(triton::uint32); i++)
+            rsize |= static_cast<triton::uint32>(this->data[offset + i]) << (i * 8);
+
+          offset += sizeof(triton::uint32) + rsize;
+          if (offset > this->size)
+            throw triton::exceptions::Trace("TraceReader::split(): Truncated trace.");
+
+          chunk.count++;
+          index++;
+
+          if (chunk.count == recordsPerChunk) {
+            chunk.size = offset - chunk.offset;
+            chunks.push_back(chunk);
+            chunk = triton::engines::trace::TraceChunk();
+            chunk.offset = offset;
+            chunk.first  = index;
+          }
+        }
+
+        if (chunk.count) {
+          chunk.size = offset - chunk.offset;
+          chunks.push_back(chunk);
+        }
+
+        return chunks;
+      }
+
+    }; /* trace namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
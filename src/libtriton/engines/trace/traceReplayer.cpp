@@ -0,0 +1,99 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <triton/exceptions.hpp>
+#include <triton/instruction.hpp>
+#include <triton/traceReplayer.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace trace {
+
+      TraceReplayer::TraceReplayer(triton::Context& ctx)
+        : ctx(ctx) {
+        this->processed = 0;
+        this->skipped   = 0;
+      }
+
+
+      /* Restores the values read by the instruction, without triggering the user's callbacks */
+      void TraceReplayer::synchronize(const triton::engines::trace::TraceRecord& record) {
+        for (const auto& reg : record.registers) {
+          this->ctx.setConcreteRegisterValue(this->ctx.getRegister(reg.first), reg.second, false);
+        }
+
+        for (const auto& mem : record.memory) {
+          this->ctx.setConcreteMemoryAreaValue(mem.first, mem.second, false);
+        }
+      }
+
+
+      triton::arch::exception_e TraceReplayer::replay(const triton::engines::trace::TraceRecord& record) {
+        this->synchronize(record);
+
+        triton::arch::Instruction inst(record.address, record.opcode.data(), static_cast<triton::uint32>(record.opcode.size()));
+        inst.setThreadId(record.threadId);
+
+        this->processed++;
+        return this->ctx.processing(inst);
+      }
+
+
+      triton::arch::exception_e TraceReplayer::replay(triton::engines::trace::TraceReader& reader) {
+        triton::engines::trace::TraceRecord record;
+
+        if (reader.getArchitecture() != this->ctx.getArchitecture())
+          throw triton::exceptions::Trace("TraceReplayer::replay(): The trace and the context architectures differ.");
+
+        while (reader.next(record)) {
+          triton::arch::exception_e ret = this->replay(record);
+          if (ret != triton::arch::NO_FAULT)
+            return ret;
+        }
+
+        return triton::arch::NO_FAULT;
+      }
+
+
+      triton::arch::exception_e TraceReplayer::replay(triton::engines::trace::TraceReader& reader, const triton::engines::trace::TraceChunk& chunk) {
+        reader.seek(chunk);
+        return this->replay(reader);
+      }
+
+
+      void TraceReplayer::replayConcrete(triton::engines::trace::TraceReader& reader, const triton::engines::trace::TraceChunk& chunk) {
+        triton::engines::trace::TraceRecord record;
+
+        if (reader.getArchitecture() != this->ctx.getArchitecture())
+          throw triton::exceptions::Trace("TraceReplayer::replayConcrete(): The trace and the context architectures differ.");
+
+        reader.seek(chunk);
+        while (reader.next(record)) {
+          this->synchronize(record);
+          this->skipped++;
+        }
+
+        /* The symbolic state is stale once instructions ran without their semantics */
+        this->ctx.concretizeAllRegister();
+        this->ctx.concretizeAllMemory();
+      }
+
+
+      triton::usize TraceReplayer::getNumberOfProcessedRecords(void) const {
+        return this->processed;
+      }
+
+
+      triton::usize TraceReplayer::getNumberOfConcreteRecords(void) const {
+        return this->skipped;
+      }
+
+    }; /* trace namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
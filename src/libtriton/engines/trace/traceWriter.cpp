@@ -0,0 +1,135 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#include <cstring>
+
+#include <triton/coreUtils.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/traceWriter.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace trace {
+
+      TraceWriter::TraceWriter(const std::string& path, triton::arch::architecture_e arch) {
+        this->records = 0;
+
+        this->stream.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!this->stream.is_open())
+          throw triton::exceptions::Trace("TraceWriter::TraceWriter(): Cannot open " + path + ".");
+
+        this->buffer.clear();
+        this->buffer.insert(this->buffer.end(), format::magic, format::magic + sizeof(format::magic));
+        this->put<triton::uint32>(format::version);
+        this->put<triton::uint32>(static_cast<triton::uint32>(arch));
+        this->stream.write(reinterpret_cast<const char*>(this->buffer.data()), this->buffer.size());
+      }
+
+
+      TraceWriter::~TraceWriter() {
+        this->close();
+      }
+
+
+      template <typename T>
+      void TraceWriter::put(T value) {
+        for (triton::usize i = 0; i < sizeof(T); i++) {
+          this->buffer.push_back(static_cast<triton::uint8>(value & 0xff));
+          value = static_cast<T>(value >> 8);
+        }
+      }
+
+
+      void TraceWriter::write(const triton::engines::trace::TraceRecord& record) {
+        triton::uint8 value[64] = {0};
+
+        if (!this->stream.is_open())
+          throw triton::exceptions::Trace("TraceWriter::write(): The trace is closed.");
+
+        if (record.opcode.size() > 0xff || record.registers.size() > 0xffff || record.memory.size() > 0xffff)
+          throw triton::exceptions::Trace("TraceWriter::write(): The record is too large.");
+
+        /* The size prefix is patched once the record is serialized */
+        this->buffer.clear();
+        this->put<triton::uint32>(0);
+        this->put<triton::uint64>(record.address);
+        this->put<triton::uint32>(record.threadId);
+        this->put<triton::uint8>(static_cast<triton::uint8>(record.opcode.size()));
+        this->buffer.insert(this->buffer.end(), record.opcode.begin(), record.opcode.end());
+
+        this->put<triton::uint16>(static_cast<triton::uint16>(record.registers.size()));
+        for (const auto& reg : record.registers) {
+          /* Leading zero bytes are dropped, the reader zero-extends the value */
+          triton::utils::fromUintToBuffer(reg.second, value);
+          triton::uint8 size = sizeof(value);
+          while (size && value[size - 1] == 0)
+            size--;
+          this->put<triton::uint32>(static_cast<triton::uint32>(reg.first));
+          this->put<triton::uint8>(size);
+          this->buffer.insert(this->buffer.end(), value, value + size);
+        }
+
+        this->put<triton::uint16>(static_cast<triton::uint16>(record.memory.size()));
+        for (const auto& mem : record.memory) {
+          if (mem.second.size() > 0xff)
+            throw triton::exceptions::Trace("TraceWriter::write(): The memory access is too large.");
+          this->put<triton::uint64>(mem.first);
+          this->put<triton::uint8>(static_cast<triton::uint8>(mem.second.size()));
+          this->buffer.insert(this->buffer.end(), mem.second.begin(), mem.second.end());
+        }
+
+        triton::uint32 size = static_cast<triton::uint32>(this->buffer.size() - sizeof(triton::uint32));
+        for (triton::usize i = 0; i < sizeof(triton::uint32); i++)
+          this->buffer[i] = static_cast<triton::uint8>(size >> (i * 8));
+
+        this->stream.write(reinterpret_cast<const char*>(this->buffer.data()), this->buffer.size());
+        this->records++;
+      }
+
+
+      void TraceWriter::write(triton::arch::Instruction& inst) {
+        triton::engines::trace::TraceRecord record;
+        triton::uint8 value[64] = {0};
+
+        record.address  = inst.getAddress();
+        record.threadId = inst.getThreadId();
+        record.opcode.assign(inst.getOpcode(), inst.getOpcode() + inst.getSize());
+
+        for (const auto& reg : inst.getReadRegisters()) {
+          if (reg.second == nullptr)
+            continue;
+          record.registers.push_back({reg.first.getId(), reg.second->evaluate()});
+        }
+
+        for (const auto& mem : inst.getLoadAccess()) {
+          if (mem.second == nullptr)
+            continue;
+          triton::utils::fromUintToBuffer(mem.second->evaluate(), value);
+          record.memory.push_back({mem.first.getAddress(), std::vector<triton::uint8>(value, value + mem.first.getSize())});
+        }
+
+        this->write(record);
+      }
+
+
+      void TraceWriter::close(void) {
+        if (this->stream.is_open()) {
+          this->stream.flush();
+          this->stream.close();
+        }
+      }
+
+
+      triton::usize TraceWriter::getNumberOfRecords(void) const {
+        return this->records;
+      }
+
+    }; /* trace namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
@@ -0,0 +1,159 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_ABSTRACTINTERPRETER_H
+#define TRITON_ABSTRACTINTERPRETER_H
+
+#include <unordered_map>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class AbstractValue
+        \brief The known bits and the unsigned and signed intervals of a node.
+
+        \details
+        Logical nodes are 1-bit values, 1 meaning true. Nodes wider than 64 bits and arrays are not tracked
+        and their values are unknown.
+    */
+    class AbstractValue {
+      public:
+        //! The size in bits of the value, 0 if not tracked.
+        triton::uint32 size;
+
+        //! The bits known to be zero.
+        triton::uint64 zeros;
+
+        //! The bits known to be one.
+        triton::uint64 ones;
+
+        //! The unsigned lower bound.
+        triton::uint64 umin;
+
+        //! The unsigned upper bound.
+        triton::uint64 umax;
+
+        //! The signed lower bound.
+        triton::sint64 smin;
+
+        //! The signed upper bound.
+        triton::sint64 smax;
+
+        //! Constructor of an untracked value.
+        TRITON_EXPORT AbstractValue();
+
+        //! Constructor of an unknown value of `size` bits.
+        TRITON_EXPORT AbstractValue(triton::uint32 size);
+
+        //! Constructor of a constant.
+        TRITON_EXPORT AbstractValue(triton::uint64 value, triton::uint32 size);
+
+        //! Returns the mask of the value.
+        TRITON_EXPORT triton::uint64 getMask(void) const;
+
+        //! Returns true if the value is tracked.
+        TRITON_EXPORT bool isTracked(void) const;
+
+        //! Returns true if all bits are known.
+        TRITON_EXPORT bool isConstant(void) const;
+
+        //! Returns true if the value is a logical node known to be true.
+        TRITON_EXPORT bool isTrue(void) const;
+
+        //! Returns true if the value is a logical node known to be false.
+        TRITON_EXPORT bool isFalse(void) const;
+
+        //! Tightens the known bits and the intervals with each other.
+        TRITON_EXPORT void refine(void);
+
+        //! Returns the least value containing both values.
+        TRITON_EXPORT static AbstractValue join(const AbstractValue& a, const AbstractValue& b);
+    };
+
+
+    /*! \class AbstractInterpreter
+     *  \brief Computes the abstract values of nodes.
+     *
+     *  \details
+     *  The known zero and one bits and the unsigned and signed intervals of a node are computed from the
+     *  ones of its children, e.g. `(bvult ((_ zero_extend 24) x) (_ bv256 32))` is known to be true.
+     *  Values are memoized by node across queries like the solver translations, the entries of dead nodes
+     *  being swept once the map has grown enough. A node changed in place since it was analyzed is analyzed again.
+     */
+    class AbstractInterpreter {
+      private:
+        //! An abstract value of a node.
+        struct Entry {
+          //! The node. It is not kept alive by the entry.
+          triton::ast::WeakAbstractNode node;
+
+          //! The abstract value of the node.
+          triton::ast::AbstractValue value;
+
+          //! The revision of the node when it was analyzed.
+          triton::usize revision;
+
+          //! Constructor.
+          Entry(const triton::ast::SharedAbstractNode& node, const triton::ast::AbstractValue& value) : node(node), value(value), revision(node->getRevision()) {}
+        };
+
+        //! The abstract values of the nodes already visited. It does not own the nodes.
+        std::unordered_map<const triton::ast::AbstractNode*, Entry> values;
+
+        //! The number of entries from which dead nodes are swept.
+        triton::usize sweepThreshold;
+
+        //! Returns true if a node is alive in the map of values and has not been changed since.
+        bool isComputed(const triton::ast::SharedAbstractNode& node) const;
+
+        //! Returns the abstract value of a computed node.
+        const triton::ast::AbstractValue& get(const triton::ast::SharedAbstractNode& node) const;
+
+        //! Removes the entries of dead nodes once the map has grown enough.
+        void sweep(void);
+
+        //! Computes the abstract value of a node from the ones of its children.
+        triton::ast::AbstractValue transfer(const triton::ast::SharedAbstractNode& node) const;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT AbstractInterpreter();
+
+        //! Returns the abstract value of a node.
+        TRITON_EXPORT triton::ast::AbstractValue analyze(const triton::ast::SharedAbstractNode& node);
+
+        //! Removes all entries.
+        TRITON_EXPORT void clear(void);
+
+        //! Returns the number of entries.
+        TRITON_EXPORT triton::usize size(void) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ABSTRACTINTERPRETER_H */
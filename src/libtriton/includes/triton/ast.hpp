@@ -54,6 +54,7 @@ namespace triton {
 
     class AstContext;
     class AbstractNode;
+    class AbstractValue;
 
     //! Shared Abstract Node
     using SharedAbstractNode = std::shared_ptr<triton::ast::AbstractNode>;
@@ -93,6 +94,9 @@ namespace triton {
         //! The hash of the tree
         triton::uint512 hash;
 
+        //! The revision of the tree, bumped each time one of its nodes is replaced in place.
+        triton::usize revision;
+
         //! True if the tree contains a symbolic variable.
         bool symbolized;
 
@@ -115,6 +119,9 @@ namespace triton {
         //! Access to its context
         TRITON_EXPORT SharedAstContext getContext(void) const;
 
+        //! Returns the known bits and intervals of the node, memoized by its AST context.
+        TRITON_EXPORT triton::ast::AbstractValue getAbstractValue(void);
+
         //! Returns the type of the node.
         TRITON_EXPORT triton::ast::ast_e getType(void) const;
 
@@ -151,12 +158,18 @@ namespace triton {
         //! Returns the hash of the tree.
         TRITON_EXPORT triton::uint512 getHash(void) const;
 
+        //! Returns the revision of the tree. Results memoized by node must be dropped when it changes.
+        TRITON_EXPORT triton::usize getRevision(void) const;
+
         //! Evaluates the tree.
         TRITON_EXPORT triton::uint512 evaluate(void) const;
 
         //! Initializes parents.
         void initParents(void);
 
+        //! Bumps the revision of the node and of its parents.
+        void reviseParents(void);
+
         //! Returns the children of the node.
         TRITON_EXPORT std::vector<SharedAbstractNode>& getChildren(void);
 
@@ -14,6 +14,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <triton/abstractInterpreter.hpp>
 #include <triton/ast.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/dllexport.hpp>
@@ -64,6 +65,9 @@ namespace triton {
         //! The list of nodes
         std::deque<SharedAbstractNode> nodes;
 
+        //! The memoized abstract values of nodes.
+        triton::ast::AbstractInterpreter abstraction;
+
         //! Returns simplified concatenation.
         SharedAbstractNode simplify_concat(std::vector<SharedAbstractNode> exprs);
 
@@ -86,6 +90,9 @@ namespace triton {
         //! Garbage unused nodes.
         TRITON_EXPORT void garbage(void);
 
+        //! Returns the known bits and intervals of a node.
+        TRITON_EXPORT triton::ast::AbstractValue getAbstractValue(const SharedAbstractNode& node);
+
         //! AST C++ API - array node builder
         TRITON_EXPORT SharedAbstractNode array(triton::uint32 addrSize);
 
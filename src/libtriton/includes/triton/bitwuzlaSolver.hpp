@@ -8,7 +8,10 @@
 #ifndef TRITON_BITWUZLASOLVER_H
 #define TRITON_BITWUZLASOLVER_H
 
+#include <atomic>
 #include <chrono>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -23,6 +26,7 @@ extern "C" {
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
 #include <triton/symbolicExpression.hpp>
+#include <triton/tritonToBitwuzla.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -65,6 +69,7 @@ namespace triton {
             int64_t timeout;                                                                                /*!< Timeout (ms) for solver instance running. */
             size_t  memory_limit;                                                                           /*!< Memory limit for the whole symbolic process. */
             int64_t last_mem_check = -1;                                                                    /*!< Time when the last memory usage check was performed. */
+            const std::atomic<bool>* interrupted = nullptr;                                                 /*!< Set by interrupt() to cancel the query. */
           };
 
           //! The SMT solver timeout. By default, unlimited. This global timeout may be changed for a specific query (isSat/getModel/getModels) via argument `timeout`.
@@ -73,10 +78,82 @@ namespace triton {
           //! The SMT solver memory limit. By default, unlimited.
           triton::uint32 memoryLimit;
 
+          //! True if the queries are interrupted by interrupt().
+          std::atomic<bool> interrupted;
+
+          //! The time spent in each phase by the last query.
+          mutable triton::engines::solver::SolverStats stats;
+
+          //! Protects `stats`, queries being solved from several threads.
+          mutable std::mutex statsLock;
+
+          //! Collects the counters of a query and publishes them to `stats`.
+          class QueryStats;
+
+          //! A Bitwuzla instance whose term manager and translated terms outlive its queries.
+          struct Instance {
+            //! The options of the instance.
+            BitwuzlaOptions* options;
+
+            //! The term manager of the instance.
+            BitwuzlaTermManager* termMgr;
+
+            //! The solver of the instance.
+            Bitwuzla* bzla;
+
+            //! The translator of the instance. It keeps the translated sub-DAGs.
+            triton::ast::TritonToBitwuzla ast;
+
+            //! The termination parameters, reset before each query.
+            SolverParams params;
+
+            //! The number of nodes translated in the term manager, the terms of dead nodes included.
+            triton::usize translations;
+
+            //! Constructor.
+            Instance();
+
+            //! Destructor.
+            ~Instance();
+          };
+
+          //! The instance shared by successive getModels() and isSat() queries.
+          mutable std::unique_ptr<Instance> instance;
+
+          //! Protects `instance`, a query holding it until it is solved.
+          mutable std::mutex instanceLock;
+
+          //! Returns the shared instance if `lock` can take it, otherwise a fresh instance owned by `local`.
+          Instance& getInstance(std::unique_lock<std::mutex>& lock, std::unique_ptr<Instance>& local) const;
+
+          //! The options of the incremental session.
+          BitwuzlaOptions* sessionOptions;
+
+          //! The term manager of the incremental session.
+          BitwuzlaTermManager* sessionTermMgr;
+
+          //! The solver of the incremental session.
+          Bitwuzla* session;
+
+          //! The translator of the incremental session. It keeps the translated sub-DAGs.
+          std::unique_ptr<triton::ast::TritonToBitwuzla> sessionAst;
+
+          //! The termination parameters of the incremental session, reset before each check.
+          SolverParams sessionParams;
+
+          //! The number of open scopes in the incremental session.
+          triton::usize sessionScopes;
+
+          //! Initializes the incremental session if it does not exist yet.
+          void initSession(void);
+
         public:
           //! Constructor.
           TRITON_EXPORT BitwuzlaSolver();
 
+          //! Destructor.
+          TRITON_EXPORT ~BitwuzlaSolver();
+
           //! Computes and returns a model from a symbolic constraint.
           /*! \brief map of symbolic variable id -> model
            *
@@ -95,6 +172,15 @@ namespace triton {
            */
           TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Computes and returns several models which differ on the `projection` variables, each model only holding these variables. An empty projection enumerates the models on all variables. The `limit` is the max number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
@@ -104,13 +190,43 @@ namespace triton {
           //! Returns the name of this solver.
           TRITON_EXPORT std::string getName(void) const;
 
+          //! Returns the time spent in each phase by the last query.
+          TRITON_EXPORT triton::engines::solver::SolverStats getStats(void) const;
+
+          //! Opens a new scope in the incremental session.
+          TRITON_EXPORT void pushScope(void);
+
+          //! Closes the last scope of the incremental session.
+          TRITON_EXPORT void popScope(void);
+
+          //! Asserts a constraint in the current scope of the incremental session.
+          TRITON_EXPORT void assertConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Checks the asserted constraints together with an assumption (if not null) which is not kept in the session. Returns a model if it is satisfiable.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> checkWithAssumption(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+          //! Drops the incremental session, its scopes and its translated constraints.
+          TRITON_EXPORT void resetSession(void);
+
+          //! Returns the number of constraints asserted in the incremental session.
+          TRITON_EXPORT triton::usize getSessionSize(void) const;
+
           //! Defines a solver timeout (in milliseconds).
           TRITON_EXPORT void setTimeout(triton::uint32 ms);
 
           //! Defines a solver memory consumption limit (in megabytes).
           TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
 
-          //! Callback function that implements termination of Bitwuzla solver on timeout and memory limit.
+          //! Interrupts the queries being solved, and the ones started until it is called with `false`. Thread-safe.
+          TRITON_EXPORT void interrupt(bool enable=true);
+
+          //! Callback function that implements termination of Bitwuzla solver on timeout, memory limit and interruption.
           static int32_t terminateCallback(void* state);
 
           //! Callback function that implements aborting of Bitwuzla solver with throwing exception.
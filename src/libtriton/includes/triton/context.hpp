@@ -14,7 +14,9 @@
 #include <triton/astRepresentation.hpp>
 #include <triton/basicBlock.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/decodeCache.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/functionSummaries.hpp>
 #include <triton/immediate.hpp>
 #include <triton/instruction.hpp>
 #include <triton/irBuilder.hpp>
@@ -82,6 +84,9 @@ namespace triton {
         //! The symbolic engine.
         triton::engines::symbolic::SymbolicEngine* symbolic = nullptr;
 
+        //! The function summaries.
+        triton::engines::symbolic::FunctionSummaries* summaries = nullptr;
+
         //! The solver engine.
         triton::engines::solver::SolverEngine* solver = nullptr;
 
@@ -91,6 +96,9 @@ namespace triton {
         //! The IR builder.
         triton::arch::IrBuilder* irBuilder = nullptr;
 
+        //! The cache of decoded instructions.
+        triton::arch::DecodeCache* decodeCache = nullptr;
+
 
       public:
         //! A shortcut to access to a Register class from a register name.
@@ -276,6 +284,12 @@ namespace triton {
         //! [**proccesing api**] - Processes a block of instructions and updates engines according to instructions semantics. Returns `triton::arch::NO_FAULT` if succeed.
         TRITON_EXPORT triton::arch::exception_e processing(triton::arch::BasicBlock& block, triton::uint64 addr=0);
 
+        //! [**proccesing api**] - Returns the counters of the decode cache used by the DECODE_CACHE mode.
+        TRITON_EXPORT const triton::arch::DecodeCacheStats& getDecodeCacheStats(void) const;
+
+        //! [**proccesing api**] - Removes all instructions of the decode cache and resets its counters.
+        TRITON_EXPORT void clearDecodeCache(void);
+
         //! [**proccesing api**] - Initializes everything.
         TRITON_EXPORT void initEngines(void);
 
@@ -474,6 +488,24 @@ namespace triton {
         //! [**symbolic api**] - Clears the current path predicate.
         TRITON_EXPORT void clearPathConstraints(void);
 
+        //! [**symbolic api**] - Merges the current path constraints into the execution tree, `frontier` being the id of the branch whose model the run followed, if any. Returns the number of new branch instructions.
+        TRITON_EXPORT triton::usize mergePathConstraints(triton::usize frontier=0);
+
+        //! [**symbolic api**] - Hands out the next unexplored branch of the execution tree. Returns false if there is none.
+        TRITON_EXPORT bool getNextExecutionFrontier(triton::engines::symbolic::ExecutionFrontier& frontier);
+
+        //! [**symbolic api**] - Resolves a branch handed out by getNextExecutionFrontier() with the status of its predicate.
+        TRITON_EXPORT void resolveExecutionFrontier(triton::usize id, triton::engines::solver::status_e status);
+
+        //! [**symbolic api**] - Hands out again the branches of the execution tree which timed out.
+        TRITON_EXPORT void retryExecutionTimeouts(void);
+
+        //! [**symbolic api**] - Returns the counters of the execution tree.
+        TRITON_EXPORT const triton::engines::symbolic::ExecutionTreeStats& getExecutionTreeStats(void) const;
+
+        //! [**symbolic api**] - Clears the execution tree.
+        TRITON_EXPORT void clearExecutionTree(void);
+
         //! [**symbolic api**] - Returns true if the symbolic expression ID exists.
         TRITON_EXPORT bool isSymbolicExpressionExists(triton::usize symExprId) const;
 
@@ -513,6 +545,36 @@ namespace triton {
         //! [**symbolic api**] - Concretizes a symbolic register.
         TRITON_EXPORT void concretizeRegister(const triton::arch::Register& reg);
 
+        //! [**symbolic api**] - Applies the native summary of `name` when an instruction is processed at `addr`, its arguments following the `abi` calling convention.
+        TRITON_EXPORT void addFunctionSummary(triton::uint64 addr, const std::string& name, triton::engines::symbolic::abi_e abi=triton::engines::symbolic::DEFAULT_ABI);
+
+        //! [**symbolic api**] - Applies the native summaries of the supported symbols of a stubs map mapped at `base`, following the `abi` calling convention of the stubs. Returns the number of summaries.
+        TRITON_EXPORT triton::usize addFunctionSummaries(triton::uint64 base, const std::map<std::string, triton::uint64>& symbols, triton::engines::symbolic::abi_e abi=triton::engines::symbolic::DEFAULT_ABI);
+
+        //! [**symbolic api**] - Removes all function summaries.
+        TRITON_EXPORT void clearFunctionSummaries(void);
+
+        //! [**symbolic api**] - Sets the maximum number of bytes covered by the ITE chains of function summaries.
+        TRITON_EXPORT void setFunctionSummaryBound(triton::uint32 bound);
+
+        //! [**symbolic api**] - Returns the maximum number of bytes covered by the ITE chains of function summaries.
+        TRITON_EXPORT triton::uint32 getFunctionSummaryBound(void) const;
+
+        //! [**symbolic api**] - Returns how many times each function summary has been applied.
+        TRITON_EXPORT const std::map<std::string, triton::usize>& getFunctionSummaryHits(void) const;
+
+        //! [**symbolic api**] - Sets the thresholds of the CONCRETIZE_ON_BUDGET mode.
+        TRITON_EXPORT void setConcretizationBudget(const triton::engines::symbolic::ConcretizationBudget& budget);
+
+        //! [**symbolic api**] - Returns the thresholds of the CONCRETIZE_ON_BUDGET mode.
+        TRITON_EXPORT const triton::engines::symbolic::ConcretizationBudget& getConcretizationBudget(void) const;
+
+        //! [**symbolic api**] - Returns how often each threshold of the CONCRETIZE_ON_BUDGET mode fired.
+        TRITON_EXPORT const triton::engines::symbolic::ConcretizationStats& getConcretizationStats(void) const;
+
+        //! [**symbolic api**] - Resets the counters of the CONCRETIZE_ON_BUDGET mode.
+        TRITON_EXPORT void clearConcretizationStats(void);
+
         //! [**symbolic api**] - Slices all expressions from a given one.
         TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::symbolic::SharedSymbolicExpression> sliceExpressions(const triton::engines::symbolic::SharedSymbolicExpression& expr);
 
@@ -553,6 +615,24 @@ namespace triton {
          */
         TRITON_EXPORT std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+        /*!
+         * \brief [**solver api**] - Computes and returns several models which differ on the `projection` variables, each model only holding these variables. An empty projection enumerates the models on all variables. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+         *
+         * \details
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         */
+        TRITON_EXPORT std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+        /*!
+         * \brief [**solver api**] - Computes a model for each query of a batch, like a generational search flipping each path constraint. Queries are solved concurrently on `threads` workers (0 for one per hardware thread), each with its own solver context. Models, states and solving times are returned in the order of the queries.
+         *
+         * \details
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         */
+        TRITON_EXPORT std::vector<std::unordered_map<triton::usize, triton::engines::solver::SolverModel>> getModels(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 threads, std::vector<triton::engines::solver::status_e>* status = nullptr, triton::uint32 timeout = 0, std::vector<triton::uint32>* solvingTime = nullptr) const;
+
         //! Returns true if an expression is satisfiable.
         TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
@@ -583,6 +663,72 @@ namespace triton {
         //! [**solver api**] - Defines a solver memory consumption limit (in megabytes).
         TRITON_EXPORT void setSolverMemoryLimit(triton::uint32 limit);
 
+        //! [**solver api**] - Returns the time spent in each phase (translation, check, model extraction, numeral parsing) by the queries sent to the solver.
+        TRITON_EXPORT const triton::engines::solver::SolverStats& getSolverStats(void) const;
+
+        //! [**solver api**] - Resets the time spent in each phase by the queries sent to the solver.
+        TRITON_EXPORT void clearSolverStats(void);
+
+        //! [**solver api**] - Returns the counters of the query cache used by the SOLVER_CACHE mode.
+        TRITON_EXPORT const triton::engines::solver::SolverCacheStats& getSolverCacheStats(void) const;
+
+        //! [**solver api**] - Removes all cached queries and resets the counters of the query cache.
+        TRITON_EXPORT void clearSolverCache(void);
+
+        //! [**solver api**] - Returns the counters of the recent models used by the MODEL_REUSE mode.
+        TRITON_EXPORT const triton::engines::solver::ModelCacheStats& getModelCacheStats(void) const;
+
+        //! [**solver api**] - Removes all recent models and resets the counters of the model cache.
+        TRITON_EXPORT void clearModelCache(void);
+
+        //! [**solver api**] - Returns the number of queries won by each backend of the SOLVER_PORTFOLIO solver.
+        TRITON_EXPORT std::map<std::string, triton::usize> getSolverPortfolioStats(void) const;
+
+        //! [**solver api**] - Returns the counters of each worker process of the SOLVER_PROCESS_POOL solver.
+        TRITON_EXPORT std::vector<triton::engines::solver::SolverWorkerStats> getSolverWorkerStats(void) const;
+
+        //! [**solver api**] - Defines the number of z3 instances with the random seeds 1 to `seeds` raced by the SOLVER_PORTFOLIO solver, next to the default one.
+        TRITON_EXPORT void setSolverPortfolioSeeds(triton::uint32 seeds);
+
+        //! [**solver api**] - Defines the number of worker processes of the SOLVER_PROCESS_POOL solver, one per core if 0.
+        TRITON_EXPORT void setSolverWorkers(triton::uint32 workers);
+
+        //! [**solver api**] - Adds the queries of a file written by saveSolverCache() to the query cache.
+        TRITON_EXPORT void loadSolverCache(const std::string& path);
+
+        //! [**solver api**] - Writes the query cache to a file, so that another run can skip the queries it already solved.
+        TRITON_EXPORT void saveSolverCache(const std::string& path) const;
+
+        //! [**solver api**] - Writes every query sent to the solver to a directory as SMT-LIB2 with its metadata, to be replayed by `triton-solver-bench`. An empty path stops recording.
+        TRITON_EXPORT void setSolverRecordDirectory(const std::string& path);
+
+        //! [**solver api**] - Returns the directory of the recorded solver queries, empty if queries are not recorded.
+        TRITON_EXPORT const std::string& getSolverRecordDirectory(void) const;
+
+        //! [**solver api**] - Opens a new scope in the incremental solver session.
+        TRITON_EXPORT void pushSolverScope(void);
+
+        //! [**solver api**] - Closes the last scope of the incremental solver session.
+        TRITON_EXPORT void popSolverScope(void);
+
+        //! [**solver api**] - Asserts a constraint in the current scope of the incremental solver session.
+        TRITON_EXPORT void assertConstraint(const triton::ast::SharedAbstractNode& node);
+
+        /*!
+         * \brief [**solver api**] - Checks the constraints of the incremental solver session together with an assumption (if not null) which is not kept in the session. Returns a model if it is satisfiable.
+         *
+         * \details
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         */
+        TRITON_EXPORT std::unordered_map<triton::usize, triton::engines::solver::SolverModel> checkWithAssumption(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+        //! [**solver api**] - Drops the incremental solver session, its scopes and its translated constraints.
+        TRITON_EXPORT void resetSolverSession(void);
+
+        //! [**solver api**] - Returns the number of constraints asserted in the incremental solver session.
+        TRITON_EXPORT triton::usize getSolverSessionSize(void) const;
+
 
 
         /* Taint engine API ============================================================================== */
@@ -0,0 +1,109 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_DECODECACHE_H
+#define TRITON_DECODECACHE_H
+
+#include <unordered_map>
+
+#include <triton/architecture.hpp>
+#include <triton/basicBlock.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class DecodeCacheStats
+        \brief The counters of the decode cache. */
+    class DecodeCacheStats {
+      public:
+        //! The number of instructions restored from the cache.
+        triton::usize hits;
+
+        //! The number of instructions decoded by the CPU.
+        triton::usize misses;
+
+        //! The number of times the cache has been flushed because it was full.
+        triton::usize flushes;
+
+        //! Constructor.
+        DecodeCacheStats() : hits(0), misses(0), flushes(0) {}
+    };
+
+
+    /*! \class DecodeCache
+     *  \brief The cache of decoded instructions.
+     *
+     *  \details
+     *  Decoding an instruction with Capstone and rebuilding its operands is done every time the same
+     *  bytes are processed. The cache keeps the decoded instruction keyed by its address, its opcode
+     *  bytes and the Thumb state of the CPU, and restores it on the next execution. Only the decode is
+     *  cached: semantics are always built again against the current state. The whole cache is flushed
+     *  once it holds `capacity` instructions.
+     */
+    class DecodeCache {
+      private:
+        //! Architecture API
+        triton::arch::Architecture* architecture;
+
+        //! The decoded instructions <addr : Instruction>
+        std::unordered_map<triton::uint64, triton::arch::Instruction> entries;
+
+        //! The maximum number of cached instructions.
+        triton::usize capacity;
+
+        //! The counters.
+        triton::arch::DecodeCacheStats stats;
+
+        //! Returns the cached instruction which decodes the opcode of `inst`, nullptr if there is none.
+        const triton::arch::Instruction* lookup(const triton::arch::Instruction& inst) const;
+
+      public:
+        //! Constructor.
+        TRITON_EXPORT DecodeCache(triton::arch::Architecture* architecture, triton::usize capacity=0x10000);
+
+        //! Disassembles the instruction, restoring it from the cache when possible.
+        TRITON_EXPORT void disassembly(triton::arch::Instruction& inst);
+
+        //! Disassembles a basic block starting at `addr`, restoring instructions from the cache when possible.
+        TRITON_EXPORT void disassembly(triton::arch::BasicBlock& block, triton::uint64 addr);
+
+        //! Removes all cached instructions.
+        TRITON_EXPORT void clear(void);
+
+        //! Returns the number of cached instructions.
+        TRITON_EXPORT triton::usize size(void) const;
+
+        //! Returns the counters of the cache.
+        TRITON_EXPORT const triton::arch::DecodeCacheStats& getStats(void) const;
+
+        //! Resets the counters of the cache.
+        TRITON_EXPORT void clearStats(void);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DECODECACHE_H */
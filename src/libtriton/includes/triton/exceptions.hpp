@@ -144,6 +144,18 @@ namespace triton {
     };
 
 
+    /*! \class FunctionSummaries
+     *  \brief The exception class used by function summaries. */
+    class FunctionSummaries : public triton::exceptions::SymbolicEngine {
+      public:
+        //! Constructor.
+        TRITON_EXPORT FunctionSummaries(const char* message) : triton::exceptions::SymbolicEngine(message) {};
+
+        //! Constructor.
+        TRITON_EXPORT FunctionSummaries(const std::string& message) : triton::exceptions::SymbolicEngine(message) {};
+    };
+
+
     /*! \class TaintEngine
      *  \brief The exception class used by the taint engine. */
     class TaintEngine : public triton::exceptions::Engines {
@@ -180,6 +192,18 @@ namespace triton {
     };
 
 
+    /*! \class Trace
+     *  \brief The exception class used by the trace recorder and replayer. */
+    class Trace : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        TRITON_EXPORT Trace(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        TRITON_EXPORT Trace(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
     /*! \class SolverEngine
      *  \brief The exception class used by the solver engine. */
     class SolverEngine : public triton::exceptions::Engines {
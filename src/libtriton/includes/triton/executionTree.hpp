@@ -0,0 +1,242 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_EXECUTIONTREE_H
+#define TRITON_EXECUTIONTREE_H
+
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/symbolicEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class ExecutionTreeStats
+          \brief The counters of the execution tree. */
+      class ExecutionTreeStats {
+        public:
+          //! The number of branch instructions.
+          triton::usize nodes;
+
+          //! The number of unexplored branches.
+          triton::usize unexplored;
+
+          //! The number of branches handed out and not resolved yet.
+          triton::usize pending;
+
+          //! The number of explored branches.
+          triton::usize explored;
+
+          //! The number of infeasible branches.
+          triton::usize infeasible;
+
+          //! The number of branches which timed out.
+          triton::usize timeout;
+
+          //! The number of times a run did not take the satisfiable branch whose model it followed.
+          triton::usize diverged;
+
+          //! Constructor.
+          ExecutionTreeStats() : nodes(0), unexplored(0), pending(0), explored(0), infeasible(0), timeout(0), diverged(0) {}
+      };
+
+
+      /*! \class ExecutionFrontier
+          \brief An unexplored branch of the execution tree. */
+      class ExecutionFrontier {
+        public:
+          //! The id of the branch, given back to ExecutionTree::resolve().
+          triton::usize id;
+
+          //! The address of the branch instruction.
+          triton::uint64 source;
+
+          //! The destination of the branch.
+          triton::uint64 destination;
+
+          //! The thread id of the branch instruction.
+          triton::uint32 threadId;
+
+          //! The conjunction of the predicates taken from the root to the branch instruction, null at the root.
+          triton::ast::SharedAbstractNode prefix;
+
+          //! The predicate to solve to take the branch, i.e. the prefix and the branch constraint.
+          triton::ast::SharedAbstractNode predicate;
+
+          //! Constructor.
+          ExecutionFrontier() : id(0), source(0), destination(0), threadId(0) {}
+      };
+
+
+      /*! \class ExecutionTree
+       *  \brief The tree of the paths explored by successive runs.
+       *
+       *  \details
+       *  Successive runs of a concolic loop share long prefixes. The path constraints of each run are
+       *  merged into a tree whose nodes are branch instructions, keyed by (source, thread id), and whose
+       *  edges are their destinations. Directions seen but not taken are queued as frontiers in discovery
+       *  order and handed out with their prefix predicate, then resolved with the status of the solver.
+       *  Edges hold no AST: a frontier keeps its predicate and the predicates taken by the run which
+       *  discovered it, shared by the frontiers of that run and released once they are explored or
+       *  infeasible. A satisfiable frontier is expected to be taken by the run which follows its model,
+       *  merged with its id. If it is not, its model diverged and it is handed out again, then parked as
+       *  timeout if it diverges twice. Other satisfiable frontiers stay pending until their own run.
+       *  Nodes and edges live in two vectors linked by 32-bit indexes so millions of branches stay compact.
+       */
+      class ExecutionTree {
+        private:
+          //! No link.
+          static constexpr triton::uint32 none = 0xffffffff;
+
+          //! A branch instruction.
+          struct Node {
+            //! The address of the branch instruction.
+            triton::uint64 source;
+
+            //! The thread id of the branch instruction.
+            triton::uint32 threadId;
+
+            //! The edge leading to the node.
+            triton::uint32 parent;
+
+            //! The next node reached by the same edge.
+            triton::uint32 sibling;
+
+            //! The first edge of the node.
+            triton::uint32 edges;
+          };
+
+          //! A direction of a branch instruction.
+          struct Edge {
+            //! The destination of the direction.
+            triton::uint64 destination;
+
+            //! The node of the edge.
+            triton::uint32 node;
+
+            //! The first node reached by the edge.
+            triton::uint32 child;
+
+            //! The next edge of the same node.
+            triton::uint32 next;
+
+            //! The state of the direction.
+            triton::engines::symbolic::branch_e state;
+
+            //! The number of runs which did not take the direction while following its model.
+            triton::uint32 divergences;
+
+            //! True if the direction is pending and its predicate is satisfiable.
+            bool awaiting;
+          };
+
+          //! The predicates of a direction not explored yet.
+          struct Branch {
+            //! The constraint which must be true to take the direction.
+            triton::ast::SharedAbstractNode predicate;
+
+            //! The predicates taken by the run which discovered the direction, shared by the directions of that run.
+            std::shared_ptr<const std::vector<triton::ast::SharedAbstractNode>> path;
+
+            //! The number of predicates of `path` taken from the root to the branch instruction.
+            triton::usize length;
+          };
+
+          //! The nodes of the tree.
+          std::vector<Node> nodes;
+
+          //! The edges of the tree. The first one is the virtual edge leading to the roots.
+          std::vector<Edge> edges;
+
+          //! The unexplored edges in discovery order.
+          std::deque<triton::uint32> frontier;
+
+          //! The predicates of the edges which are neither explored nor infeasible <edge : Branch>.
+          std::unordered_map<triton::uint32, Branch> branches;
+
+          //! The counters.
+          triton::engines::symbolic::ExecutionTreeStats stats;
+
+          //! Returns the counter of a state.
+          triton::usize& counter(triton::engines::symbolic::branch_e state);
+
+          //! Moves an edge to another state.
+          void setState(triton::uint32 edge, triton::engines::symbolic::branch_e state);
+
+          //! Returns the edge of `node` leading to `destination`, adding it if missing.
+          triton::uint32 getEdge(triton::uint32 node, triton::uint64 destination, bool& added);
+
+          //! Returns the child of `edge` for the branch instruction (source, threadId), adding it if missing.
+          triton::uint32 getNode(triton::uint32 edge, triton::uint64 source, triton::uint32 threadId, bool& added);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT ExecutionTree();
+
+          //! Merges the path constraints of a run which followed the model of the satisfiable branch `followed`, 0 if none. Returns the number of new branch instructions. The branch is handed out again if the run did not take it.
+          TRITON_EXPORT triton::usize merge(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::usize followed=0);
+
+          //! Hands out the next unexplored branch and marks it as pending. Returns false if there is none.
+          TRITON_EXPORT bool getNextFrontier(ExecutionFrontier& frontier);
+
+          //! Resolves a pending branch with the status of its predicate. A satisfiable branch stays pending until the run following its model is merged.
+          TRITON_EXPORT void resolve(triton::usize id, triton::engines::solver::status_e status);
+
+          //! Hands out again the branches which timed out, e.g. to solve them with a larger timeout.
+          TRITON_EXPORT void retryTimeouts(void);
+
+          //! Returns the state of a branch.
+          TRITON_EXPORT triton::engines::symbolic::branch_e getState(triton::usize id) const;
+
+          //! Returns the counters of the tree.
+          TRITON_EXPORT const triton::engines::symbolic::ExecutionTreeStats& getStats(void) const;
+
+          //! Returns the number of branch instructions.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Removes all branches.
+          TRITON_EXPORT void clear(void);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXECUTIONTREE_H */
@@ -0,0 +1,182 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_FUNCTIONSUMMARIES_H
+#define TRITON_FUNCTIONSUMMARIES_H
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+#include <triton/architecture.hpp>
+#include <triton/ast.hpp>
+#include <triton/astContext.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/modes.hpp>
+#include <triton/operandWrapper.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/symbolicEnums.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      /*! \class FunctionSummaries
+       *  \brief Native symbolic summaries of the libc functions shipped as stubs.
+       *
+       *  \details
+       *  When an instruction is processed at a summarized address, the whole function is applied at once
+       *  instead of the instruction semantics: the return value and the written memory are computed, then
+       *  the function returns to its caller. Arguments follow the calling convention registered with the
+       *  summary: System V or Microsoft x64 on x86-64, cdecl on x86 and AAPCS64 on AArch64. Pointers and
+       *  lengths are taken from their concrete values, and symbolic lengths of strings are expressed with
+       *  ITE chains covering at most `bound` bytes.
+       */
+      class FunctionSummaries {
+        private:
+          //! The kinds of summaries.
+          enum summary_e {
+            SUMMARY_MEMCMP,
+            SUMMARY_MEMCPY,
+            SUMMARY_MEMMOVE,
+            SUMMARY_MEMPCPY,
+            SUMMARY_MEMSET,
+            SUMMARY_STRCMP,
+            SUMMARY_STRLEN,
+            SUMMARY_STRNCMP,
+            SUMMARY_STRNLEN,
+          };
+
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! AstContext API
+          triton::ast::SharedAstContext astCtxt;
+
+          //! Modes API
+          triton::modes::SharedModes modes;
+
+          //! Symbolic engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! Taint engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! The summarized addresses <addr : <name, kind, abi>>
+          std::unordered_map<triton::uint64, std::tuple<std::string, summary_e, triton::engines::symbolic::abi_e>> summaries;
+
+          //! The calling convention of the summary being applied.
+          triton::engines::symbolic::abi_e abi;
+
+          //! How many times each summary has been applied.
+          std::map<std::string, triton::usize> hits;
+
+          //! The maximum number of bytes covered by an ITE chain.
+          triton::uint32 bound;
+
+          //! Returns the kind of a summary from a symbol name. Returns false if there is no summary for this name.
+          static bool getKind(const std::string& name, summary_e& kind);
+
+          //! Returns the calling convention of the summaries registered with `abi` on the current architecture. Throws if the architecture does not support it.
+          triton::engines::symbolic::abi_e getAbi(triton::engines::symbolic::abi_e abi) const;
+
+          //! Returns the operand holding the nth argument of the function.
+          triton::arch::OperandWrapper getArgument(triton::uint32 index) const;
+
+          //! Returns the concrete value of the nth argument of the function.
+          triton::uint64 getConcreteArgument(triton::arch::Instruction& inst, triton::uint32 index);
+
+          //! Returns the register which holds the return value.
+          const triton::arch::Register& getReturnRegister(void) const;
+
+          //! Assigns the return value.
+          void setReturnValue(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, bool tainted);
+
+          //! Returns to the caller.
+          void returnToCaller(triton::arch::Instruction& inst);
+
+          //! The memcpy, memmove and mempcpy summary.
+          void copy(triton::arch::Instruction& inst, bool end);
+
+          //! The memset summary.
+          void set(triton::arch::Instruction& inst);
+
+          //! The strlen and strnlen summary.
+          void length(triton::arch::Instruction& inst, bool bounded);
+
+          //! The strcmp, strncmp and memcmp summary.
+          void compare(triton::arch::Instruction& inst, bool bounded, bool string);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT FunctionSummaries(triton::arch::Architecture* architecture,
+                                          const triton::modes::SharedModes& modes,
+                                          triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                          triton::engines::taint::TaintEngine* taintEngine,
+                                          const triton::ast::SharedAstContext& astCtxt);
+
+          //! Returns true if a summary exists for this symbol name.
+          TRITON_EXPORT static bool isSupported(const std::string& name);
+
+          //! Registers the summary of `name` at `addr`, its arguments following the `abi` calling convention.
+          TRITON_EXPORT void addSummary(triton::uint64 addr, const std::string& name, triton::engines::symbolic::abi_e abi=triton::engines::symbolic::DEFAULT_ABI);
+
+          //! Registers the summary of every supported symbol of a stubs map, `symbols` being offsets from `base` and `abi` the calling convention of the stubs. Returns the number of registered summaries.
+          TRITON_EXPORT triton::usize addSummaries(triton::uint64 base, const std::map<std::string, triton::uint64>& symbols, triton::engines::symbolic::abi_e abi=triton::engines::symbolic::DEFAULT_ABI);
+
+          //! Removes all summaries.
+          TRITON_EXPORT void clearSummaries(void);
+
+          //! Returns true if a summary is registered at `addr`.
+          TRITON_EXPORT bool isSummarized(triton::uint64 addr) const;
+
+          //! Sets the maximum number of bytes covered by an ITE chain.
+          TRITON_EXPORT void setBound(triton::uint32 bound);
+
+          //! Returns the maximum number of bytes covered by an ITE chain.
+          TRITON_EXPORT triton::uint32 getBound(void) const;
+
+          //! Returns how many times each summary has been applied.
+          TRITON_EXPORT const std::map<std::string, triton::usize>& getHits(void) const;
+
+          //! Applies the summary registered at the address of the instruction. Returns `triton::arch::NO_FAULT` if succeed.
+          TRITON_EXPORT triton::arch::exception_e apply(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_FUNCTIONSUMMARIES_H */
@@ -12,11 +12,13 @@
 #include <triton/architecture.hpp>
 #include <triton/basicBlock.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/functionSummaries.hpp>
 #include <triton/instruction.hpp>
 #include <triton/modes.hpp>
 #include <triton/semanticsInterface.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/taintEngine.hpp>
+#include <triton/x8664Interpreter.hpp>
 
 
 
@@ -54,6 +56,12 @@ namespace triton {
         //! Taint engine API
         triton::engines::taint::TaintEngine* taintEngine;
 
+        //! Function summaries API
+        triton::engines::symbolic::FunctionSummaries* summaries;
+
+        //! Native interpreter of concrete x86-64 instructions.
+        triton::arch::x86::x8664Interpreter* interpreter;
+
         //! Removes all symbolic expressions of an instruction.
         void removeSymbolicExpressions(triton::arch::Instruction& inst);
 
@@ -88,7 +96,8 @@ namespace triton {
                                 const triton::modes::SharedModes& modes,
                                 const triton::ast::SharedAstContext& astCtxt,
                                 triton::engines::symbolic::SymbolicEngine* symbolicEngine,
-                                triton::engines::taint::TaintEngine* taintEngine);
+                                triton::engines::taint::TaintEngine* taintEngine,
+                                triton::engines::symbolic::FunctionSummaries* summaries=nullptr);
 
         //! Destructor.
         TRITON_EXPORT virtual ~IrBuilder();
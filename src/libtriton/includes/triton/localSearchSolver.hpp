@@ -0,0 +1,147 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_LOCALSEARCHSOLVER_H
+#define TRITON_LOCALSEARCHSOLVER_H
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class LocalSearchSolver
+      /*! \brief Solver engine mutating the variables of a query until it holds.
+       *
+       *  \details
+       *  The query is compiled to a flat program over 64-bit values and evaluated natively. Starting from the
+       *  concrete values of the variables, the search mutates them (bit flips, steps growing while they get
+       *  closer, random and dictionary values) to minimize the distance to satisfy each conjunct, e.g. `|a - b|`
+       *  for `a == b`. A query is either SAT with a model or UNKNOWN: the search cannot prove that a query is
+       *  unsatisfiable, except when a conjunct is false whatever the variables. Queries over arrays or values
+       *  wider than 64 bits are UNKNOWN. It is meant to be raced with SMT solvers, see PortfolioSolver.
+       */
+      class LocalSearchSolver : public SolverInterface {
+        private:
+          //! The search timeout. By default, `defaultTimeout`. This global timeout may be changed for a specific query via argument `timeout`.
+          triton::uint32 timeout;
+
+          //! The memory limit. Unused, the search does not allocate while it runs.
+          triton::uint32 memoryLimit;
+
+          //! The random seed of the search. By default, 0.
+          triton::uint32 seed;
+
+          //! True if the queries are interrupted by interrupt().
+          std::atomic<bool> interrupted;
+
+          //! The time spent in each phase by the last query.
+          mutable triton::engines::solver::SolverStats stats;
+
+          //! Protects `stats`, queries being solved from several threads.
+          mutable std::mutex statsLock;
+
+          //! Collects the counters of a query and publishes them to `stats`.
+          class QueryStats;
+
+          //! Runs the search and returns at most `limit` models differing on the `projection` variables.
+          std::vector<std::unordered_map<triton::usize, SolverModel>> search(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const;
+
+        public:
+          //! The search timeout (in milliseconds) when none is defined, the search never ending otherwise.
+          static const triton::uint32 defaultTimeout = 1000;
+
+          //! Constructor.
+          TRITON_EXPORT LocalSearchSolver();
+
+          //! Computes and returns a model from a symbolic constraint. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models which differ on the `projection` variables, each model only holding these variables. An empty projection enumerates the models on all variables. The `limit` is the max number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns the name of this solver.
+          TRITON_EXPORT std::string getName(void) const;
+
+          //! Returns the time spent in each phase by the last query. `translation` is the compilation of the query and `check` the search.
+          TRITON_EXPORT triton::engines::solver::SolverStats getStats(void) const;
+
+          //! Defines a solver timeout (in milliseconds).
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Defines a solver memory consumption limit (in megabytes).
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Defines the random seed of the search.
+          TRITON_EXPORT void setSeed(triton::uint32 seed);
+
+          //! Interrupts the queries being solved, and the ones started until it is called with `false`. Thread-safe.
+          TRITON_EXPORT void interrupt(bool enable=true);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_LOCALSEARCHSOLVER_H */
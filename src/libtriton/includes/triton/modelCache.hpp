@@ -0,0 +1,115 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_MODELCACHE_H
+#define TRITON_MODELCACHE_H
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class ModelCacheStats
+          \brief The counters of the model cache. */
+      class ModelCacheStats {
+        public:
+          //! The number of queries satisfied by the concrete values.
+          triton::usize concrete;
+
+          //! The number of queries satisfied by a recent model.
+          triton::usize hits;
+
+          //! The number of queries sent to the solver.
+          triton::usize misses;
+
+          //! Constructor.
+          ModelCacheStats() : concrete(0), hits(0), misses(0) {}
+      };
+
+
+      /*! \class ModelCache
+       *  \brief The cache of recent models.
+       *
+       *  \details
+       *  Many queries are satisfied by the current concrete values or by a model returned shortly before.
+       *  Before a query is sent to the solver, it is evaluated under these assignments, variables missing
+       *  from a recent model keeping their concrete value. The evaluation does not touch the AST, and gives
+       *  up on arrays and floating-point nodes. At most `capacity` models are kept, the least recently
+       *  used one being dropped first.
+       */
+      class ModelCache {
+        private:
+          //! The recent models <variable id : value>, from the most to the least recently used.
+          std::list<std::unordered_map<triton::usize, triton::uint512>> models;
+
+          //! The maximum number of models.
+          triton::usize capacity;
+
+          //! The counters.
+          triton::engines::solver::ModelCacheStats stats;
+
+        public:
+          //! Evaluates the topologically sorted `nodes` under an assignment <var id : value>. Returns false if a node cannot be evaluated.
+          TRITON_EXPORT static bool evaluate(const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::unordered_map<triton::usize, triton::uint512>& values, triton::uint512& result);
+
+          //! Constructor.
+          TRITON_EXPORT ModelCache(triton::usize capacity=8);
+
+          //! Looks for an assignment satisfying a query. Fills `model` with it if not null. Returns false on a miss.
+          TRITON_EXPORT bool lookup(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>* model);
+
+          //! Records a model returned by the solver.
+          TRITON_EXPORT void insert(const std::unordered_map<triton::usize, SolverModel>& model);
+
+          //! Removes all models.
+          TRITON_EXPORT void clear(void);
+
+          //! Returns the number of models.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the counters of the cache.
+          TRITON_EXPORT const triton::engines::solver::ModelCacheStats& getStats(void) const;
+
+          //! Resets the counters of the cache.
+          TRITON_EXPORT void clearStats(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MODELCACHE_H */
@@ -27,14 +27,25 @@ namespace triton {
 
     //! Enumerates all kinds of mode.
     enum mode_e {
+      ABSTRACT_INTERPRETATION,        //!< [AST] Compute the known bits and intervals of nodes to drop no-op masks and to decide queries without the solver.
       ALIGNED_MEMORY,                 //!< [symbolic] Keep a map of aligned memory.
       AST_OPTIMIZATIONS,              //!< [AST] Classical arithmetic optimisations to reduce the depth of the trees.
+      CONCRETIZE_ON_BUDGET,           //!< [symbolic] Concretize new symbolic expressions which exceed the concretization budget.
       CONCRETIZE_UNDEFINED_REGISTERS, //!< [symbolic] Concretize every registers tagged as undefined (see #750).
       CONSTANT_FOLDING,               //!< [symbolic] Perform a constant folding optimization of sub ASTs which do not contain symbolic variables.
+      CONSTRAINT_INDEPENDENCE,        //!< [solver] Only send the constraints which share symbolic variables with the unsatisfied ones to the solver.
+      DEAD_FLAG_ELIMINATION,          //!< [symbolic] When processing a basic block, do not build the flag expressions overwritten in the block without being read.
+      DECODE_CACHE,                   //!< [disassembly] Restore already decoded instructions from a cache instead of decoding them again.
+      LAZY_FLAGS,                     //!< [symbolic] Build the AST of a flag only when the flag is read.
       MEMORY_ARRAY,                   //!< [symbolic] Enable memory symbolic array
-      ONLY_ON_SYMBOLIZED,             //!< [symbolic] Perform symbolic execution only on symbolized expressions.
+      MODEL_REUSE,                    //!< [solver] Before solving a query, try the concrete values and the recent models on it.
+      NATIVE_INTERPRETER,             //!< [symbolic] Execute concrete x86-64 instructions natively, without building their semantics.
+      ONLY_ON_SYMBOLIZED,             //!< [symbolic] Perform symbolic execution only on symbolized expressions. Concrete x86-64 instructions are executed natively.
       ONLY_ON_TAINTED,                //!< [symbolic] Perform symbolic execution only on tainted instructions.
+      OPTIMISTIC_SOLVING,             //!< [solver] When a query is unsat or times out, solve its last conjunct alone and return an optimistic model.
       PC_TRACKING_SYMBOLIC,           //!< [symbolic] Track path constraints only if they are symbolized.
+      SOLVER_CACHE,                   //!< [solver] Restore the result of a query already solved from a cache keyed by its structure.
+      STORE_LOAD_FORWARDING,          //!< [symbolic] Forward a stored expression to a load when it covers all the loaded bytes.
       SYMBOLIZE_INDEX_ROTATION,       //!< [symbolic] Symbolize index rotation for bvrol and bvror (see #751). This mode increases the complexity of solving.
       SYMBOLIZE_LOAD,                 //!< [symbolic] Symbolize memory load if memory array is enabled
       SYMBOLIZE_STORE,                //!< [symbolic] Symbolize memory store if memory array is enabled
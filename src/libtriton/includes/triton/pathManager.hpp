@@ -11,6 +11,7 @@
 #include <vector>
 
 #include <triton/dllexport.hpp>
+#include <triton/executionTree.hpp>
 #include <triton/instruction.hpp>
 #include <triton/modes.hpp>
 #include <triton/pathConstraint.hpp>
@@ -56,6 +57,9 @@ namespace triton {
           //! \brief The logical conjunction vector of path constraints.
           std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
 
+          //! \brief The tree of the path constraints merged across runs.
+          triton::engines::symbolic::ExecutionTree executionTree;
+
         public:
           //! Constructor.
           TRITON_EXPORT PathManager(const triton::modes::SharedModes& modes, const triton::ast::SharedAstContext& astCtxt);
@@ -98,6 +102,15 @@ namespace triton {
 
           //! Clears the current path predicate.
           TRITON_EXPORT void clearPathConstraints(void);
+
+          //! Merges the current path constraints into the execution tree, `frontier` being the id of the branch whose model the run followed, if any. Returns the number of new branch instructions.
+          TRITON_EXPORT triton::usize mergePathConstraints(triton::usize frontier=0);
+
+          //! Returns the execution tree.
+          TRITON_EXPORT triton::engines::symbolic::ExecutionTree& getExecutionTree(void);
+
+          //! Returns the execution tree.
+          TRITON_EXPORT const triton::engines::symbolic::ExecutionTree& getExecutionTree(void) const;
       };
 
     /*! @} End of symbolic namespace */
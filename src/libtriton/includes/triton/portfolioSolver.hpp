@@ -0,0 +1,156 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_PORTFOLIOSOLVER_H
+#define TRITON_PORTFOLIOSOLVER_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/config.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class PortfolioSolver
+      /*! \brief Solver engine racing several solvers on each query.
+       *
+       *  \details
+       *  Each query is sent to every backend, z3 and Bitwuzla when available plus z3 instances with other
+       *  random seeds and a local search, each one in its own thread. The first SAT or UNSAT answer is returned and the other
+       *  backends are interrupted. The number of queries won by each backend is recorded to tune the
+       *  default solver of a workload.
+       */
+      class PortfolioSolver : public SolverInterface {
+        private:
+          //! The backends.
+          std::vector<std::unique_ptr<triton::engines::solver::SolverInterface>> backends;
+
+          //! The names of the backends.
+          std::vector<std::string> names;
+
+          //! The number of queries won by each backend.
+          mutable std::vector<triton::usize> wins;
+
+          //! Protects `wins` and `last`, the solver being usable from several threads.
+          mutable std::mutex winsLock;
+
+          //! The backend which answered the last query.
+          mutable triton::usize last;
+
+          //! The local search backend.
+          triton::usize localSearch;
+
+          //! The solver timeout (in milliseconds), applied to the backends.
+          triton::uint32 timeout;
+
+          //! The solver memory consumption limit (in megabytes), applied to the backends.
+          triton::uint32 memoryLimit;
+
+          //! Creates the backends, with `seeds` more z3 instances.
+          void build(triton::uint32 seeds);
+
+          //! Runs a query on all backends and returns the first definitive answer. `limit` is the number of models, 0 for isSat().
+          std::vector<std::unordered_map<triton::usize, SolverModel>> race(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const;
+
+        public:
+          //! Constructor. `seeds` more z3 instances are raced with the random seeds 1 to `seeds`.
+          TRITON_EXPORT PortfolioSolver(triton::uint32 seeds=0);
+
+          //! Races `seeds` more z3 instances with the random seeds 1 to `seeds`. The backends are created again and the wins are reset.
+          TRITON_EXPORT void setSeeds(triton::uint32 seeds);
+
+          //! Computes and returns a model from a symbolic constraint. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models which differ on the `projection` variables, each model only holding these variables. An empty projection enumerates the models on all variables. The `limit` is the max number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns the name of this solver.
+          TRITON_EXPORT std::string getName(void) const;
+
+          //! Returns the time spent in each phase by the backend which answered the last query.
+          TRITON_EXPORT triton::engines::solver::SolverStats getStats(void) const;
+
+          //! Returns the number of queries won by each backend, by backend name.
+          TRITON_EXPORT std::map<std::string, triton::usize> getWins(void) const;
+
+          //! Resets the number of queries won by each backend.
+          TRITON_EXPORT void clearWins(void);
+
+          //! Interrupts the queries being solved by all backends. Thread-safe.
+          TRITON_EXPORT void interrupt(bool enable=true);
+
+          //! Defines a solver timeout (in milliseconds).
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Defines a solver memory consumption limit (in megabytes).
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PORTFOLIOSOLVER_H */
@@ -0,0 +1,165 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_PROCESSPOOLSOLVER_H
+#define TRITON_PROCESSPOOLSOLVER_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverInterface.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SolverWorkerStats
+          \brief The counters of a worker process of the ProcessPoolSolver. */
+      class SolverWorkerStats {
+        public:
+          //! The process id of the worker, 0 if it is not running.
+          triton::sint32 pid;
+
+          //! The number of queries sent to the worker.
+          triton::usize queries;
+
+          //! The number of times the worker crashed or was killed, and then restarted.
+          triton::usize crashes;
+
+          //! The number of queries which exceeded their time or CPU limit.
+          triton::usize timeouts;
+
+          //! The time spent waiting for the worker, in microseconds.
+          triton::uint64 time;
+
+          //! Constructor.
+          SolverWorkerStats() : pid(0), queries(0), crashes(0), timeouts(0), time(0) {}
+      };
+
+
+      //! \class ProcessPoolSolver
+      /*! \brief Solver engine sending the queries to worker processes.
+       *
+       *  \details
+       *  The queries are serialized and sent over a socket to worker processes. The workers are forked by a
+       *  spawner process, itself forked when the solver is created, which keeps no descriptor of the analysis
+       *  process; create the solver before the analysis starts threads. Each worker rebuilds the AST in its
+       *  own context and solves it with z3 or Bitwuzla under RLIMIT_AS and RLIMIT_CPU limits, derived from
+       *  the memory limit and the timeout. A query without timeout is given ten minutes. A query which
+       *  crashes its worker or exceeds its limits is answered TIMEOUT, OUTOFMEM or UNKNOWN, and the worker is
+       *  restarted for the next query, so that the analysis process survives pathological queries. Queries
+       *  from several threads are solved at once, one per worker. Copies of an instance share its workers.
+       *  Only available on POSIX systems.
+       */
+      class ProcessPoolSolver : public SolverInterface {
+        public:
+          //! The workers and their settings. Defined with the implementation.
+          class Pool;
+
+        private:
+          //! The workers, shared by the copies of this instance.
+          std::shared_ptr<Pool> pool;
+
+          //! The time spent in each phase by the last query, as measured by the worker.
+          mutable triton::engines::solver::SolverStats stats;
+
+          //! Sends a query to a worker and returns at most `limit` models differing on the `projection` variables, none for isSat().
+          std::vector<std::unordered_map<triton::usize, SolverModel>> query(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status, triton::uint32 timeout, triton::uint32* solvingTime) const;
+
+        public:
+          //! Constructor. The `workers` run the `backend` solver, one per core and z3 if available by default.
+          TRITON_EXPORT ProcessPoolSolver(triton::uint32 workers=0, triton::engines::solver::solver_e backend=triton::engines::solver::SOLVER_INVALID);
+
+          //! Constructor by copy. The copy shares the workers.
+          TRITON_EXPORT ProcessPoolSolver(const ProcessPoolSolver& other);
+
+          //! Computes and returns a model from a symbolic constraint. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> getModel(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes and returns several models which differ on the `projection` variables, each model only holding these variables. An empty projection enumerates the models on all variables. The `limit` is the max number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns true if an expression is satisfiable.
+          TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Returns the name of this solver.
+          TRITON_EXPORT std::string getName(void) const;
+
+          //! Returns the time spent in each phase by the last query, as measured by the worker.
+          TRITON_EXPORT triton::engines::solver::SolverStats getStats(void) const;
+
+          //! Returns the counters of each worker.
+          TRITON_EXPORT std::vector<triton::engines::solver::SolverWorkerStats> getWorkerStats(void) const;
+
+          //! Defines the number of workers, one per core if 0. Waits for the queries being solved.
+          TRITON_EXPORT void setWorkers(triton::uint32 workers);
+
+          //! Interrupts the queries being solved by killing their workers, and the ones started until it is called with `false`. Thread-safe.
+          TRITON_EXPORT void interrupt(bool enable=true);
+
+          //! Defines a solver timeout (in milliseconds). Workers are also limited to this CPU time, rounded up to the second.
+          TRITON_EXPORT void setTimeout(triton::uint32 ms);
+
+          //! Defines a solver memory consumption limit (in megabytes). Workers are also limited to this much address space on top of the one they inherit.
+          TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PROCESSPOOLSOLVER_H */
@@ -0,0 +1,189 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERCACHE_H
+#define TRITON_SOLVERCACHE_H
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicVariable.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! The format of a solver cache file.
+      namespace cacheFormat {
+        //! The magic of a solver cache file.
+        constexpr char magic[8] = {'T', 'R', 'S', 'C', 'A', 'C', 'H', 'E'};
+
+        //! The current version of the solver cache format.
+        constexpr triton::uint32 version = 2;
+      };
+
+
+      /*! \class SolverCacheStats
+          \brief The counters of the solver cache. */
+      class SolverCacheStats {
+        public:
+          //! The number of queries restored from the cache.
+          triton::usize hits;
+
+          //! The number of queries sent to the solver.
+          triton::usize misses;
+
+          //! The number of entries dropped because the cache was full.
+          triton::usize evictions;
+
+          //! The number of entries dropped because their model does not satisfy the query.
+          triton::usize rejections;
+
+          //! Constructor.
+          SolverCacheStats() : hits(0), misses(0), evictions(0), rejections(0) {}
+      };
+
+
+      /*! \class SolverQuery
+          \brief The canonical form of a query. */
+      class SolverQuery {
+        public:
+          //! The structural hash of the query, its symbolic variables being numbered by id ordering.
+          std::pair<triton::uint64, triton::uint64> key;
+
+          //! The symbolic variables of the query sorted by id. The canonical number of a variable is its index.
+          std::vector<triton::engines::symbolic::SharedSymbolicVariable> variables;
+
+          //! The nodes of the query in topological order, to check a cached model.
+          std::vector<triton::ast::SharedAbstractNode> nodes;
+      };
+
+
+      /*! \class SolverCache
+       *  \brief The cache of solver results.
+       *
+       *  \details
+       *  Concolic loops send the same queries again, often on fresh symbolic variables. A query is keyed by
+       *  a 128-bit hash of its structure where each variable is replaced by its rank in id ordering, so
+       *  alpha-equivalent queries share an entry. An entry keeps the status of the query, and its model
+       *  by canonical variable number once getModel() has been called. A cached model is evaluated on the
+       *  query before it is returned, and its entry is dropped if it does not satisfy it. Timeouts are
+       *  only reused by queries which do not allow more time. The least recently used entry is dropped
+       *  once the cache holds `capacity` entries.
+       */
+      class SolverCache {
+        private:
+          //! Hashes a key.
+          struct KeyHash {
+            triton::usize operator()(const std::pair<triton::uint64, triton::uint64>& key) const {
+              return static_cast<triton::usize>(key.first ^ key.second);
+            }
+          };
+
+          //! A cached result.
+          struct Entry {
+            //! The status of the query.
+            triton::engines::solver::status_e status;
+
+            //! The timeout the query was solved with, 0 if unlimited.
+            triton::uint32 timeout;
+
+            //! True if the model is known.
+            bool hasModel;
+
+            //! The model <canonical number : value>.
+            std::vector<std::pair<triton::uint32, triton::uint512>> model;
+
+            //! The position of the entry in the LRU list.
+            std::list<std::pair<triton::uint64, triton::uint64>>::iterator lru;
+          };
+
+          //! The keys, from the most to the least recently used.
+          std::list<std::pair<triton::uint64, triton::uint64>> lru;
+
+          //! The cached results.
+          std::unordered_map<std::pair<triton::uint64, triton::uint64>, Entry, KeyHash> entries;
+
+          //! The maximum number of entries.
+          triton::usize capacity;
+
+          //! The counters.
+          triton::engines::solver::SolverCacheStats stats;
+
+          //! Inserts or updates an entry and marks it as the most recently used.
+          Entry& record(const std::pair<triton::uint64, triton::uint64>& key);
+
+          //! Returns false if the model of a sat entry can be evaluated on the query and does not satisfy it.
+          bool check(const SolverQuery& query, const Entry& entry) const;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SolverCache(triton::usize capacity=0x4000);
+
+          //! Returns the canonical form of a query.
+          TRITON_EXPORT SolverQuery canonicalize(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Looks up a query solved with at least `timeout` ms (0 if unlimited). Fills `status`, and `model` if not null. Returns false on a miss.
+          TRITON_EXPORT bool lookup(const SolverQuery& query, triton::uint32 timeout, triton::engines::solver::status_e* status, std::unordered_map<triton::usize, SolverModel>* model);
+
+          //! Records the result of a query solved with `timeout` ms (0 if unlimited). The `model` may be null if it has not been computed.
+          TRITON_EXPORT void insert(const SolverQuery& query, triton::uint32 timeout, triton::engines::solver::status_e status, const std::unordered_map<triton::usize, SolverModel>* model);
+
+          //! Removes all entries.
+          TRITON_EXPORT void clear(void);
+
+          //! Returns the number of entries.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Returns the counters of the cache.
+          TRITON_EXPORT const triton::engines::solver::SolverCacheStats& getStats(void) const;
+
+          //! Resets the counters of the cache.
+          TRITON_EXPORT void clearStats(void);
+
+          //! Adds the entries of a cache file. Nothing is added if the file is corrupted.
+          TRITON_EXPORT void load(const std::string& path);
+
+          //! Writes all entries to a cache file.
+          TRITON_EXPORT void save(const std::string& path) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERCACHE_H */
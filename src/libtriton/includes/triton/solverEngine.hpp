@@ -16,9 +16,15 @@
 #include <triton/ast.hpp>
 #include <triton/config.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/localSearchSolver.hpp>
+#include <triton/modelCache.hpp>
+#include <triton/modes.hpp>
+#include <triton/processPoolSolver.hpp>
+#include <triton/solverCache.hpp>
 #include <triton/solverEnums.hpp>
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverRecorder.hpp>
 #include <triton/tritonTypes.hpp>
 #ifdef TRITON_Z3_INTERFACE
   #include <triton/z3Solver.hpp>
@@ -26,6 +32,9 @@
 #ifdef TRITON_BITWUZLA_INTERFACE
   #include <triton/bitwuzlaSolver.hpp>
 #endif
+#if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+  #include <triton/portfolioSolver.hpp>
+#endif
 
 
 
@@ -60,9 +69,51 @@ namespace triton {
           //! Instance to the real solver class.
           std::unique_ptr<triton::engines::solver::SolverInterface> solver;
 
+          //! The Modes API
+          triton::modes::SharedModes modes;
+
+          //! The cache of query results used by the SOLVER_CACHE mode.
+          mutable triton::engines::solver::SolverCache cache;
+
+          //! The recent models used by the MODEL_REUSE mode.
+          mutable triton::engines::solver::ModelCache models;
+
+          //! The recorder of the queries sent to the solver.
+          mutable triton::engines::solver::SolverRecorder recorder;
+
+          //! The time spent in each phase by the queries sent to the solver.
+          mutable triton::engines::solver::SolverStats stats;
+
+          //! The solver timeout defined by setTimeout().
+          triton::uint32 timeout;
+
+          //! The solver memory limit defined by setMemoryLimit().
+          triton::uint32 memoryLimit;
+
+          //! Allocates a predefined solver.
+          triton::engines::solver::SolverInterface* newSolver(triton::engines::solver::solver_e kind) const;
+
+          //! Removes the clusters of independent constraints which are satisfied by the concrete values, whose variables are modeled in `concrete`. Returns the remaining constraints, null if there is none.
+          triton::ast::SharedAbstractNode sliceIndependentConstraints(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>& concrete) const;
+
+          //! Returns the branch constraint solved alone by the OPTIMISTIC_SOLVING mode, i.e. the last conjunct of a query, null if the query is not a conjunction.
+          triton::ast::SharedAbstractNode getOptimisticQuery(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Looks up a query in the model and query caches if enabled. Fills `status`, and `model` if not null. Returns false on a miss.
+          bool lookup(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>* model, triton::uint32 timeout, triton::engines::solver::status_e& status, triton::engines::solver::SolverQuery& query) const;
+
+          //! Records the result of a solved query in the model and query caches and in the recorder if enabled.
+          void record(const triton::ast::SharedAbstractNode& node, const triton::engines::solver::SolverQuery& query, const std::unordered_map<triton::usize, SolverModel>* model, triton::uint32 timeout, triton::engines::solver::status_e status, triton::uint32 solvingTime) const;
+
+          //! Solves the `pending` queries of `nodes` on `threads` workers (0 for one per hardware thread), each worker owning a solver instance.
+          void solveConcurrently(const std::vector<triton::ast::SharedAbstractNode>& nodes, const std::vector<triton::usize>& pending, triton::uint32 threads, triton::uint32 timeout, std::vector<std::unordered_map<triton::usize, SolverModel>>& models, std::vector<triton::engines::solver::status_e>& status, std::vector<triton::uint32>& solvingTime) const;
+
+          //! Solves a query through the model and query caches if enabled. The `model` is only computed if not null.
+          triton::engines::solver::status_e solve(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::usize, SolverModel>* model, triton::uint32 timeout, triton::uint32* solvingTime) const;
+
         public:
           //! Constructor.
-          TRITON_EXPORT SolverEngine();
+          TRITON_EXPORT SolverEngine(const triton::modes::SharedModes& modes);
 
           //! Returns the kind of solver as triton::engines::solver::solver_e.
           TRITON_EXPORT triton::engines::solver::solver_e getSolver(void) const;
@@ -97,17 +148,95 @@ namespace triton {
            */
           TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Computes and returns several models which differ on the `projection` variables, each model only holding these variables. An empty projection enumerates the models on all variables. The `limit` is the max number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
+          //! Computes a model for each query of a batch. Queries are solved concurrently on `threads` workers (0 for one per hardware thread). Models, states and solving times are returned in the order of the queries.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const std::vector<triton::ast::SharedAbstractNode>& nodes, triton::uint32 threads, std::vector<triton::engines::solver::status_e>* status = nullptr, triton::uint32 timeout = 0, std::vector<triton::uint32>* solvingTime = nullptr) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
           //! Returns the name of the solver.
           TRITON_EXPORT std::string getName(void) const;
 
+          //! Opens a new scope in the incremental session.
+          TRITON_EXPORT void pushScope(void);
+
+          //! Closes the last scope of the incremental session.
+          TRITON_EXPORT void popScope(void);
+
+          //! Asserts a constraint in the current scope of the incremental session.
+          TRITON_EXPORT void assertConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Checks the asserted constraints together with an assumption (if not null) which is not kept in the session. Returns a model if it is satisfiable.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> checkWithAssumption(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+          //! Drops the incremental session, its scopes and its translated constraints.
+          TRITON_EXPORT void resetSession(void);
+
+          //! Returns the number of constraints asserted in the incremental session.
+          TRITON_EXPORT triton::usize getSessionSize(void) const;
+
           //! Defines a solver timeout (in milliseconds).
           TRITON_EXPORT void setTimeout(triton::uint32 ms);
 
           //! Defines a solver memory consumption limit (in megabytes).
           TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Defines the number of z3 instances with other random seeds raced by the SOLVER_PORTFOLIO solver.
+          TRITON_EXPORT void setPortfolioSeeds(triton::uint32 seeds);
+
+          //! Defines the number of worker processes of the SOLVER_PROCESS_POOL solver, one per core if 0.
+          TRITON_EXPORT void setWorkers(triton::uint32 workers);
+
+          //! Returns the counters of the query cache.
+          TRITON_EXPORT const triton::engines::solver::SolverCacheStats& getCacheStats(void) const;
+
+          //! Removes all cached queries and resets the counters.
+          TRITON_EXPORT void clearCache(void);
+
+          //! Returns the counters of the model cache.
+          TRITON_EXPORT const triton::engines::solver::ModelCacheStats& getModelCacheStats(void) const;
+
+          //! Removes all recent models and resets the counters.
+          TRITON_EXPORT void clearModelCache(void);
+
+          //! Adds the queries of a cache file to the query cache.
+          TRITON_EXPORT void loadCache(const std::string& path);
+
+          //! Writes the query cache to a file.
+          TRITON_EXPORT void saveCache(const std::string& path) const;
+
+          //! Returns the time spent in each phase by the queries sent to the solver.
+          TRITON_EXPORT const triton::engines::solver::SolverStats& getStats(void) const;
+
+          //! Resets the time spent in each phase.
+          TRITON_EXPORT void clearStats(void);
+
+          //! Writes every query sent to the solver to a directory as SMT-LIB2. An empty path stops recording.
+          TRITON_EXPORT void setRecordDirectory(const std::string& path);
+
+          //! Returns the directory of the recorded queries, empty if queries are not recorded.
+          TRITON_EXPORT const std::string& getRecordDirectory(void) const;
       };
 
     /*! @} End of solver namespace */
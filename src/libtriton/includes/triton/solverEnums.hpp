@@ -45,6 +45,13 @@ namespace triton {
         #ifdef TRITON_BITWUZLA_INTERFACE
         SOLVER_BITWUZLA,    /*!< bitwuzla solver. */
         #endif
+        #if defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE)
+        SOLVER_PORTFOLIO,   /*!< portfolio of the available solvers. */
+        #endif
+        SOLVER_LOCAL_SEARCH, /*!< local search over the variables. */
+        #if !defined(_WIN32) && (defined(TRITON_Z3_INTERFACE) || defined(TRITON_BITWUZLA_INTERFACE))
+        SOLVER_PROCESS_POOL, /*!< z3 or bitwuzla run by worker processes. */
+        #endif
       };
 
       /*! The different kind of status */
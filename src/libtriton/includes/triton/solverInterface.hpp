@@ -13,6 +13,7 @@
 
 #include <triton/ast.hpp>
 #include <triton/dllexport.hpp>
+#include <triton/exceptions.hpp>
 #include <triton/solverEnums.hpp>
 #include <triton/solverModel.hpp>
 #include <triton/tritonTypes.hpp>
@@ -40,6 +41,48 @@ namespace triton {
      *  @{
      */
 
+      /*! \class SolverStats
+          \brief The time spent in each phase of the queries, in microseconds. */
+      class SolverStats {
+        public:
+          //! The number of queries.
+          triton::usize queries;
+
+          //! The number of AST nodes translated, the ones reused from previous queries excluded.
+          triton::usize nodes;
+
+          //! The translation of Triton's AST to the solver's terms.
+          triton::uint64 translation;
+
+          //! The satisfiability checks.
+          triton::uint64 check;
+
+          //! The extraction of the models, the parsing of their values excluded.
+          triton::uint64 model;
+
+          //! The parsing of the values of the models.
+          triton::uint64 numeral;
+
+          //! The number of queries decided by the known bits and intervals of their nodes, without the solver.
+          triton::usize decided;
+
+          //! Constructor.
+          SolverStats() : queries(0), nodes(0), translation(0), check(0), model(0), numeral(0), decided(0) {}
+
+          //! Adds the counters of other queries.
+          SolverStats& operator+=(const SolverStats& other) {
+            this->queries     += other.queries;
+            this->nodes       += other.nodes;
+            this->translation += other.translation;
+            this->check       += other.check;
+            this->model       += other.model;
+            this->numeral     += other.numeral;
+            this->decided     += other.decided;
+            return *this;
+          }
+      };
+
+
       /*! \interface SolverInterface
           \brief This interface is used to interface with solvers */
       class SolverInterface {
@@ -65,12 +108,67 @@ namespace triton {
            */
           TRITON_EXPORT virtual std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const = 0;
 
+          //! Computes and returns several models which differ on the `projection` variables, each model only holding these variables. An empty projection enumerates the models on all variables. The `limit` is the max number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           *
+           * The default implementation blocks each model with a Triton's AST and solves the query again.
+           */
+          TRITON_EXPORT virtual std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT virtual bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const = 0;
 
           //! Returns the name of the solver.
           TRITON_EXPORT virtual std::string getName(void) const = 0;
 
+          //! Returns the time spent in each phase by the last query of this instance. Solvers which do not measure their phases return empty counters.
+          TRITON_EXPORT virtual triton::engines::solver::SolverStats getStats(void) const {
+            return triton::engines::solver::SolverStats();
+          }
+
+          //! Opens a new scope in the incremental session. Constraints asserted after it are dropped by the matching `popScope`.
+          TRITON_EXPORT virtual void pushScope(void) {
+            throw triton::exceptions::SolverEngine("SolverInterface::pushScope(): Incremental solving is not supported by this solver.");
+          }
+
+          //! Closes the last scope of the incremental session.
+          TRITON_EXPORT virtual void popScope(void) {
+            throw triton::exceptions::SolverEngine("SolverInterface::popScope(): Incremental solving is not supported by this solver.");
+          }
+
+          //! Asserts a constraint in the current scope of the incremental session.
+          TRITON_EXPORT virtual void assertConstraint(const triton::ast::SharedAbstractNode& node) {
+            throw triton::exceptions::SolverEngine("SolverInterface::assertConstraint(): Incremental solving is not supported by this solver.");
+          }
+
+          //! Checks the asserted constraints together with an assumption (if not null) which is not kept in the session. Returns a model if it is satisfiable.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT virtual std::unordered_map<triton::usize, SolverModel> checkWithAssumption(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) {
+            throw triton::exceptions::SolverEngine("SolverInterface::checkWithAssumption(): Incremental solving is not supported by this solver.");
+          }
+
+          //! Drops the incremental session, its scopes and its translated constraints.
+          TRITON_EXPORT virtual void resetSession(void) {
+          }
+
+          //! Returns the number of constraints asserted in the incremental session.
+          TRITON_EXPORT virtual triton::usize getSessionSize(void) const {
+            return 0;
+          }
+
+          //! Interrupts the queries being solved from another thread, and the ones started until it is called with `false`. Solvers which cannot be interrupted ignore it.
+          TRITON_EXPORT virtual void interrupt(bool enable=true) {
+          }
+
           //! Defines a solver timeout (in milliseconds).
           TRITON_EXPORT virtual void setTimeout(triton::uint32 ms) = 0;
 
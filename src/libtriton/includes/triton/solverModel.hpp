@@ -47,6 +47,9 @@ namespace triton {
           //! The value of the model.
           triton::uint512 value;
 
+          //! True if the model only satisfies the last conjunct of the query.
+          bool optimistic;
+
         private:
           //! Copies a SolverModel
           void copy(const SolverModel& other);
@@ -78,6 +81,12 @@ namespace triton {
 
           //! Returns the symbolic variable.
           TRITON_EXPORT const triton::engines::symbolic::SharedSymbolicVariable& getVariable(void) const;
+
+          //! Returns true if the model only satisfies the last conjunct of the query (see the OPTIMISTIC_SOLVING mode).
+          TRITON_EXPORT bool isOptimistic(void) const;
+
+          //! Marks the model as optimistic.
+          TRITON_EXPORT void setOptimistic(bool flag);
       };
 
     //! Display a solver model.
@@ -0,0 +1,96 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_SOLVERRECORDER_H
+#define TRITON_SOLVERRECORDER_H
+
+#include <string>
+
+#include <triton/ast.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/solverEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! The format of a recorded query.
+      namespace recordFormat {
+        //! The prefix of the metadata comments.
+        constexpr char prefix[] = "; triton-";
+
+        //! The extension of a recorded query.
+        constexpr char extension[] = ".smt2";
+      };
+
+
+      /*! \class SolverRecorder
+       *  \brief Writes the queries sent to a solver to a directory.
+       *
+       *  \details
+       *  Each query is written to `<directory>/query-<n>.smt2` as a standalone SMT-LIB2 script: the
+       *  required functions, the declarations of its symbolic variables, the definitions of its references
+       *  and a single assertion. Leading `; triton-<key>: <value>` comments hold the backend, the timeout,
+       *  the status, the solving time and the name and size of each variable, so that a corpus can be
+       *  replayed offline by the `triton-solver-bench` example.
+       */
+      class SolverRecorder {
+        private:
+          //! The directory of the recorded queries, empty if disabled.
+          std::string directory;
+
+          //! The number of recorded queries.
+          triton::usize count;
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT SolverRecorder();
+
+          //! Defines the directory of the recorded queries and restarts the numbering. An empty path disables the recorder.
+          TRITON_EXPORT void setDirectory(const std::string& path);
+
+          //! Returns the directory of the recorded queries, empty if disabled.
+          TRITON_EXPORT const std::string& getDirectory(void) const;
+
+          //! Returns true if queries are recorded.
+          TRITON_EXPORT bool isEnabled(void) const;
+
+          //! Returns the number of recorded queries.
+          TRITON_EXPORT triton::usize size(void) const;
+
+          //! Writes a query solved by `backend` with `timeout` ms (0 if unlimited).
+          TRITON_EXPORT void write(const triton::ast::SharedAbstractNode& node, const std::string& backend, triton::uint32 timeout, triton::engines::solver::status_e status, triton::uint32 solvingTime);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERRECORDER_H */
@@ -11,6 +11,7 @@
 #include <map>
 #include <vector>
 
+#include <triton/symbolicEnums.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -24,6 +25,8 @@ namespace triton {
           extern std::map<std::string, triton::uint64> symbols;
           /*! Position independent code of some libc functions */
           extern std::vector<triton::uint8> code;
+          /*! Calling convention of the functions, to register their summaries */
+          extern triton::engines::symbolic::abi_e abi;
         };
       };
       namespace ms {
@@ -32,6 +35,8 @@ namespace triton {
           extern std::map<std::string, triton::uint64> symbols;
           /*! Position independent code of some libc functions */
           extern std::vector<triton::uint8> code;
+          /*! Calling convention of the functions, to register their summaries */
+          extern triton::engines::symbolic::abi_e abi;
         };
       };
     };
@@ -42,6 +47,8 @@ namespace triton {
           extern std::map<std::string, triton::uint64> symbols;
           /*! Position independent code of some libc functions */
           extern std::vector<triton::uint8> code;
+          /*! Calling convention of the functions, to register their summaries */
+          extern triton::engines::symbolic::abi_e abi;
         };
       };
     };
@@ -51,6 +58,8 @@ namespace triton {
         extern std::map<std::string, triton::uint64> symbols;
         /*! Position independent code of some libc functions */
         extern std::vector<triton::uint8> code;
+        /*! Calling convention of the functions, to register their summaries */
+        extern triton::engines::symbolic::abi_e abi;
       };
     };
   };
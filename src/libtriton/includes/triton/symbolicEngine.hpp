@@ -8,6 +8,7 @@
 #ifndef TRITON_SYMBOLICENGINE_H
 #define TRITON_SYMBOLICENGINE_H
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -55,6 +56,75 @@ namespace triton {
      *  @{
      */
 
+      /*! \class ConcretizationBudget
+          \brief The thresholds of the CONCRETIZE_ON_BUDGET mode. A zero threshold is disabled. */
+      class ConcretizationBudget {
+        public:
+          //! The maximum level (depth) of a new AST.
+          triton::uint32 level;
+
+          //! The maximum number of unique nodes of a new AST, references unrolled.
+          triton::usize nodes;
+
+          //! The maximum number of symbolic variables of a new AST.
+          triton::usize variables;
+
+          //! If true, a path constraint pinning the concretized value is recorded.
+          bool pin;
+
+          //! Constructor.
+          ConcretizationBudget() : level(0), nodes(0), variables(0), pin(false) {}
+      };
+
+
+      /*! \class ConcretizationStats
+          \brief How often each threshold of the CONCRETIZE_ON_BUDGET mode fired. */
+      class ConcretizationStats {
+        public:
+          //! The number of expressions concretized because of their level.
+          triton::usize level;
+
+          //! The number of expressions concretized because of their number of nodes.
+          triton::usize nodes;
+
+          //! The number of expressions concretized because of their number of variables.
+          triton::usize variables;
+
+          //! The number of path constraints recorded to pin a concretized value.
+          triton::usize pinned;
+
+          //! Constructor.
+          ConcretizationStats() : level(0), nodes(0), variables(0), pinned(0) {}
+      };
+
+
+      /*! \class LazyFlag
+          \brief A flag assignment of the LAZY_FLAGS mode, or of a block processed in the DEAD_FLAG_ELIMINATION mode, whose AST is built when the flag is read. */
+      class LazyFlag {
+        public:
+          //! Builds the AST of the flag.
+          std::function<triton::ast::SharedAbstractNode(void)> builder;
+
+          //! The comment of the expression.
+          std::string comment;
+
+          //! The disassembly of the instruction which set the flag.
+          std::shared_ptr<const std::string> disassembly;
+
+          //! The address of the instruction which set the flag.
+          triton::uint64 address;
+
+          //! The taint of the flag.
+          bool tainted;
+
+          //! The instruction the expression is linked to once built. nullptr in the LAZY_FLAGS mode.
+          triton::arch::Instruction* instruction;
+
+          //! Constructor.
+          LazyFlag() : address(0), tainted(false), instruction(nullptr) {}
+      };
+
+
       //! \class SymbolicEngine
       /*! \brief The symbolic engine class. */
       class SymbolicEngine
@@ -89,6 +159,27 @@ namespace triton {
           //! An array memory model.
           SharedSymbolicExpression memoryArray;
 
+          //! The thresholds of the CONCRETIZE_ON_BUDGET mode.
+          triton::engines::symbolic::ConcretizationBudget budget;
+
+          //! The counters of the CONCRETIZE_ON_BUDGET mode.
+          triton::engines::symbolic::ConcretizationStats budgetStats;
+
+          //! The flags assigned in the LAZY_FLAGS mode whose AST is not built yet <flag : LazyFlag>
+          std::unordered_map<triton::arch::register_e, triton::engines::symbolic::LazyFlag> lazyFlags;
+
+          //! The disassembly shared by the lazy flags of the last instruction.
+          std::shared_ptr<const std::string> lazyDisassembly;
+
+          //! The instruction described by `lazyDisassembly`.
+          const triton::arch::Instruction* lazyInstruction;
+
+          //! The address of the instruction described by `lazyDisassembly`.
+          triton::uint64 lazyAddress;
+
+          //! True while the flags of a block are deferred, see `deferFlags()`.
+          bool deferredFlags;
+
         private:
           //! AST API
           triton::ast::SharedAstContext astCtxt;
@@ -123,6 +214,12 @@ namespace triton {
           //! Removes an aligned entry.
           void removeAlignedMemory(triton::uint64 address, triton::uint32 size);
 
+          //! Returns the forwarded AST if all bytes of the memory area come from the same stored expression. Otherwise returns nullptr.
+          triton::ast::SharedAbstractNode getForwardedMemory(triton::uint64 address, triton::uint32 size) const;
+
+          //! Returns the concrete constant replacing `node` if it exceeds the concretization budget. Otherwise returns nullptr.
+          triton::ast::SharedAbstractNode applyConcretizationBudget(const triton::ast::SharedAbstractNode& node);
+
           //! Adds a symbolic expression to the bitvector memory model.
           inline void addBitvectorMemory(triton::uint64 mem, const SharedSymbolicExpression& expr);
 
@@ -144,6 +241,18 @@ namespace triton {
           //! Returns true if MEMORY_ARRAY is enabled.
           inline bool isArrayMode(void) const;
 
+          //! Returns true if STORE_LOAD_FORWARDING is enabled.
+          inline bool isForwardingMode(void) const;
+
+          //! Returns true if the result of an assignment does not need to be recorded (ONLY_ON_SYMBOLIZED and not symbolized).
+          inline bool isConcreteAssignment(const triton::ast::SharedAbstractNode& node) const;
+
+          //! Creates an expression of a concrete result which is only kept by the instruction.
+          SharedSymbolicExpression newConcreteExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, triton::engines::symbolic::expression_e type, const std::string& comment);
+
+          //! Builds the expression of a lazy flag if its register is pending.
+          void materializeLazyFlag(triton::arch::register_e id);
+
         public:
           //! Constructor.
           TRITON_EXPORT SymbolicEngine(triton::arch::Architecture* architecture,
@@ -248,6 +357,18 @@ namespace triton {
           //! Returns the new symbolic register expression expression and links this expression to the instruction.
           TRITON_EXPORT const SharedSymbolicExpression& createSymbolicRegisterExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const triton::arch::Register& reg, const std::string& comment="");
 
+          //! Assigns a flag. In the LAZY_FLAGS mode, `builder` is only called when the flag is read. Otherwise the expression is created and linked to the instruction.
+          TRITON_EXPORT void createSymbolicFlagExpression(triton::arch::Instruction& inst, const std::function<triton::ast::SharedAbstractNode(void)>& builder, const triton::arch::Register& flag, const std::string& comment, bool tainted);
+
+          //! Builds the pending expression of a flag assigned in the LAZY_FLAGS mode, of all the pending flags for EFLAGS.
+          TRITON_EXPORT void materializeLazyFlag(const triton::arch::Register& reg);
+
+          //! Builds the pending expressions of all flags assigned in the LAZY_FLAGS mode.
+          TRITON_EXPORT void materializeLazyFlags(void);
+
+          //! [internal] Defers the flags assigned until `deferFlags(false)` like in the LAZY_FLAGS mode. Flags overwritten without being read are never built, the others are built and linked to the instruction which assigned them when read or when the deferral ends.
+          TRITON_EXPORT void deferFlags(bool flag);
+
           //! Returns the new symbolic volatile expression expression and links this expression to the instruction.
           TRITON_EXPORT const SharedSymbolicExpression& createSymbolicVolatileExpression(triton::arch::Instruction& inst, const triton::ast::SharedAbstractNode& node, const std::string& comment="");
 
@@ -296,6 +417,12 @@ namespace triton {
           //! Concretizes a specific symbolic register.
           TRITON_EXPORT void concretizeRegister(const triton::arch::Register& reg);
 
+          //! Concretizes a register which is overwritten by a concrete value. A pending lazy flag is dropped instead of being built.
+          TRITON_EXPORT void concretizeOverwrittenRegister(const triton::arch::Register& reg);
+
+          //! Copies the symbolic expressions of a memory area to another one, as memmove does. Expressions are shared, not rebuilt.
+          TRITON_EXPORT void copySymbolicMemory(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
           //! Returns true if the symbolic expression ID exists.
           TRITON_EXPORT bool isSymbolicExpressionExists(triton::usize symExprId) const;
 
@@ -316,6 +443,18 @@ namespace triton {
 
           //! Sets the concrete value of a symbolic variable.
           TRITON_EXPORT void setConcreteVariableValue(const SharedSymbolicVariable& symVar, const triton::uint512& value);
+
+          //! Sets the thresholds of the CONCRETIZE_ON_BUDGET mode.
+          TRITON_EXPORT void setConcretizationBudget(const triton::engines::symbolic::ConcretizationBudget& budget);
+
+          //! Returns the thresholds of the CONCRETIZE_ON_BUDGET mode.
+          TRITON_EXPORT const triton::engines::symbolic::ConcretizationBudget& getConcretizationBudget(void) const;
+
+          //! Returns how often each threshold of the CONCRETIZE_ON_BUDGET mode fired.
+          TRITON_EXPORT const triton::engines::symbolic::ConcretizationStats& getConcretizationStats(void) const;
+
+          //! Resets the counters of the CONCRETIZE_ON_BUDGET mode.
+          TRITON_EXPORT void clearConcretizationStats(void);
       };
 
     /*! @} End of symbolic namespace */
@@ -50,6 +50,23 @@ namespace triton {
         UNDEFINED_VARIABLE,    //!< Undefined assignment.
       };
 
+      //! State of a branch in the execution tree.
+      enum branch_e {
+        UNEXPLORED_BRANCH,     //!< Branch not taken by any run yet.
+        PENDING_BRANCH,        //!< Branch handed out as a frontier and not resolved yet.
+        EXPLORED_BRANCH,       //!< Branch taken by a run.
+        INFEASIBLE_BRANCH,     //!< Branch proven unreachable from its prefix.
+        TIMEOUT_BRANCH,        //!< Branch the solver gave up on.
+      };
+
+      //! Calling convention of a summarized function.
+      enum abi_e {
+        DEFAULT_ABI,           //!< The convention of the architecture: SYSTEMV_ABI on x86 and x86-64, AAPCS64_ABI on AArch64.
+        SYSTEMV_ABI,           //!< System V on x86-64, cdecl on x86.
+        MS_ABI,                //!< Microsoft x64.
+        AAPCS64_ABI,           //!< AAPCS64 on AArch64.
+      };
+
     /*! @} End of symbolic namespace */
     };
   /*! @} End of engines namespace */
@@ -0,0 +1,113 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TRACEREADER_H
+#define TRITON_TRACEREADER_H
+
+#include <string>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/traceRecord.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Trace namespace
+    namespace trace {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*! \class TraceReader
+          \brief Streams records out of a memory-mapped binary trace file. */
+      class TraceReader {
+        private:
+          //! The mapped view of the file.
+          const triton::uint8* data;
+
+          //! The size of the mapped view.
+          triton::usize size;
+
+          //! The current read offset.
+          triton::usize cursor;
+
+          //! The end offset of the current range.
+          triton::usize limit;
+
+          //! The architecture of the trace.
+          triton::arch::architecture_e arch;
+
+          #if defined(_WIN32)
+          //! The file handle.
+          void* file;
+
+          //! The mapping handle.
+          void* mapping;
+          #else
+          //! The file descriptor.
+          int fd;
+          #endif
+
+          //! Reads an integer at the cursor and advances it.
+          template <typename T> T get(void);
+
+          //! Throws if less than `n` bytes remain in the current range.
+          void need(triton::usize n) const;
+
+          //! Unmaps and closes the file.
+          void unmap(void);
+
+        public:
+          //! Constructor. Maps the trace file and checks its header.
+          TRITON_EXPORT TraceReader(const std::string& path);
+
+          //! Destructor.
+          TRITON_EXPORT ~TraceReader();
+
+          //! Returns the architecture of the trace.
+          TRITON_EXPORT triton::arch::architecture_e getArchitecture(void) const;
+
+          //! Decodes the next record in `record`. Returns false at the end of the current range.
+          TRITON_EXPORT bool next(triton::engines::trace::TraceRecord& record);
+
+          //! Restarts reading from the first record of the trace.
+          TRITON_EXPORT void rewind(void);
+
+          //! Restricts reading to the records of a chunk.
+          TRITON_EXPORT void seek(const triton::engines::trace::TraceChunk& chunk);
+
+          //! Splits the trace into chunks of at most `recordsPerChunk` records. Records are skipped, not decoded.
+          TRITON_EXPORT std::vector<triton::engines::trace::TraceChunk> split(triton::usize recordsPerChunk) const;
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEREADER_H */
@@ -0,0 +1,131 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TRACERECORD_H
+#define TRITON_TRACERECORD_H
+
+#include <utility>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Trace namespace
+    namespace trace {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*!
+       *  \brief The binary trace format.
+       *
+       *  \details
+       *  A trace file starts with a header and is followed by a flat sequence of records. All
+       *  integers are little-endian.
+       *
+       *  ~~~~~~~~~~~~~
+       *  header  : magic[8] = "TRTRACE\0" | version:u32 | arch:u32
+       *  record  : size:u32 | address:u64 | tid:u32 | opSize:u8 | opcode[opSize]
+       *            | nbRegs:u16 | { regId:u32 | valSize:u8 | value[valSize] }*
+       *            | nbMems:u16 | { address:u64 | valSize:u8 | value[valSize] }*
+       *  ~~~~~~~~~~~~~
+       *
+       *  The `size` field is the number of bytes of the record which follow it. It allows
+       *  a reader to skip records without decoding them, which is what chunking relies on.
+       */
+      namespace format {
+        //! The magic of a trace file.
+        constexpr char magic[8] = {'T', 'R', 'T', 'R', 'A', 'C', 'E', '\0'};
+
+        //! The current version of the trace format.
+        constexpr triton::uint32 version = 1;
+
+        //! The size of the file header.
+        constexpr triton::usize headerSize = sizeof(magic) + sizeof(triton::uint32) + sizeof(triton::uint32);
+      };
+
+
+      /*! \class TraceRecord
+          \brief One executed instruction with the concrete values it read. */
+      class TraceRecord {
+        public:
+          //! The address of the instruction.
+          triton::uint64 address;
+
+          //! The thread id of the instruction.
+          triton::uint32 threadId;
+
+          //! The opcode of the instruction.
+          std::vector<triton::uint8> opcode;
+
+          //! The concrete values of the registers read by the instruction.
+          std::vector<std::pair<triton::arch::register_e, triton::uint512>> registers;
+
+          //! The concrete values of the memory read by the instruction (little-endian bytes).
+          std::vector<std::pair<triton::uint64, std::vector<triton::uint8>>> memory;
+
+          //! Constructor.
+          TraceRecord() : address(0), threadId(0) {}
+
+          //! Clears the record so that it can be reused.
+          void clear(void) {
+            this->address  = 0;
+            this->threadId = 0;
+            this->opcode.clear();
+            this->registers.clear();
+            this->memory.clear();
+          }
+      };
+
+
+      /*! \class TraceChunk
+          \brief A contiguous range of records of a trace, replayable on its own. */
+      class TraceChunk {
+        public:
+          //! The offset in the file of the first record.
+          triton::uint64 offset;
+
+          //! The number of bytes covered by the chunk.
+          triton::uint64 size;
+
+          //! The index of the first record.
+          triton::usize first;
+
+          //! The number of records in the chunk.
+          triton::usize count;
+
+          //! Constructor.
+          TraceChunk() : offset(0), size(0), first(0), count(0) {}
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACERECORD_H */
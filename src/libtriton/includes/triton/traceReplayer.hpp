@@ -0,0 +1,95 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TRACEREPLAYER_H
+#define TRITON_TRACEREPLAYER_H
+
+#include <triton/context.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/traceReader.hpp>
+#include <triton/traceRecord.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Trace namespace
+    namespace trace {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*! \class TraceReplayer
+          \brief Feeds a recorded trace back through a Triton context. */
+      class TraceReplayer {
+        private:
+          //! The context which receives the trace.
+          triton::Context& ctx;
+
+          //! The number of records replayed with their semantics.
+          triton::usize processed;
+
+          //! The number of records replayed concretely.
+          triton::usize skipped;
+
+          //! Synchronizes the concrete state of the context with the values read by a record.
+          void synchronize(const triton::engines::trace::TraceRecord& record);
+
+        public:
+          //! Constructor. The architecture of the context must match the one of the traces.
+          TRITON_EXPORT TraceReplayer(triton::Context& ctx);
+
+          //! Synchronizes the concrete state and processes one record. Returns the exception raised by the processing.
+          TRITON_EXPORT triton::arch::exception_e replay(const triton::engines::trace::TraceRecord& record);
+
+          //! Replays the remaining records of the reader. Stops on the first processing exception.
+          TRITON_EXPORT triton::arch::exception_e replay(triton::engines::trace::TraceReader& reader);
+
+          //! Replays the records of a chunk. Stops on the first processing exception.
+          TRITON_EXPORT triton::arch::exception_e replay(triton::engines::trace::TraceReader& reader, const triton::engines::trace::TraceChunk& chunk);
+
+          /*!
+           * \brief Replays the records of a chunk concretely.
+           *
+           * \details
+           * Only the recorded values are applied; instructions are neither disassembled nor
+           * lifted. As the trace does not hold the written values, the symbolic state of the
+           * registers and the memory is concretized at the end of the segment.
+           */
+          TRITON_EXPORT void replayConcrete(triton::engines::trace::TraceReader& reader, const triton::engines::trace::TraceChunk& chunk);
+
+          //! Returns the number of records replayed with their semantics.
+          TRITON_EXPORT triton::usize getNumberOfProcessedRecords(void) const;
+
+          //! Returns the number of records replayed concretely.
+          TRITON_EXPORT triton::usize getNumberOfConcreteRecords(void) const;
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEREPLAYER_H */
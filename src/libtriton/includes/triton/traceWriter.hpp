@@ -0,0 +1,96 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_TRACEWRITER_H
+#define TRITON_TRACEWRITER_H
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <triton/archEnums.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/traceRecord.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Trace namespace
+    namespace trace {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*! \class TraceWriter
+          \brief Records executed instructions into a binary trace file. */
+      class TraceWriter {
+        private:
+          //! The output stream.
+          std::ofstream stream;
+
+          //! The serialization buffer, reused between records.
+          std::vector<triton::uint8> buffer;
+
+          //! The number of records written.
+          triton::usize records;
+
+          //! Appends an integer to the serialization buffer.
+          template <typename T> void put(T value);
+
+        public:
+          //! Constructor. Creates (or truncates) the trace file and writes its header.
+          TRITON_EXPORT TraceWriter(const std::string& path, triton::arch::architecture_e arch);
+
+          //! Destructor.
+          TRITON_EXPORT ~TraceWriter();
+
+          //! Appends a record to the trace.
+          TRITON_EXPORT void write(const triton::engines::trace::TraceRecord& record);
+
+          /*!
+           * \brief Appends an already processed instruction to the trace.
+           *
+           * \details
+           * The values are taken from the read registers and load accesses of the instruction, so
+           * the instruction must have been processed with its semantics. Under the ONLY_ON_SYMBOLIZED
+           * mode, nodes of concrete operands are dropped and such an instruction cannot be recorded.
+           */
+          TRITON_EXPORT void write(triton::arch::Instruction& inst);
+
+          //! Flushes and closes the trace file.
+          TRITON_EXPORT void close(void);
+
+          //! Returns the number of records written.
+          TRITON_EXPORT triton::usize getNumberOfRecords(void) const;
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEWRITER_H */
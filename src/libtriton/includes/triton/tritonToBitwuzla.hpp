@@ -52,16 +52,46 @@ namespace triton {
         //! Returns symbolic variables and its assosiated Bitwuzla terms to process the solver model.
         TRITON_EXPORT const std::unordered_map<BitwuzlaTerm, triton::engines::symbolic::SharedSymbolicVariable>& getVariables(void) const;
 
+        //! Returns the symbolic variables of a converted expression and their Bitwuzla terms.
+        TRITON_EXPORT std::unordered_map<BitwuzlaTerm, triton::engines::symbolic::SharedSymbolicVariable> getVariables(const SharedAbstractNode& node) const;
+
         //! Returns bitvector sorts.
         TRITON_EXPORT const std::map<size_t, BitwuzlaSort>& getBitvectorSorts(void) const;
 
+        //! Returns the number of nodes translated by the last conversion, the nodes translated by previous conversions being reused.
+        TRITON_EXPORT triton::usize getTranslatedCount(void) const;
+
+        //! Returns the number of translated nodes kept by the translator.
+        TRITON_EXPORT triton::usize size(void) const;
+
       private:
-        //! The map of Triton's AST nodes translated to the Bitwuzla terms.
-        std::unordered_map<SharedAbstractNode, BitwuzlaTerm> translatedNodes;
+        //! A Triton's AST node translated to a Bitwuzla term.
+        struct Translation {
+          //! The translated node. It is not kept alive by the translation.
+          WeakAbstractNode node;
+
+          //! The Bitwuzla term of the node.
+          BitwuzlaTerm term;
+
+          //! The revision of the node when it was translated.
+          triton::usize revision;
+        };
+
+        //! The map of Triton's AST nodes translated to the Bitwuzla terms. It is kept across conversions and does not own the nodes.
+        std::unordered_map<const AbstractNode*, Translation> translatedNodes;
+
+        //! The number of translations from which dead nodes are swept.
+        triton::usize sweepThreshold;
+
+        //! The number of nodes translated by the last conversion.
+        triton::usize translatedCount;
 
         //! The set of symbolic variables contained in the expression.
         std::unordered_map<BitwuzlaTerm, triton::engines::symbolic::SharedSymbolicVariable> variables;
 
+        //! The Bitwuzla terms of the symbolic variables, by variable id.
+        std::unordered_map<triton::usize, BitwuzlaTerm> variableTerms;
+
         //! The map of symbols. E.g: (let (symbols expr1) expr2)
         std::unordered_map<std::string, triton::ast::SharedAbstractNode> symbols;
 
@@ -71,6 +101,15 @@ namespace triton {
         //! This flag define if the conversion is used to evaluated a node or not.
         bool isEval;
 
+        //! Returns true if a node is alive in the map of translated nodes and has not been changed since.
+        bool isTranslated(const SharedAbstractNode& node) const;
+
+        //! Returns the Bitwuzla term of a translated node.
+        BitwuzlaTerm getTranslation(const SharedAbstractNode& node) const;
+
+        //! Removes the translations of dead nodes once the map has grown enough.
+        void sweep(void);
+
         //! The convert internal process.
         BitwuzlaTerm translate(const SharedAbstractNode& node, Bitwuzla* bzla);
     };
@@ -9,6 +9,7 @@
 #define TRITON_TRITONTOZ3_H
 
 #include <unordered_map>
+#include <utility>
 #include <z3++.h>
 
 #include <triton/ast.hpp>
@@ -39,11 +40,44 @@ namespace triton {
         //! This flag define if the conversion is used to evaluated a node or not.
         bool isEval;
 
+        //! A Triton's AST node translated to Z3's AST.
+        struct Translation {
+          //! The translated node. It is not kept alive by the translation.
+          triton::ast::WeakAbstractNode node;
+
+          //! The Z3's AST of the node.
+          z3::expr expr;
+
+          //! The revision of the node when it was translated.
+          triton::usize revision;
+
+          //! Constructor.
+          Translation(const triton::ast::SharedAbstractNode& node, const z3::expr& expr) : node(node), expr(expr), revision(node->getRevision()) {}
+        };
+
+        //! The map of Triton's AST nodes already translated to Z3's AST. It is kept across conversions and does not own the nodes.
+        std::unordered_map<const triton::ast::AbstractNode*, Translation> translatedNodes;
+
+        //! The number of translations from which dead nodes are swept.
+        triton::usize sweepThreshold;
+
+        //! The number of nodes translated by the last conversion.
+        triton::usize translatedCount;
+
+        //! Returns true if a node is alive in the map of translated nodes and has not been changed since.
+        bool isTranslated(const triton::ast::SharedAbstractNode& node) const;
+
+        //! Returns the Z3's AST of a translated node.
+        const z3::expr& getTranslation(const triton::ast::SharedAbstractNode& node) const;
+
+        //! Removes the translations of dead nodes once the map has grown enough.
+        void sweep(void);
+
         //! Returns the integer of the z3 expression as a string.
         std::string getStringValue(const z3::expr& expr);
 
         //! The convert internal process
-        z3::expr do_convert(const triton::ast::SharedAbstractNode& node, std::unordered_map<triton::ast::SharedAbstractNode, z3::expr>* output);
+        z3::expr do_convert(const triton::ast::SharedAbstractNode& node);
 
       protected:
         //! The z3's context.
@@ -64,6 +98,15 @@ namespace triton {
 
         //! Converts to Z3's AST
         TRITON_EXPORT z3::expr convert(const triton::ast::SharedAbstractNode& node);
+
+        //! Returns the z3's context of the converted expressions.
+        TRITON_EXPORT z3::context& getContext(void);
+
+        //! Returns the number of nodes translated by the last conversion, the nodes translated by previous conversions being reused.
+        TRITON_EXPORT triton::usize getTranslatedCount(void) const;
+
+        //! Returns the number of translated nodes kept by the translator.
+        TRITON_EXPORT triton::usize size(void) const;
     };
 
   /*! @} End of ast namespace */
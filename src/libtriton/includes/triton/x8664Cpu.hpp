@@ -48,10 +48,15 @@ namespace triton {
      *  @{
      */
 
+      class x8664Interpreter;
+
       //! \class x8664Cpu
       /*! \brief This class is used to describe the x86 (64-bits) spec. */
       class x8664Cpu : public CpuInterface, public x86Specifications {
 
+        //! The native interpreter works directly on the CPU state.
+        friend class x8664Interpreter;
+
         static const triton::arch::register_e pcId = triton::arch::ID_REG_X86_RIP;
         static const triton::arch::register_e spId = triton::arch::ID_REG_X86_RSP;
 
@@ -0,0 +1,199 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the Apache License 2.0.
+*/
+
+#ifndef TRITON_X8664INTERPRETER_H
+#define TRITON_X8664INTERPRETER_H
+
+#include <triton/architecture.hpp>
+#include <triton/dllexport.hpp>
+#include <triton/instruction.hpp>
+#include <triton/memoryAccess.hpp>
+#include <triton/modes.hpp>
+#include <triton/operandWrapper.hpp>
+#include <triton/register.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+#include <triton/x8664Cpu.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The x86 namespace
+    namespace x86 {
+    /*!
+     *  \ingroup arch
+     *  \addtogroup x86
+     *  @{
+     */
+
+      /*! \class x8664Interpreter
+       *  \brief The native interpreter of concrete x86-64 instructions.
+       *
+       *  \details
+       *  Building the semantics of an instruction allocates its ASTs and evaluates them on 512-bit
+       *  integers, even when nothing it reads is symbolic or tainted. The interpreter executes a subset
+       *  of common instructions (mov, movzx, movsx, movsxd, lea, add, sub, cmp, inc, dec, and, or, xor,
+       *  test, shl, sal, shr, sar, push, pop, call, ret, jmp, jcc and nop) directly on the x8664Cpu
+       *  state with native integers. Written registers and memory cells are concretized and untainted,
+       *  and flags follow the x86Semantics formulas. Like with ONLY_ON_SYMBOLIZED, an executed
+       *  instruction carries no symbolic expression and no semantics.
+       *
+       *  The instruction is declined, and its semantics built as usual, if one of its operands is not
+       *  supported (prefix, segment, high byte or non general purpose register, memory array) or if a
+       *  value it reads is symbolized or tainted. It is used by the NATIVE_INTERPRETER and the
+       *  ONLY_ON_SYMBOLIZED modes.
+       */
+      class x8664Interpreter {
+        private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! The Modes API
+          triton::modes::SharedModes modes;
+
+          //! The CPU of the instruction being executed.
+          triton::arch::x86::x8664Cpu* cpu;
+
+          //! Returns the mask of a bit-vector size.
+          static triton::uint64 mask(triton::uint32 bits);
+
+          //! Sign-extends a value of a bit-vector size to 64 bits.
+          static triton::uint64 signExtend(triton::uint64 value, triton::uint32 bits);
+
+          //! Returns the bit of a flag in eflags.
+          static triton::uint32 getFlagBit(triton::arch::register_e id);
+
+          //! Returns the storage of a register, nullptr if the register is not supported.
+          triton::uint8* getStorage(const triton::arch::Register& reg) const;
+
+          //! Returns true if the register is supported and its value is neither symbolized nor tainted.
+          bool isConcreteRegister(const triton::arch::Register& reg) const;
+
+          //! Returns true if the target address of a memory operand is concrete. Initializes the address.
+          bool isConcreteAddress(triton::arch::MemoryAccess& mem);
+
+          //! Returns true if the operand is supported and its value is neither symbolized nor tainted.
+          bool isConcreteRead(triton::arch::OperandWrapper& op);
+
+          //! Returns true if the operand is supported and can be overwritten by a concrete value.
+          bool isConcreteWrite(triton::arch::OperandWrapper& op);
+
+          //! Returns true if the flag is neither symbolized nor tainted.
+          bool isConcreteFlag(triton::arch::register_e id);
+
+          //! Returns true if the path constraint of a concrete branch is not recorded.
+          bool isPathConstraintSkipped(void) const;
+
+          //! Returns the concrete value of an operand.
+          triton::uint64 read(const triton::arch::OperandWrapper& op) const;
+
+          //! Returns the concrete value of a register.
+          triton::uint64 readRegister(const triton::arch::Register& reg) const;
+
+          //! Returns the concrete value of a memory access.
+          triton::uint64 readMemory(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the concrete value of a flag.
+          bool readFlag(triton::arch::register_e id) const;
+
+          //! Writes a concrete value into an operand.
+          void write(const triton::arch::OperandWrapper& op, triton::uint64 value);
+
+          //! Writes a concrete value into a register.
+          void writeRegister(const triton::arch::Register& reg, triton::uint64 value);
+
+          //! Writes a concrete value into a memory access.
+          void writeMemory(const triton::arch::MemoryAccess& mem, triton::uint64 value);
+
+          //! Writes a concrete value into a flag.
+          void writeFlag(triton::arch::register_e id, bool value);
+
+          //! Tags a flag as undefined.
+          void undefinedFlag(triton::arch::register_e id);
+
+          //! Writes the parity, sign and zero flags of a result.
+          void writeResultFlags(triton::uint64 result, triton::uint32 bits);
+
+          //! Updates the program counter to the next instruction.
+          void controlFlow(const triton::arch::Instruction& inst);
+
+          //! Executes ADD, SUB, CMP, INC and DEC.
+          bool arith_n(triton::arch::Instruction& inst);
+
+          //! Executes AND, OR, XOR and TEST.
+          bool logic_n(triton::arch::Instruction& inst);
+
+          //! Executes SHL, SAL, SHR and SAR.
+          bool shift_n(triton::arch::Instruction& inst);
+
+          //! Executes MOV, MOVABS, MOVZX, MOVSX and MOVSXD.
+          bool mov_n(triton::arch::Instruction& inst);
+
+          //! Executes LEA.
+          bool lea_n(triton::arch::Instruction& inst);
+
+          //! Executes PUSH.
+          bool push_n(triton::arch::Instruction& inst);
+
+          //! Executes POP.
+          bool pop_n(triton::arch::Instruction& inst);
+
+          //! Executes CALL.
+          bool call_n(triton::arch::Instruction& inst);
+
+          //! Executes RET.
+          bool ret_n(triton::arch::Instruction& inst);
+
+          //! Executes JMP.
+          bool jmp_n(triton::arch::Instruction& inst);
+
+          //! Executes the conditional jumps.
+          bool jcc_n(triton::arch::Instruction& inst);
+
+          //! Executes NOP.
+          bool nop_n(triton::arch::Instruction& inst);
+
+        public:
+          //! Constructor.
+          TRITON_EXPORT x8664Interpreter(triton::arch::Architecture* architecture,
+                                         triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                         triton::engines::taint::TaintEngine* taintEngine,
+                                         const triton::modes::SharedModes& modes);
+
+          //! Executes the instruction natively. Returns false if the instruction must be processed by its semantics.
+          TRITON_EXPORT bool execute(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of x86 namespace */
+    };
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_X8664INTERPRETER_H */
@@ -8,8 +8,11 @@
 #ifndef TRITON_Z3SOLVER_H
 #define TRITON_Z3SOLVER_H
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <z3++.h>
 #include <z3_api.h>
@@ -19,6 +22,7 @@
 #include <triton/solverEnums.hpp>
 #include <triton/solverInterface.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/tritonToZ3.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -57,9 +61,54 @@ namespace triton {
           //! The SMT solver memory limit. By default, unlimited.
           triton::uint32 memoryLimit;
 
+          //! The random seed of the solver. By default, 0.
+          triton::uint32 seed;
+
+          //! True if the queries are interrupted by interrupt().
+          bool interrupted;
+
+          //! The contexts of the queries being solved, cancelled by interrupt().
+          mutable std::unordered_set<z3::context*> running;
+
+          //! Protects `interrupted` and `running`, interrupt() being called from another thread.
+          mutable std::mutex runningLock;
+
+          //! The time spent in each phase by the last query.
+          mutable triton::engines::solver::SolverStats stats;
+
+          //! Protects `stats`, queries being solved from several threads.
+          mutable std::mutex statsLock;
+
+          //! Collects the counters of a query and publishes them to `stats`.
+          class QueryStats;
+
+          //! Registers the context of a query while it is solved.
+          class RunningContext;
+
+          //! The translator shared by successive queries. Its z3's context keeps the translated sub-DAGs of the AST context alive across queries.
+          mutable std::unique_ptr<triton::ast::TritonToZ3> translator;
+
+          //! Protects `translator`, a query holding it until its z3's objects are released.
+          mutable std::mutex translatorLock;
+
+          //! Returns the shared translator if `lock` can take it, otherwise a fresh translator owned by `local`.
+          triton::ast::TritonToZ3& getTranslator(std::unique_lock<std::mutex>& lock, std::unique_ptr<triton::ast::TritonToZ3>& local) const;
+
           //! Writes back the status code of the solver into the pointer pointed by status.
           void writeBackStatus(z3::solver& solver, z3::check_result res, triton::engines::solver::status_e* status) const;
 
+          //! The translator of the incremental session. It owns the z3's context of the session and its translated sub-DAGs.
+          std::unique_ptr<triton::ast::TritonToZ3> sessionAst;
+
+          //! The solver of the incremental session.
+          std::unique_ptr<z3::solver> session;
+
+          //! The number of open scopes in the incremental session.
+          triton::usize sessionScopes;
+
+          //! Initializes the incremental session if it does not exist yet.
+          void initSession(void);
+
         public:
           //! Constructor.
           TRITON_EXPORT Z3Solver();
@@ -82,6 +131,15 @@ namespace triton {
            */
           TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
+          //! Computes and returns several models which differ on the `projection` variables, each model only holding these variables. An empty projection enumerates the models on all variables. The `limit` is the max number of models returned. State is returned in the `status` pointer as well as the solving time. A `timeout` can also be defined.
+          /*! \brief vector of map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::vector<std::unordered_map<triton::usize, SolverModel>> getModels(const triton::ast::SharedAbstractNode& node, const std::vector<triton::engines::symbolic::SharedSymbolicVariable>& projection, triton::uint32 limit, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
+
           //! Returns true if an expression is satisfiable.
           TRITON_EXPORT bool isSat(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr) const;
 
@@ -94,11 +152,44 @@ namespace triton {
           //! Returns the name of this solver.
           TRITON_EXPORT std::string getName(void) const;
 
+          //! Returns the time spent in each phase by the last query.
+          TRITON_EXPORT triton::engines::solver::SolverStats getStats(void) const;
+
+          //! Opens a new scope in the incremental session.
+          TRITON_EXPORT void pushScope(void);
+
+          //! Closes the last scope of the incremental session.
+          TRITON_EXPORT void popScope(void);
+
+          //! Asserts a constraint in the current scope of the incremental session.
+          TRITON_EXPORT void assertConstraint(const triton::ast::SharedAbstractNode& node);
+
+          //! Checks the asserted constraints together with an assumption (if not null) which is not kept in the session. Returns a model if it is satisfiable.
+          /*! \brief map of symbolic variable id -> model
+           *
+           * \details
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          TRITON_EXPORT std::unordered_map<triton::usize, SolverModel> checkWithAssumption(const triton::ast::SharedAbstractNode& node, triton::engines::solver::status_e* status = nullptr, triton::uint32 timeout = 0, triton::uint32* solvingTime = nullptr);
+
+          //! Drops the incremental session, its scopes and its translated constraints.
+          TRITON_EXPORT void resetSession(void);
+
+          //! Returns the number of constraints asserted in the incremental session.
+          TRITON_EXPORT triton::usize getSessionSize(void) const;
+
           //! Defines a solver timeout (in milliseconds).
           TRITON_EXPORT void setTimeout(triton::uint32 ms);
 
           //! Defines a solver memory consumption limit (in megabytes).
           TRITON_EXPORT void setMemoryLimit(triton::uint32 mem);
+
+          //! Defines the random seed of the solver.
+          TRITON_EXPORT void setSeed(triton::uint32 seed);
+
+          //! Interrupts the queries being solved, and the ones started until it is called with `false`. Thread-safe.
+          TRITON_EXPORT void interrupt(bool enable=true);
       };
 
     /*! @} End of solver namespace */
@@ -97,6 +97,9 @@ namespace triton {
             {"__udivdi3", 0x27c0},
           };
 
+          /* Calling convention of `code`, used to register the summaries of `symbols` */
+          triton::engines::symbolic::abi_e abi = triton::engines::symbolic::SYSTEMV_ABI;
+
           /*
            * This vector contains the binary code of some libc functions.
            * The code is position-independent and its calling convention is
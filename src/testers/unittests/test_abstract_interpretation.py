@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the ABSTRACT_INTERPRETATION mode."""
+
+import unittest
+
+from triton import ARCH, AST_NODE, MODE, SOLVER_STATE, TritonContext
+
+
+class TestAbstractInterpretation(unittest.TestCase):
+
+    """Testing the ABSTRACT_INTERPRETATION mode."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.ABSTRACT_INTERPRETATION, True)
+        self.ast = self.ctx.getAstContext()
+        self.x = self.ctx.newSymbolicVariable(8)
+        self.zx = self.ast.zx(24, self.ast.variable(self.x))
+        self.ctx.setConcreteVariableValue(self.x, 0x12)
+
+
+    def test_abstract_value(self):
+        value = self.zx.getAbstractValue()
+        self.assertEqual(value["zeros"], 0xffffff00)
+        self.assertEqual(value["ones"], 0)
+        self.assertEqual(value["umin"], 0)
+        self.assertEqual(value["umax"], 0xff)
+
+        value = self.ast.bvadd(self.zx, self.zx).getAbstractValue()
+        self.assertEqual(value["umax"], 0x1fe)
+        self.assertEqual(value["smin"], 0)
+
+        value = self.ast.bv(0x80, 8).getAbstractValue()
+        self.assertEqual(value["ones"], 0x80)
+        self.assertEqual(value["smin"], -128)
+        self.assertEqual(value["smax"], -128)
+
+        self.assertIsNone(self.ast.zx(64, self.zx).getAbstractValue())
+
+
+    def test_changed_node(self):
+        node = self.ast.bvadd(self.zx, self.zx)
+        self.assertEqual(node.getAbstractValue()["umax"], 0x1fe)
+
+        # A node changed in place is analyzed again
+        node.setChild(0, self.ast.bv(0x1000, 32))
+        value = node.getAbstractValue()
+        self.assertEqual(value["umin"], 0x1000)
+        self.assertEqual(value["umax"], 0x10ff)
+
+
+    def test_decided_sat(self):
+        model, status, _ = self.ctx.getModel(self.ast.bvult(self.zx, self.ast.bv(256, 32)), status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(model[self.x.getId()].getValue(), 0x12)
+        self.assertEqual(self.ctx.getSolverStats()["decided"], 1)
+
+
+    def test_decided_unsat(self):
+        model, status, _ = self.ctx.getModel(self.ast.bvugt(self.zx, self.ast.bv(255, 32)), status=True)
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        self.assertEqual(len(model), 0)
+        self.assertFalse(self.ctx.isSat(self.zx == 0x100))
+        self.assertEqual(self.ctx.getSolverStats()["decided"], 2)
+
+
+    def test_undecided(self):
+        model = self.ctx.getModel(self.zx == 0x41)
+        self.assertEqual(model[self.x.getId()].getValue(), 0x41)
+        self.assertEqual(self.ctx.getSolverStats()["decided"], 0)
+
+
+    def test_mask(self):
+        node = self.ast.bvand(self.zx, self.ast.bv(0xff, 32))
+        self.assertEqual(node.getType(), AST_NODE.ZX)
+        node = self.ast.bvand(self.ast.bv(0x7f, 32), self.zx)
+        self.assertEqual(node.getType(), AST_NODE.BVAND)
+
+
+    def test_disabled(self):
+        self.ctx.setMode(MODE.ABSTRACT_INTERPRETATION, False)
+        self.assertEqual(self.ast.bvand(self.zx, self.ast.bv(0xff, 32)).getType(), AST_NODE.BVAND)
+        self.assertTrue(self.ctx.isSat(self.ast.bvult(self.zx, self.ast.bv(256, 32))))
+        self.assertEqual(self.ctx.getSolverStats()["decided"], 0)
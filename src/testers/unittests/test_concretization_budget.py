@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the CONCRETIZE_ON_BUDGET mode."""
+
+import unittest
+
+from triton import ARCH, MODE, Instruction, TritonContext
+
+
+class TestConcretizationBudget(unittest.TestCase):
+
+    """Testing the CONCRETIZE_ON_BUDGET mode."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.CONCRETIZE_ON_BUDGET, True)
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        self.ctx.setConcreteVariableValue(self.ctx.getSymbolicVariable(0), 3)
+
+
+    def loop(self, count):
+        for _ in range(count):
+            self.ctx.processing(Instruction(b"\x48\x01\xc0")) # add rax, rax
+
+
+    def test_disabled(self):
+        self.ctx.setMode(MODE.CONCRETIZE_ON_BUDGET, False)
+        self.ctx.setConcretizationBudget(level=4)
+        self.loop(10)
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.assertEqual(self.ctx.getConcretizationStats()["level"], 0)
+
+
+    def test_level(self):
+        self.ctx.setConcretizationBudget(level=10)
+        self.loop(3)
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.loop(10)
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 3 << 13)
+        self.assertGreater(self.ctx.getConcretizationStats()["level"], 0)
+        self.assertEqual(self.ctx.getPathPredicateSize(), 0)
+
+
+    def test_nodes(self):
+        self.ctx.setConcretizationBudget(nodes=16)
+        self.loop(10)
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.assertGreater(self.ctx.getConcretizationStats()["nodes"], 0)
+
+
+    def test_variables(self):
+        self.ctx.setConcretizationBudget(variables=1)
+        self.ctx.symbolizeRegister(self.ctx.registers.rbx)
+        self.ctx.processing(Instruction(b"\x48\x01\xc0")) # add rax, rax
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.ctx.processing(Instruction(b"\x48\x01\xd8")) # add rax, rbx
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.assertGreater(self.ctx.getConcretizationStats()["variables"], 0)
+
+
+    def test_pin(self):
+        self.ctx.setConcretizationBudget(level=10, pin=True)
+        self.loop(13)
+        stats = self.ctx.getConcretizationStats()
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.assertEqual(stats["pinned"], stats["level"])
+        self.assertEqual(self.ctx.getPathPredicateSize(), stats["pinned"])
+
+        self.ctx.clearConcretizationStats()
+        self.assertEqual(self.ctx.getConcretizationStats()["pinned"], 0)
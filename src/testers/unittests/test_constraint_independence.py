@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the CONSTRAINT_INDEPENDENCE mode."""
+
+import unittest
+
+from triton import ARCH, MODE, SOLVER_STATE, Instruction, TritonContext
+
+
+class TestConstraintIndependence(unittest.TestCase):
+
+    """Testing the CONSTRAINT_INDEPENDENCE mode."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.CONSTRAINT_INDEPENDENCE, True)
+        self.ast = self.ctx.getAstContext()
+
+        self.x = self.ctx.newSymbolicVariable(8)
+        self.y = self.ctx.newSymbolicVariable(8)
+        self.z = self.ctx.newSymbolicVariable(8)
+        self.vx = self.ast.variable(self.x)
+        self.vy = self.ast.variable(self.y)
+        self.vz = self.ast.variable(self.z)
+
+        self.ctx.setConcreteVariableValue(self.x, 1)
+        self.ctx.setConcreteVariableValue(self.y, 2)
+        self.ctx.setConcreteVariableValue(self.z, 3)
+
+
+    def test_independent(self):
+        # Only y == 5 is sent to the solver, x and z keep their concrete values
+        query = self.ast.land([self.vx + self.vz == 4, self.vz != 0, self.vy == 5])
+        model, status, _ = self.ctx.getModel(query, status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(model[self.x.getId()].getValue(), 1)
+        self.assertEqual(model[self.y.getId()].getValue(), 5)
+        self.assertEqual(model[self.z.getId()].getValue(), 3)
+
+
+    def test_dependent(self):
+        # x == 2 is not satisfied, its whole cluster goes to the solver
+        query = self.ast.land([self.vx + self.vy == 3, self.vx == 2, self.vz == 3])
+        model = self.ctx.getModel(query)
+        self.assertEqual(model[self.x.getId()].getValue(), 2)
+        self.assertEqual(model[self.y.getId()].getValue(), 1)
+        self.assertEqual(model[self.z.getId()].getValue(), 3)
+
+
+    def test_concrete(self):
+        query = self.ast.land([self.vx == 1, self.vy + self.vz == 5])
+        model, status, time = self.ctx.getModel(query, status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(time, 0)
+        self.assertEqual(len(model), 3)
+        self.assertTrue(self.ctx.isSat(query))
+
+
+    def test_unsat(self):
+        query = self.ast.land([self.vx == 1, self.vy * 2 == 3])
+        model, status, _ = self.ctx.getModel(query, status=True)
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        self.assertEqual(len(model), 0)
+        self.assertFalse(self.ctx.isSat(query))
+
+
+    def test_path_predicate(self):
+        # 0x1000: cmp al, 1
+        # 0x1002: je 0x1010
+        # 0x1004: cmp bl, 2
+        # 0x1007: jne 0x1010
+        al = self.ctx.symbolizeRegister(self.ctx.registers.al)
+        bl = self.ctx.symbolizeRegister(self.ctx.registers.bl)
+        self.ctx.setConcreteVariableValue(al, 1)
+        self.ctx.setConcreteVariableValue(bl, 2)
+
+        pc = 0x1000
+        for opcode in [b"\x3c\x01", b"\x74\x0c", b"\x80\xfb\x02", b"\x75\x07"]:
+            self.ctx.processing(Instruction(pc, opcode))
+            pc += len(opcode)
+
+        # Negates the last branch, the constraint on al is not sent to the solver
+        pcs = self.ctx.getPathConstraints()
+        self.assertEqual(len(pcs), 2)
+        query = self.ast.land([pcs[0].getTakenPredicate(), self.ast.lnot(pcs[1].getTakenPredicate())])
+        model, status, _ = self.ctx.getModel(query, status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(model[al.getId()].getValue(), 1)
+        self.assertNotEqual(model[bl.getId()].getValue(), 2)
+
+
+    def test_disabled(self):
+        self.ctx.setMode(MODE.CONSTRAINT_INDEPENDENCE, False)
+        query = self.ast.land([self.vx == 1, self.vy == 5])
+        model = self.ctx.getModel(query)
+        self.assertEqual(model[self.y.getId()].getValue(), 5)
+        self.assertEqual(model[self.x.getId()].getValue(), 1)
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the DECODE_CACHE mode."""
+
+import unittest
+
+from triton import ARCH, MODE, Instruction, TritonContext
+
+
+# 0x1000: mov rcx, 10
+# 0x1007: add rax, rcx
+# 0x100a: dec rcx
+# 0x100d: jne 0x1007
+CODE = b"\x48\xc7\xc1\x0a\x00\x00\x00\x48\x01\xc8\x48\xff\xc9\x75\xf8"
+BASE = 0x1000
+
+
+class TestDecodeCache(unittest.TestCase):
+
+    """Testing the DECODE_CACHE mode."""
+
+    def emulate(self, cached):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.DECODE_CACHE, cached)
+        ctx.setConcreteMemoryAreaValue(BASE, CODE)
+        ctx.symbolizeRegister(ctx.registers.rax)
+
+        pc = BASE
+        while pc != BASE + len(CODE):
+            inst = Instruction(pc, ctx.getConcreteMemoryAreaValue(pc, 16))
+            ctx.processing(inst)
+            pc = ctx.getConcreteRegisterValue(ctx.registers.rip)
+        return ctx
+
+
+    def test_loop(self):
+        ref = self.emulate(False)
+        ctx = self.emulate(True)
+
+        stats = ctx.getDecodeCacheStats()
+        self.assertEqual(stats["misses"], 4)
+        self.assertEqual(stats["hits"], 27)
+        self.assertEqual(stats["flushes"], 0)
+        self.assertEqual(ref.getDecodeCacheStats()["hits"], 0)
+
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rax), 55)
+        self.assertEqual(len(ctx.getSymbolicExpressions()), len(ref.getSymbolicExpressions()))
+        self.assertEqual(len(ctx.getPathConstraints()), len(ref.getPathConstraints()))
+        self.assertEqual(str(ctx.getSymbolicRegister(ctx.registers.rax).getAst().evaluate()),
+                         str(ref.getSymbolicRegister(ref.registers.rax).getAst().evaluate()))
+
+        ctx.clearDecodeCache()
+        self.assertEqual(ctx.getDecodeCacheStats()["hits"], 0)
+
+
+    def test_semantics(self):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.DECODE_CACHE, True)
+
+        for _ in range(2):
+            inst = Instruction(0x1000, b"\x48\x8b\x04\x24") # mov rax, [rsp]
+            inst.setThreadId(7)
+            ctx.processing(inst)
+            self.assertEqual(inst.getDisassembly(), "mov rax, qword ptr [rsp]")
+            self.assertEqual(inst.getThreadId(), 7)
+            self.assertEqual(len(inst.getLoadAccess()), 1)
+            self.assertEqual(len(inst.getSymbolicExpressions()), 2)
+
+        self.assertEqual(ctx.getDecodeCacheStats()["hits"], 1)
+
+
+    def test_self_modifying_code(self):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.DECODE_CACHE, True)
+
+        inst = Instruction(0x1000, b"\x48\x01\xc8") # add rax, rcx
+        ctx.processing(inst)
+        inst = Instruction(0x1000, b"\x48\x29\xc8") # sub rax, rcx
+        ctx.processing(inst)
+        self.assertEqual(inst.getDisassembly(), "sub rax, rcx")
+        self.assertEqual(ctx.getDecodeCacheStats()["hits"], 0)
+
+
+    def test_thumb(self):
+        ctx = TritonContext(ARCH.ARM32)
+        ctx.setMode(MODE.DECODE_CACHE, True)
+        opcode = b"\x00\x20\xa0\xe3" # mov r2, #0 (Arm) / movs r0, #0 (Thumb)
+
+        arm = Instruction(0x1000, opcode)
+        ctx.processing(arm)
+
+        ctx.setThumb(True)
+        thumb = Instruction(0x1000, opcode)
+        ctx.processing(thumb)
+
+        self.assertNotEqual(arm.getDisassembly(), thumb.getDisassembly())
+        self.assertTrue(thumb.isThumb())
+        self.assertEqual(ctx.getDecodeCacheStats()["hits"], 0)
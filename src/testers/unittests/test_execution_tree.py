@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the execution tree."""
+
+import unittest
+
+from triton import ARCH, Instruction, SOLVER_STATE, TritonContext
+
+
+class TestExecutionTree(unittest.TestCase):
+
+    """Testing the execution tree."""
+
+    # 0x1000: cmp al, 0x41
+    # 0x1002: jne 0x100a
+    # 0x1004: cmp bl, 0x42
+    # 0x1007: jne 0x100a
+    # 0x1009: nop
+    CODE = b"\x3c\x41\x75\x06\x80\xfb\x42\x75\x01\x90"
+    BASE = 0x1000
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setConcreteMemoryAreaValue(self.BASE, self.CODE)
+        # Runs share their symbolic variables
+        self.al = self.ctx.newSymbolicVariable(8)
+        self.bl = self.ctx.newSymbolicVariable(8)
+
+
+    def run_once(self, al, bl, frontier=0):
+        self.ctx.clearPathConstraints()
+        for var, reg, value in ((self.al, self.ctx.registers.rax, al), (self.bl, self.ctx.registers.rbx, bl)):
+            self.ctx.assignSymbolicExpressionToRegister(self.ctx.newSymbolicExpression(self.ast.zx(56, self.ast.variable(var))), reg)
+            self.ctx.setConcreteVariableValue(var, value)
+
+        pc = self.BASE
+        while pc != self.BASE + len(self.CODE):
+            inst = Instruction(pc, self.ctx.getConcreteMemoryAreaValue(pc, 16))
+            self.ctx.processing(inst)
+            pc = self.ctx.getConcreteRegisterValue(self.ctx.registers.rip)
+
+        return self.ctx.mergePathConstraints(frontier)
+
+
+    def solve(self, frontier):
+        model = self.ctx.getModel(frontier["predicate"])
+        values = {var.getId(): 0 for var in (self.al, self.bl)}
+        values.update({k: v.getValue() for k, v in model.items()})
+        return values[self.al.getId()], values[self.bl.getId()]
+
+
+    def test_exploration(self):
+        self.assertEqual(self.run_once(0, 0), 1)
+        self.assertEqual(self.run_once(0, 0), 0)
+
+        frontier = self.ctx.getNextExecutionFrontier()
+        self.assertEqual(frontier["source"], 0x1002)
+        self.assertEqual(frontier["destination"], 0x1004)
+        self.assertIsNone(frontier["prefix"])
+        self.assertIsNone(self.ctx.getNextExecutionFrontier())
+        self.assertEqual(self.ctx.getExecutionTreeStats()["pending"], 1)
+
+        self.assertEqual(self.run_once(*self.solve(frontier)), 1)
+
+        frontier = self.ctx.getNextExecutionFrontier()
+        self.assertEqual(frontier["source"], 0x1007)
+        self.assertEqual(frontier["destination"], 0x1009)
+        self.assertIsNotNone(frontier["prefix"])
+        self.assertEqual(self.solve(frontier), (0x41, 0x42))
+
+        self.assertEqual(self.run_once(0x41, 0x42), 0)
+        self.ctx.resolveExecutionFrontier(frontier["id"], SOLVER_STATE.SAT)
+
+        stats = self.ctx.getExecutionTreeStats()
+        self.assertEqual(stats["nodes"], 2)
+        self.assertEqual(stats["explored"], 4)
+        self.assertEqual(stats["pending"], 0)
+        self.assertEqual(stats["unexplored"], 0)
+        self.assertIsNone(self.ctx.getNextExecutionFrontier())
+
+
+    def test_resolve(self):
+        self.run_once(0x41, 0)
+        self.run_once(0, 0)
+
+        frontier = self.ctx.getNextExecutionFrontier()
+        self.ctx.resolveExecutionFrontier(frontier["id"], SOLVER_STATE.TIMEOUT)
+        self.assertEqual(self.ctx.getExecutionTreeStats()["timeout"], 1)
+        self.assertIsNone(self.ctx.getNextExecutionFrontier())
+
+        self.ctx.retryExecutionTimeouts()
+        retried = self.ctx.getNextExecutionFrontier()
+        self.assertEqual(retried["id"], frontier["id"])
+
+        self.ctx.resolveExecutionFrontier(retried["id"], SOLVER_STATE.UNSAT)
+        stats = self.ctx.getExecutionTreeStats()
+        self.assertEqual(stats["infeasible"], 1)
+        self.assertEqual(stats["timeout"], 0)
+
+
+    def test_diverged(self):
+        self.run_once(0, 0)
+        frontier = self.ctx.getNextExecutionFrontier()
+        self.ctx.resolveExecutionFrontier(frontier["id"], SOLVER_STATE.SAT)
+
+        # The run does not follow the model, the branch is handed out again
+        self.run_once(0, 0, frontier["id"])
+        stats = self.ctx.getExecutionTreeStats()
+        self.assertEqual(stats["diverged"], 1)
+        self.assertEqual(stats["pending"], 0)
+        self.assertEqual(stats["unexplored"], 1)
+        retried = self.ctx.getNextExecutionFrontier()
+        self.assertEqual(retried["id"], frontier["id"])
+
+        # A second divergence parks it as timeout
+        self.ctx.resolveExecutionFrontier(retried["id"], SOLVER_STATE.SAT)
+        self.run_once(0, 0, retried["id"])
+        stats = self.ctx.getExecutionTreeStats()
+        self.assertEqual(stats["diverged"], 2)
+        self.assertEqual(stats["timeout"], 1)
+        self.assertIsNone(self.ctx.getNextExecutionFrontier())
+
+        # A run following the model explores it
+        self.ctx.retryExecutionTimeouts()
+        retried = self.ctx.getNextExecutionFrontier()
+        self.assertEqual(self.solve(retried)[0], 0x41)
+        self.ctx.resolveExecutionFrontier(retried["id"], SOLVER_STATE.SAT)
+        self.run_once(*self.solve(retried), retried["id"])
+        stats = self.ctx.getExecutionTreeStats()
+        self.assertEqual(stats["diverged"], 2)
+        self.assertEqual(stats["timeout"], 0)
+        self.assertEqual(stats["pending"], 0)
+
+
+    def test_diverged_followed_only(self):
+        self.run_once(0x41, 0)
+        first = self.ctx.getNextExecutionFrontier()
+        second = self.ctx.getNextExecutionFrontier()
+        self.ctx.resolveExecutionFrontier(first["id"], SOLVER_STATE.SAT)
+        self.ctx.resolveExecutionFrontier(second["id"], SOLVER_STATE.SAT)
+
+        # Only the branch whose model the run followed is checked
+        self.run_once(*self.solve(first), first["id"])
+        stats = self.ctx.getExecutionTreeStats()
+        self.assertEqual(stats["diverged"], 0)
+        self.assertEqual(stats["pending"], 1)
+
+        self.run_once(0, 0, second["id"])
+        stats = self.ctx.getExecutionTreeStats()
+        self.assertEqual(stats["diverged"], 1)
+        self.assertEqual(stats["pending"], 0)
+        self.assertEqual(self.ctx.getNextExecutionFrontier()["id"], second["id"])
+
+
+    def test_clear(self):
+        self.run_once(0, 0)
+        self.ctx.clearExecutionTree()
+        self.assertEqual(self.ctx.getExecutionTreeStats()["nodes"], 0)
+        self.assertIsNone(self.ctx.getNextExecutionFrontier())
+        self.assertEqual(self.run_once(0, 0), 1)
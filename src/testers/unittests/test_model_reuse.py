@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the MODEL_REUSE mode."""
+
+import unittest
+
+from triton import ARCH, MODE, SOLVER_STATE, Instruction, TritonContext
+
+
+class TestModelReuse(unittest.TestCase):
+
+    """Testing the MODEL_REUSE mode."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.MODEL_REUSE, True)
+        self.ast = self.ctx.getAstContext()
+
+
+    def test_path_constraint(self):
+        # Same trace as test_path_constraint.py
+        ctx = TritonContext(ARCH.X86)
+        ctx.setMode(MODE.MODEL_REUSE, True)
+        ast = ctx.getAstContext()
+
+        trace = [
+            b"\x25\xff\xff\xff\x3f",      # and eax, 0x3fffffff
+            b"\x81\xe3\xff\xff\xff\x3f",  # and ebx, 0x3fffffff
+            b"\x31\xd1",                  # xor ecx, edx
+            b"\x31\xfa",                  # xor edx, edi
+            b"\x31\xD8",                  # xor eax, ebx
+            b"\x0F\x84\x55\x00\x00\x00",  # je 0x55
+        ]
+
+        ctx.symbolizeRegister(ctx.registers.eax)
+        ctx.symbolizeRegister(ctx.registers.ebx)
+        for opcodes in trace:
+            ctx.processing(Instruction(opcodes))
+
+        crst = ctx.getPathPredicate()
+        for query in [crst, ast.lnot(crst), ast.lnot(crst), crst]:
+            self.assertNotEqual(len(ctx.getModel(query)), 0)
+        self.assertTrue(ctx.isSat(ast.lnot(crst)))
+
+        # Only the first negated predicate is sent to the solver
+        stats = ctx.getModelCacheStats()
+        self.assertEqual(stats["concrete"], 2)
+        self.assertEqual(stats["hits"], 2)
+        self.assertEqual(stats["misses"], 1)
+
+
+    def test_recent_model(self):
+        x = self.ctx.newSymbolicVariable(8)
+        y = self.ctx.newSymbolicVariable(8)
+        vx = self.ast.variable(x)
+        vy = self.ast.variable(y)
+
+        model = self.ctx.getModel(self.ast.land([vx == 0x93, vy == 0x05]))
+        self.assertEqual(model[x.getId()].getValue(), 0x93)
+
+        # z is not in the recent model, it keeps its concrete value
+        z = self.ctx.newSymbolicVariable(8)
+        vz = self.ast.variable(z)
+        self.ctx.setConcreteVariableValue(z, 7)
+        model, status, time = self.ctx.getModel(self.ast.land([vx > 0x90, vz == 7]), status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(time, 0)
+        self.assertEqual(model[x.getId()].getValue(), 0x93)
+        self.assertEqual(model[z.getId()].getValue(), 7)
+        self.assertEqual(self.ctx.getModelCacheStats()["hits"], 1)
+
+        self.ctx.clearModelCache()
+        self.assertEqual(self.ctx.getModelCacheStats()["hits"], 0)
+        self.ctx.getModel(vx > 0x90)
+        self.assertEqual(self.ctx.getModelCacheStats()["misses"], 1)
+
+
+    def test_evaluation(self):
+        x = self.ctx.newSymbolicVariable(8)
+        y = self.ctx.newSymbolicVariable(8)
+        vx = self.ast.variable(x)
+        vy = self.ast.variable(y)
+        a = self.ast
+
+        nodes = [
+            vx + vy, vx - vy, vx * vy, a.bvudiv(vx, vy), a.bvurem(vx, vy),
+            a.bvsdiv(vx, vy), a.bvsrem(vx, vy), a.bvsmod(vx, vy), a.bvsdiv(vx, a.bv(0, 8)),
+            a.bvshl(vx, a.bv(3, 8)), a.bvlshr(vx, a.bv(3, 8)), a.bvashr(vx, a.bv(3, 8)), a.bvashr(vx, a.bv(9, 8)),
+            a.bvrol(vx, a.bv(3, 8)), a.bvror(vx, a.bv(3, 8)), a.bvneg(vx), a.bvnot(vx),
+            a.bvnand(vx, vy), a.bvnor(vx, vy), a.bvxnor(vx, vy),
+            a.extract(6, 2, vx), a.sx(8, vx), a.zx(8, vx), a.concat([vx, vy]), a.bswap(a.concat([vx, vy])),
+            a.ite(a.bvslt(vx, vy), vx, vy), a.ite(a.bvuge(vx, vy), vx, vy),
+        ]
+
+        # The constraints pin x and y, so only the recent model can satisfy them
+        self.ctx.getModel(a.land([vx == 0x93, vy == 0x05]))
+        self.ctx.setConcreteVariableValue(x, 0x93)
+        self.ctx.setConcreteVariableValue(y, 0x05)
+        expected = [n.evaluate() for n in nodes]
+        self.ctx.setConcreteVariableValue(x, 0)
+        self.ctx.setConcreteVariableValue(y, 0)
+
+        for node, value in zip(nodes, expected):
+            query = a.land([node == a.bv(value, node.getBitvectorSize()), vx == 0x93, vy == 0x05])
+            self.assertTrue(self.ctx.isSat(query), str(node))
+        self.assertEqual(self.ctx.getModelCacheStats()["hits"], len(nodes))
+        self.assertEqual(self.ctx.getModelCacheStats()["misses"], 1)
+
+
+    def test_disabled(self):
+        self.ctx.setMode(MODE.MODEL_REUSE, False)
+        var = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        self.ctx.getModel(var == 1)
+        self.ctx.getModel(var == 1)
+        self.assertEqual(self.ctx.getModelCacheStats()["hits"], 0)
+        self.assertEqual(self.ctx.getModelCacheStats()["misses"], 0)
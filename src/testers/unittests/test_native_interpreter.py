@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the NATIVE_INTERPRETER mode."""
+
+import os
+import random
+import unittest
+
+from triton import ARCH, EXCEPTION, MODE, Instruction, MemoryAccess, TritonContext
+
+
+GPRS  = ["rax", "rbx", "rcx", "rdx", "rdi", "rsi", "rbp", "rsp",
+         "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "rip"]
+FLAGS = ["af", "cf", "of", "pf", "sf", "zf"]
+
+OPCODES = [
+    b"\x48\x01\xd8",            # add rax, rbx
+    b"\x29\xd8",                # sub eax, ebx
+    b"\x2c\x80",                # sub al, 0x80
+    b"\x38\xd8",                # cmp al, bl
+    b"\x48\x83\xf8\xff",        # cmp rax, -1
+    b"\x48\x85\xd8",            # test rax, rbx
+    b"\x31\xc1",                # xor ecx, eax
+    b"\xfe\xc2",                # inc dl
+    b"\x48\xff\xcb",            # dec rbx
+    b"\x48\xd3\xe0",            # shl rax, cl
+    b"\xd2\xe3",                # shl bl, cl
+    b"\xd3\xfb",                # sar ebx, cl
+    b"\xd2\xfb",                # sar bl, cl
+    b"\x66\xd3\xe8",            # shr ax, cl
+    b"\x48\x0f\xbe\xc3",        # movsx rax, bl
+    b"\x48\x8d\x44\x8b\x10",    # lea rax, [rbx + rcx*4 + 0x10]
+]
+
+
+class TestNativeInterpreter(unittest.TestCase):
+
+    """Testing the NATIVE_INTERPRETER mode."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.NATIVE_INTERPRETER, True)
+
+
+    def assertSameState(self, ctx, ref):
+        for name in GPRS + FLAGS:
+            self.assertEqual(ctx.getConcreteRegisterValue(ctx.getRegister(name)),
+                             ref.getConcreteRegisterValue(ref.getRegister(name)), name)
+
+
+    def test_differential(self):
+        rnd = random.Random(0)
+        for opcode in OPCODES:
+            for _ in range(64):
+                values = {name: rnd.choice([0, 1, 0x7f, 0x80, 0xffffffffffffffff, rnd.getrandbits(64)]) for name in ["rax", "rbx", "rcx", "rdx"]}
+                values.update({name: rnd.getrandbits(1) for name in FLAGS})
+
+                ref = TritonContext(ARCH.X86_64)
+                ctx = TritonContext(ARCH.X86_64)
+                ctx.setMode(MODE.NATIVE_INTERPRETER, True)
+                for c in (ctx, ref):
+                    for name, value in values.items():
+                        c.setConcreteRegisterValue(c.getRegister(name), value)
+
+                ninst = Instruction(0x1000, opcode)
+                rinst = Instruction(0x1000, opcode)
+                self.assertEqual(ctx.processing(ninst), EXCEPTION.NO_FAULT)
+                self.assertEqual(ref.processing(rinst), EXCEPTION.NO_FAULT)
+                self.assertEqual(len(ninst.getSymbolicExpressions()), 0, ninst.getDisassembly())
+                self.assertSameState(ctx, ref)
+
+
+    def test_ir_suite(self):
+        import lief
+        binary = lief.parse(os.path.join(os.path.dirname(__file__), "misc", "ir-test-suite.bin"))
+
+        ref = TritonContext(ARCH.X86_64)
+        for c in (self.ctx, ref):
+            for phdr in binary.segments:
+                c.setConcreteMemoryAreaValue(phdr.virtual_address, list(phdr.content))
+            c.setConcreteRegisterValue(c.registers.rbp, 0x7fffffff)
+            c.setConcreteRegisterValue(c.registers.rsp, 0x6fffffff)
+
+        native = 0
+        count  = 0
+        pc = 0x40065c
+        while pc:
+            inst = Instruction(pc, self.ctx.getConcreteMemoryAreaValue(pc, 16))
+            self.assertEqual(self.ctx.processing(inst), EXCEPTION.NO_FAULT)
+            self.assertEqual(ref.processing(Instruction(pc, ref.getConcreteMemoryAreaValue(pc, 16))), EXCEPTION.NO_FAULT)
+            self.assertSameState(self.ctx, ref)
+            native += (len(inst.getSymbolicExpressions()) == 0)
+            count  += 1
+            pc = self.ctx.getConcreteRegisterValue(self.ctx.registers.rip)
+
+        self.assertGreater(native, count // 2)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x6fffffff - 0x1000, 0x1000),
+                         ref.getConcreteMemoryAreaValue(0x6fffffff - 0x1000, 0x1000))
+
+
+    def test_symbolic_fallback(self):
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+
+        inst = Instruction(0x1000, b"\x48\x01\xd8") # add rax, rbx
+        self.ctx.processing(inst)
+        self.assertGreater(len(inst.getSymbolicExpressions()), 0)
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.zf))
+
+        inst = Instruction(0x1003, b"\x48\x85\xdb") # test rbx, rbx
+        self.ctx.processing(inst)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.zf))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.zf), 1)
+
+        inst = Instruction(0x1006, b"\xb0\x01") # mov al, 1
+        self.ctx.processing(inst)
+        self.assertGreater(len(inst.getSymbolicExpressions()), 0)
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+
+        inst = Instruction(0x1008, b"\xb8\x05\x00\x00\x00") # mov eax, 5
+        self.ctx.processing(inst)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertFalse(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 5)
+
+
+    def test_symbolic_memory(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rsp, 0x8000)
+        self.ctx.symbolizeMemory(MemoryAccess(0x8000, 8))
+
+        inst = Instruction(0x1000, b"\x58") # pop rax
+        self.ctx.processing(inst)
+        self.assertGreater(len(inst.getSymbolicExpressions()), 0)
+        self.assertTrue(self.ctx.isRegisterSymbolized(self.ctx.registers.rax))
+
+        inst = Instruction(0x1001, b"\x53") # push rbx
+        self.ctx.processing(inst)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertFalse(self.ctx.isMemorySymbolized(MemoryAccess(0x8000, 8)))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rsp), 0x8000)
+
+
+    def test_taint(self):
+        self.ctx.taintRegister(self.ctx.registers.rbx)
+
+        inst = Instruction(0x1000, b"\x48\x89\xd8") # mov rax, rbx
+        self.ctx.processing(inst)
+        self.assertGreater(len(inst.getSymbolicExpressions()), 0)
+        self.assertTrue(self.ctx.isRegisterTainted(self.ctx.registers.rax))
+
+        inst = Instruction(0x1003, b"\x48\xc7\xc0\x02\x00\x00\x00") # mov rax, 2
+        self.ctx.processing(inst)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertFalse(self.ctx.isRegisterTainted(self.ctx.registers.rax))
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 2)
+
+
+    def test_branches(self):
+        # 0x1000: mov rcx, 3
+        # 0x1007: dec rcx
+        # 0x100a: jne 0x1007
+        code = b"\x48\xc7\xc1\x03\x00\x00\x00\x48\xff\xc9\x75\xfb"
+        self.ctx.setConcreteMemoryAreaValue(0x1000, code)
+
+        pc = 0x1000
+        taken = 0
+        while pc != 0x1000 + len(code):
+            inst = Instruction(pc, self.ctx.getConcreteMemoryAreaValue(pc, 16))
+            self.ctx.processing(inst)
+            self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+            taken += inst.isConditionTaken()
+            pc = self.ctx.getConcreteRegisterValue(self.ctx.registers.rip)
+
+        self.assertEqual(taken, 2)
+        self.assertEqual(len(self.ctx.getPathConstraints()), 0)
+
+        # Concrete path constraints are recorded without PC_TRACKING_SYMBOLIC
+        self.ctx.setMode(MODE.PC_TRACKING_SYMBOLIC, False)
+        inst = Instruction(0x100a, b"\x75\xfb")
+        self.ctx.processing(inst)
+        self.assertGreater(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(len(self.ctx.getPathConstraints()), 1)
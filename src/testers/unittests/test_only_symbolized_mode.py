@@ -164,3 +164,86 @@ class TestOnlySymbolizedMode(unittest.TestCase):
 
         self.assertEqual(inst.getOperands()[1].getAddress(), 0x1337)
         self.assertIsNotNone(inst.getOperands()[1].getLeaAst())
+
+    def test_9(self):
+        ctx = TritonContext()
+        ctx.setArchitecture(ARCH.X86_64)
+        ctx.setMode(MODE.ONLY_ON_SYMBOLIZED, True)
+        ctx.setConcreteRegisterValue(ctx.registers.rax, 0x1000)
+        ctx.setConcreteRegisterValue(ctx.registers.rbx, 0x41)
+        ctx.symbolizeRegister(ctx.registers.rcx)
+        ctx.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.QWORD))
+
+        # Concrete results are not recorded as symbolic expressions
+        count = len(ctx.getSymbolicExpressions())
+        inst = Instruction(b"\x48\x01\xd8") # add rax, rbx
+        self.assertTrue(ctx.processing(inst) == EXCEPTION.NO_FAULT)
+        self.assertTrue(checkAstIntegrity(inst))
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(len(ctx.getSymbolicExpressions()), count)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rax), 0x1041)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.rip), 3)
+
+        # A concrete store concretizes the symbolic memory
+        ctx.setConcreteRegisterValue(ctx.registers.rax, 0x1000)
+        inst = Instruction(b"\x66\x89\x18") # mov word ptr [rax], bx
+        self.assertTrue(ctx.processing(inst) == EXCEPTION.NO_FAULT)
+        self.assertEqual(len(inst.getStoreAccess()), 0)
+        self.assertEqual(ctx.getConcreteMemoryValue(MemoryAccess(0x1000, CPUSIZE.WORD)), 0x41)
+        self.assertFalse(ctx.isMemorySymbolized(MemoryAccess(0x1000, CPUSIZE.WORD)))
+        self.assertTrue(ctx.isMemorySymbolized(MemoryAccess(0x1002, CPUSIZE.BYTE)))
+
+        # A concrete sub-register write into a symbolic parent is still symbolic
+        inst = Instruction(b"\xb1\x01") # mov cl, 1
+        self.assertTrue(ctx.processing(inst) == EXCEPTION.NO_FAULT)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 1)
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.rcx))
+
+        # Flags of a concrete result are concrete
+        inst = Instruction(b"\x48\x01\xc8") # add rax, rcx
+        self.assertTrue(ctx.processing(inst) == EXCEPTION.NO_FAULT)
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.zf))
+        inst = Instruction(b"\xb8\x00\x00\x00\x00") # mov eax, 0
+        self.assertTrue(ctx.processing(inst) == EXCEPTION.NO_FAULT)
+        self.assertFalse(ctx.isRegisterSymbolized(ctx.registers.rax))
+        inst = Instruction(b"\x48\x85\xc0") # test rax, rax
+        self.assertTrue(ctx.processing(inst) == EXCEPTION.NO_FAULT)
+        self.assertFalse(ctx.isRegisterSymbolized(ctx.registers.zf))
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.zf), 1)
+
+    def test_10(self):
+        # 0x1000: mov rcx, 5
+        # 0x1007: add rax, rcx
+        # 0x100a: xor rdx, rax
+        # 0x100d: push rdx
+        # 0x100e: pop rbx
+        # 0x100f: dec rcx
+        # 0x1012: jne 0x1007
+        code = b"\x48\xc7\xc1\x05\x00\x00\x00\x48\x01\xc8\x48\x31\xc2\x52\x5b\x48\xff\xc9\x75\xf3"
+
+        ref = TritonContext(ARCH.X86_64)
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.ONLY_ON_SYMBOLIZED, True)
+        for c in (ctx, ref):
+            c.setConcreteMemoryAreaValue(0x1000, code)
+            c.setConcreteRegisterValue(c.registers.rsp, 0x8000)
+            c.setConcreteRegisterValue(c.registers.rdx, 0x1234)
+            c.symbolizeRegister(c.registers.rdx)
+
+        # Concrete instructions leave no semantics, and the state matches the one of the full semantics
+        concrete = set()
+        pc = 0x1000
+        while pc != 0x1000 + len(code):
+            inst = Instruction(pc, ctx.getConcreteMemoryAreaValue(pc, 16))
+            self.assertTrue(ctx.processing(inst) == EXCEPTION.NO_FAULT)
+            self.assertTrue(ref.processing(Instruction(pc, ref.getConcreteMemoryAreaValue(pc, 16))) == EXCEPTION.NO_FAULT)
+            if len(inst.getSymbolicExpressions()) == 0 and len(inst.getWrittenRegisters()) == 0:
+                concrete.add(inst.getType())
+            pc = ctx.getConcreteRegisterValue(ctx.registers.rip)
+
+        self.assertEqual(concrete, {OPCODE.X86.MOV, OPCODE.X86.ADD, OPCODE.X86.DEC, OPCODE.X86.JNE})
+        for name in ["rax", "rbx", "rcx", "rdx", "rsp", "zf", "cf"]:
+            self.assertEqual(ctx.getConcreteRegisterValue(ctx.getRegister(name)), ref.getConcreteRegisterValue(ref.getRegister(name)), name)
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.rbx))
+        self.assertFalse(ctx.isRegisterSymbolized(ctx.registers.rax))
+        self.assertEqual(ctx.getSymbolicRegister(ctx.registers.rbx).getAst().evaluate(), ctx.getConcreteRegisterValue(ctx.registers.rbx))
@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the OPTIMISTIC_SOLVING mode."""
+
+import unittest
+
+from triton import ARCH, MODE, SOLVER_STATE, TritonContext
+
+
+class TestOptimisticSolving(unittest.TestCase):
+
+    """Testing the OPTIMISTIC_SOLVING mode."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.OPTIMISTIC_SOLVING, True)
+        self.ast = self.ctx.getAstContext()
+        self.x = self.ctx.newSymbolicVariable(8)
+        self.y = self.ctx.newSymbolicVariable(8)
+        x = self.ast.variable(self.x)
+        y = self.ast.variable(self.y)
+        # The prefix contradicts the negated branch
+        self.query = self.ast.land([x == 1, y == 3, x == 2])
+
+
+    def test_get_model(self):
+        model, status, _ = self.ctx.getModel(self.query, status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(model[self.x.getId()].getValue(), 2)
+        self.assertTrue(model[self.x.getId()].isOptimistic())
+        # Variables of the prefix keep the current input
+        self.assertNotIn(self.y.getId(), model)
+
+
+    def test_sat(self):
+        x = self.ast.variable(self.x)
+        model = self.ctx.getModel(self.ast.land([x > 1, x == 2]))
+        self.assertFalse(model[self.x.getId()].isOptimistic())
+
+
+    def test_branch_unsat(self):
+        x = self.ast.variable(self.x)
+        model, status, _ = self.ctx.getModel(self.ast.land([x == 1, x * 2 == 3]), status=True)
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        self.assertEqual(len(model), 0)
+
+
+    def test_get_models(self):
+        x = self.ast.variable(self.x)
+        models, status, _ = self.ctx.getModels([self.query, x == 4, x * 2 == 3], status=True)
+        self.assertEqual(status, [SOLVER_STATE.SAT, SOLVER_STATE.SAT, SOLVER_STATE.UNSAT])
+        self.assertTrue(models[0][self.x.getId()].isOptimistic())
+        self.assertFalse(models[1][self.x.getId()].isOptimistic())
+        self.assertEqual(len(models[2]), 0)
+
+
+    def test_disabled(self):
+        self.ctx.setMode(MODE.OPTIMISTIC_SOLVING, False)
+        model, status, _ = self.ctx.getModel(self.query, status=True)
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        self.assertEqual(len(model), 0)
@@ -50,13 +50,313 @@ class TestSolvers(unittest.TestCase):
         self.assertEqual(model[0].getValue(), 0x11223344)
         return
 
+    def solve_incremental(self, solver):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setSolver(solver)
+        var = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        path = [self.ast.bvugt(var, self.ast.bv(10, 8)), self.ast.bvult(var, self.ast.bv(20, 8)), var != 15]
+
+        # Flip each branch on top of the asserted prefix
+        models = list()
+        for pc in path:
+            models.append(self.ctx.checkWithAssumption(self.ast.lnot(pc)))
+            self.ctx.assertConstraint(pc)
+        self.assertLessEqual(models[0][0].getValue(), 10)
+        self.assertGreaterEqual(models[1][0].getValue(), 20)
+        self.assertEqual(models[2][0].getValue(), 15)
+
+        # Assumptions are not kept in the session
+        model, status, time = self.ctx.checkWithAssumption(self.ast.lnot(path[2]), status=True)
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        model, status, time = self.ctx.checkWithAssumption(var == 5, status=True)
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        model, status, time = self.ctx.checkWithAssumption(status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+
+        # Scopes drop their constraints
+        self.ctx.pushSolverScope()
+        self.ctx.assertConstraint(var == 12)
+        self.assertEqual(self.ctx.checkWithAssumption()[0].getValue(), 12)
+        self.ctx.popSolverScope()
+        model, status, time = self.ctx.checkWithAssumption(var == 16, status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+
+        with self.assertRaises(TypeError):
+            self.ctx.popSolverScope()
+
+        self.ctx.resetSolverSession()
+        self.assertEqual(self.ctx.checkWithAssumption(var == 5)[0].getValue(), 5)
+        self.assertEqual(self.ctx.getSolverSessionSize(), 0)
+        return
+
+    def solve_assumptions_bounded(self, solver):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setSolver(solver)
+        var = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        self.ctx.assertConstraint(self.ast.bvugt(var, self.ast.bv(10, 8)))
+        size = self.ctx.getSolverSessionSize()
+        self.assertEqual(size, 1)
+
+        # Assumptions must not accumulate in the session
+        for i in range(500):
+            model, status, time = self.ctx.checkWithAssumption(var == (i & 0xff), status=True)
+            self.assertEqual(status, SOLVER_STATE.SAT if (i & 0xff) > 10 else SOLVER_STATE.UNSAT)
+            self.assertEqual(self.ctx.getSolverSessionSize(), size)
+
+        # A scope opened by the user is not closed by a check
+        self.ctx.pushSolverScope()
+        self.ctx.assertConstraint(var == 12)
+        self.ctx.checkWithAssumption(var != 12)
+        self.assertEqual(self.ctx.getSolverSessionSize(), 2)
+        self.ctx.popSolverScope()
+        self.assertEqual(self.ctx.getSolverSessionSize(), 1)
+        return
+
+    def solve_batch(self, solver):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setSolver(solver)
+        var = self.ast.variable(self.ctx.newSymbolicVariable(16, "x"))
+        path = [self.ast.bvugt(var, self.ast.bv(10 * i, 16)) for i in range(32)]
+
+        # Flip each branch of the path, the last query is unsatisfiable
+        queries = [self.ast.land(path[:i] + [self.ast.lnot(path[i])]) for i in range(1, len(path))]
+        queries.append(self.ast.land([var == 5, var == 6]))
+
+        models, status, times = self.ctx.getModels(queries, 4, status=True)
+        self.assertEqual(len(models), len(queries))
+        self.assertEqual(len(times), len(queries))
+        for i in range(1, len(path)):
+            self.assertEqual(status[i - 1], SOLVER_STATE.SAT)
+            self.assertGreater(models[i - 1][0].getValue(), 10 * (i - 1))
+            self.assertLessEqual(models[i - 1][0].getValue(), 10 * i)
+        self.assertEqual(status[-1], SOLVER_STATE.UNSAT)
+        self.assertEqual(len(models[-1]), 0)
+
+        # Same results on the calling thread
+        self.assertEqual(self.ctx.getModels(queries, 1, status=True)[1], status)
+        return
+
+    def solve_stats(self, solver):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setSolver(solver)
+        var = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        self.assertTrue(self.ctx.isSat(var == 1))
+        self.assertEqual(self.ctx.getModel(var + 1 == 5)[0].getValue(), 4)
+
+        stats = self.ctx.getSolverStats()
+        self.assertEqual(stats["queries"], 2)
+        self.assertEqual(set(stats), {"queries", "nodes", "translation", "check", "model", "numeral", "decided"})
+
+        self.ctx.clearSolverStats()
+        self.assertEqual(sum(self.ctx.getSolverStats().values()), 0)
+        return
+
+    def solve_translation_cache(self, solver):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setSolver(solver)
+        var = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        prefix = self.ast.land([self.ast.bvugt(var + 1, self.ast.bv(10, 8)), self.ast.bvult(var * 3, self.ast.bv(200, 8))])
+
+        self.assertTrue(self.ctx.isSat(self.ast.land([prefix, var != 20])))
+        first = self.ctx.getSolverStats()["nodes"]
+
+        # Only the new nodes are translated, the prefix is reused
+        self.ctx.clearSolverStats()
+        model = self.ctx.getModel(self.ast.land([prefix, var == 21]))
+        self.assertEqual(model[0].getValue(), 21)
+        self.assertLess(self.ctx.getSolverStats()["nodes"], first)
+
+        # Models only hold the variables of their query
+        other = self.ctx.newSymbolicVariable(8, "y")
+        model = self.ctx.getModel(self.ast.variable(other) == 3)
+        self.assertEqual(list(model.keys()), [other.getId()])
+        return
+
+    def solve_stale_translation(self, solver):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setSolver(solver)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 5)
+        self.ctx.processing(Instruction(b"\x48\x89\xc3"))     # mov rbx, rax
+        e1 = self.ctx.getSymbolicRegister(self.ctx.registers.rbx)
+        self.ctx.processing(Instruction(b"\x48\x83\xc3\x01")) # add rbx, 1
+        e2 = self.ctx.getSymbolicRegister(self.ctx.registers.rbx)
+        self.assertFalse(self.ctx.isSat(e2.getAst() == 7))
+
+        # The translation of rbx is dropped once the expression it references is symbolized
+        var = self.ctx.symbolizeExpression(e1.getId(), 64)
+        model = self.ctx.getModel(e2.getAst() == 7)
+        self.assertEqual(model[var.getId()].getValue(), 6)
+        return
+
+    def solve_projection(self, solver):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setSolver(solver)
+        index = self.ctx.newSymbolicVariable(8, "index")
+        other = self.ctx.newSymbolicVariable(8, "other")
+        x = self.ast.variable(index)
+        query = self.ast.land([self.ast.bvult(x, self.ast.bv(10, 8)), self.ast.bvugt(self.ast.variable(other), self.ast.bv(0, 8))])
+
+        # Each index is returned once, whatever the other variable is
+        models, status, _ = self.ctx.getModels(query, 256, status=True, projection=[index])
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(sorted(m[index.getId()].getValue() for m in models), list(range(10)))
+        self.assertTrue(all(list(m.keys()) == [index.getId()] for m in models))
+
+        with self.assertRaises(TypeError):
+            self.ctx.getModels(query, 256, projection=[x])
+        return
+
+    def solve_local_search(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setSolver(SOLVER.LOCAL_SEARCH)
+        x = self.ast.variable(self.ctx.newSymbolicVariable(32, "x"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(32, "y"))
+        b = self.ast.variable(self.ctx.newSymbolicVariable(8, "b"))
+
+        model, status, _ = self.ctx.getModel((x ^ 0x1234) == 0xdead, status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(model[0].getValue(), 0xcc99)
+
+        # Mostly arithmetic and comparisons over input bytes
+        query = self.ast.land([x + y * 3 == 1000, self.ast.bvugt(y, self.ast.bv(100, 32)), self.ast.bvult(y, self.ast.bv(200, 32)), self.ast.extract(7, 0, x) == 0x41])
+        model = self.ctx.getModel(query)
+        self.assertEqual((model[0].getValue() + model[1].getValue() * 3) & 0xffffffff, 1000)
+        self.assertEqual(model[0].getValue() & 0xff, 0x41)
+        self.assertEqual(self.ctx.getModel(self.ast.bswap(x) == 0x44332211)[0].getValue(), 0x11223344)
+
+        # Models are distinct, the search cannot tell that they are all found
+        models = self.ctx.getModels(self.ast.bvult(b, self.ast.bv(10, 8)), 10)
+        self.assertEqual(sorted(m[2].getValue() for m in models), list(range(10)))
+
+        # Unsatisfiable queries are unknown unless a conjunct is constant
+        model, status, _ = self.ctx.getModel(self.ast.land([b == 1, b == 2]), status=True, timeout=100)
+        self.assertEqual(status, SOLVER_STATE.UNKNOWN)
+        self.assertEqual(len(model), 0)
+        model, status, _ = self.ctx.getModel(self.ast.land([self.ast.bv(1, 8) == self.ast.bv(2, 8), b == 2]), status=True)
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        self.assertFalse(self.ctx.isSat(self.ast.land([b == 1, b == 2])))
+        return
+
+    def solve_portfolio(self):
+        self.solve_a_query(SOLVER.PORTFOLIO)
+        self.solve_bswap(SOLVER.PORTFOLIO)
+        self.solve_batch(SOLVER.PORTFOLIO)
+        self.solve_projection(SOLVER.PORTFOLIO)
+
+        # Each query is won by one of the backends
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setSolver(SOLVER.PORTFOLIO)
+        var = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        self.assertTrue(self.ctx.isSat(var == 1))
+        self.assertFalse(self.ctx.isSat(self.ast.land([var == 1, var == 2])))
+        self.assertEqual(self.ctx.getModel(var + 1 == 5)[0].getValue(), 4)
+        self.assertEqual(sum(self.ctx.getSolverPortfolioStats().values()), 3)
+
+        # More z3 instances are raced with other seeds, the wins are reset
+        if 'Z3' in dir(SOLVER):
+            self.ctx.setSolverPortfolioSeeds(2)
+            stats = self.ctx.getSolverPortfolioStats()
+            self.assertIn("z3 (seed 1)", stats)
+            self.assertIn("z3 (seed 2)", stats)
+            self.assertEqual(sum(stats.values()), 0)
+            self.assertEqual(self.ctx.getModel(var + 1 == 5)[0].getValue(), 4)
+            self.assertEqual(sum(self.ctx.getSolverPortfolioStats().values()), 1)
+
+        self.ctx.setSolver(SOLVER.Z3 if 'Z3' in dir(SOLVER) else SOLVER.BITWUZLA)
+        with self.assertRaises(TypeError):
+            self.ctx.getSolverPortfolioStats()
+        with self.assertRaises(TypeError):
+            self.ctx.setSolverPortfolioSeeds(2)
+        return
+
+    def solve_process_pool(self):
+        self.solve_a_query(SOLVER.PROCESS_POOL)
+        self.solve_bswap(SOLVER.PROCESS_POOL)
+        self.solve_batch(SOLVER.PROCESS_POOL)
+        self.solve_stats(SOLVER.PROCESS_POOL)
+        self.solve_projection(SOLVER.PROCESS_POOL)
+
+        # Workers are forked on demand and count their queries
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.ctx.setSolver(SOLVER.PROCESS_POOL)
+        self.ctx.setSolverWorkers(2)
+        var = self.ast.variable(self.ctx.newSymbolicVariable(8, "x"))
+        self.assertTrue(self.ctx.isSat(var == 1))
+        self.assertFalse(self.ctx.isSat(self.ast.land([var == 1, var == 2])))
+        self.assertEqual(self.ctx.getModel(var + 1 == 5)[0].getValue(), 4)
+        workers = self.ctx.getSolverWorkerStats()
+        self.assertEqual(len(workers), 2)
+        self.assertEqual(sum(w["queries"] for w in workers), 3)
+        self.assertEqual(sum(w["crashes"] for w in workers), 0)
+        self.assertGreater(workers[0]["pid"], 0)
+
+        # A query over its timeout reports TIMEOUT, and the next one is solved
+        x = self.ast.variable(self.ctx.newSymbolicVariable(64, "p"))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(64, "q"))
+        n = (2**64 - 59) * (2**64 - 83)
+        factoring = self.ast.land([
+            self.ast.zx(64, x) * self.ast.zx(64, y) == self.ast.bv(n, 128),
+            self.ast.bvugt(x, self.ast.bv(1, 64)),
+            self.ast.bvugt(y, self.ast.bv(1, 64)),
+        ])
+        self.ctx.setSolverWorkers(1)
+        model, status, time = self.ctx.getModel(factoring, status=True, timeout=500)
+        self.assertEqual(status, SOLVER_STATE.TIMEOUT)
+        self.assertEqual(model, {})
+        self.assertEqual(self.ctx.getSolverWorkerStats()[0]["timeouts"], 1)
+        model, status, time = self.ctx.getModel(var + 1 == 5, status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(model[0].getValue(), 4)
+        self.assertGreater(self.ctx.getSolverWorkerStats()[0]["pid"], 0)
+
+        self.ctx.setSolver(SOLVER.Z3 if 'Z3' in dir(SOLVER) else SOLVER.BITWUZLA)
+        with self.assertRaises(TypeError):
+            self.ctx.getSolverWorkerStats()
+        with self.assertRaises(TypeError):
+            self.ctx.setSolverWorkers(2)
+        return
+
     def test_solvers(self):
         # Test if Z3 has been enabled
         if 'Z3' in dir(SOLVER):
             self.solve_a_query(SOLVER.Z3)
             self.solve_bswap(SOLVER.Z3)
+            self.solve_incremental(SOLVER.Z3)
+            self.solve_assumptions_bounded(SOLVER.Z3)
+            self.solve_batch(SOLVER.Z3)
+            self.solve_stats(SOLVER.Z3)
+            self.solve_projection(SOLVER.Z3)
+            self.solve_translation_cache(SOLVER.Z3)
+            self.solve_stale_translation(SOLVER.Z3)
 
         # Test if BITWUZLA has been enabled
         if 'BITWUZLA' in dir(SOLVER):
             self.solve_a_query(SOLVER.BITWUZLA)
             self.solve_bswap(SOLVER.BITWUZLA)
+            self.solve_incremental(SOLVER.BITWUZLA)
+            self.solve_assumptions_bounded(SOLVER.BITWUZLA)
+            self.solve_batch(SOLVER.BITWUZLA)
+            self.solve_stats(SOLVER.BITWUZLA)
+            self.solve_projection(SOLVER.BITWUZLA)
+            self.solve_translation_cache(SOLVER.BITWUZLA)
+            self.solve_stale_translation(SOLVER.BITWUZLA)
+
+        self.solve_local_search()
+
+        # Test if a solver has been enabled
+        if 'PORTFOLIO' in dir(SOLVER):
+            self.solve_portfolio()
+
+        # Test if the worker processes are available
+        if 'PROCESS_POOL' in dir(SOLVER):
+            self.solve_process_pool()
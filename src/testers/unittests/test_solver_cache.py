@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the SOLVER_CACHE mode."""
+
+import os
+import tempfile
+import unittest
+
+from triton import ARCH, MODE, SOLVER_STATE, TritonContext
+
+
+class TestSolverCache(unittest.TestCase):
+
+    """Testing the SOLVER_CACHE mode."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.SOLVER_CACHE, True)
+        self.ast = self.ctx.getAstContext()
+
+
+    def query(self, ctx):
+        ast = ctx.getAstContext()
+        var = ctx.newSymbolicVariable(8)
+        return var, ast.variable(var) + 1 == 5
+
+
+    def test_alpha_equivalence(self):
+        x, qx = self.query(self.ctx)
+        y, qy = self.query(self.ctx)
+
+        model = self.ctx.getModel(qx)
+        self.assertEqual(model[x.getId()].getValue(), 4)
+
+        model, status, _ = self.ctx.getModel(qy, status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+        self.assertEqual(model[y.getId()].getValue(), 4)
+        self.assertTrue(self.ctx.isSat(qy))
+
+        stats = self.ctx.getSolverCacheStats()
+        self.assertEqual(stats["misses"], 1)
+        self.assertEqual(stats["hits"], 2)
+
+        self.ctx.clearSolverCache()
+        self.assertEqual(self.ctx.getSolverCacheStats()["hits"], 0)
+
+
+    def test_is_sat(self):
+        var = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        unsat = var * 2 == 3
+
+        self.assertFalse(self.ctx.isSat(unsat))
+        self.assertFalse(self.ctx.isSat(unsat))
+        self.assertEqual(self.ctx.getSolverCacheStats()["hits"], 1)
+
+        # isSat() does not compute the model, getModel() must solve the query
+        model, status, _ = self.ctx.getModel(unsat, status=True)
+        self.assertEqual(status, SOLVER_STATE.UNSAT)
+        self.assertEqual(len(model), 0)
+        self.assertEqual(self.ctx.getSolverCacheStats()["misses"], 2)
+
+
+    def test_structure(self):
+        var = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        self.ctx.getModel(var + 1 == 5)
+        self.ctx.getModel(var + 2 == 5)
+        self.ctx.getModel(var - 1 == 5)
+        self.assertEqual(self.ctx.getSolverCacheStats()["hits"], 0)
+
+
+    def test_persistence(self):
+        _, query = self.query(self.ctx)
+        self.ctx.getModel(query)
+
+        path = os.path.join(tempfile.mkdtemp(), "solver.cache")
+        self.ctx.saveSolverCache(path)
+
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.SOLVER_CACHE, True)
+        ctx.loadSolverCache(path)
+        var, query = self.query(ctx)
+        self.assertEqual(ctx.getModel(query)[var.getId()].getValue(), 4)
+        self.assertEqual(ctx.getSolverCacheStats()["hits"], 1)
+        os.remove(path)
+
+
+    def saved(self):
+        _, query = self.query(self.ctx)
+        self.ctx.getModel(query)
+        path = os.path.join(tempfile.mkdtemp(), "solver.cache")
+        self.ctx.saveSolverCache(path)
+        with open(path, "rb") as f:
+            data = bytearray(f.read())
+        os.remove(path)
+        return path, data
+
+
+    def test_rejected_model(self):
+        # The model of the entry is the last byte of the file
+        path, data = self.saved()
+        self.assertEqual(data[-1], 4)
+        data[-1] = 5
+        with open(path, "wb") as f:
+            f.write(data)
+
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.SOLVER_CACHE, True)
+        ctx.loadSolverCache(path)
+        var, query = self.query(ctx)
+        self.assertEqual(ctx.getModel(query)[var.getId()].getValue(), 4)
+        stats = ctx.getSolverCacheStats()
+        self.assertEqual(stats["hits"], 0)
+        self.assertEqual(stats["rejections"], 1)
+
+        # The entry recorded by the solver is used again
+        self.assertEqual(ctx.getModel(query)[var.getId()].getValue(), 4)
+        self.assertEqual(ctx.getSolverCacheStats()["hits"], 1)
+        os.remove(path)
+
+
+    def test_corrupted_file(self):
+        # magic, version, count, key, then the status of the entry
+        path, data = self.saved()
+        data[36] = 0x7f
+        with open(path, "wb") as f:
+            f.write(data)
+
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.SOLVER_CACHE, True)
+        with self.assertRaises(TypeError):
+            ctx.loadSolverCache(path)
+
+        # Nothing was loaded
+        var, query = self.query(ctx)
+        self.assertEqual(ctx.getModel(query)[var.getId()].getValue(), 4)
+        self.assertEqual(ctx.getSolverCacheStats()["hits"], 0)
+        os.remove(path)
+
+
+    def test_disabled(self):
+        self.ctx.setMode(MODE.SOLVER_CACHE, False)
+        _, query = self.query(self.ctx)
+        self.ctx.getModel(query)
+        self.ctx.getModel(query)
+        self.assertEqual(self.ctx.getSolverCacheStats()["hits"], 0)
+        self.assertEqual(self.ctx.getSolverCacheStats()["misses"], 0)
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+# coding: utf-8
+"""Test the solver query recorder."""
+
+import os
+import shutil
+import tempfile
+import unittest
+
+from triton import ARCH, MODE, SOLVER_STATE, Instruction, TritonContext
+
+
+class TestSolverRecorder(unittest.TestCase):
+
+    """Testing the solver query recorder."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ast = self.ctx.getAstContext()
+        self.path = tempfile.mkdtemp()
+
+
+    def tearDown(self):
+        shutil.rmtree(self.path)
+
+
+    def read(self, index):
+        with open(os.path.join(self.path, "query-%06d.smt2" % index)) as f:
+            return f.read()
+
+
+    def test_record(self):
+        self.assertEqual(self.ctx.getSolverRecordDirectory(), "")
+        self.ctx.setSolverRecordDirectory(self.path)
+        self.assertEqual(self.ctx.getSolverRecordDirectory(), self.path)
+
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        y = self.ast.variable(self.ctx.newSymbolicVariable(16, "y"))
+        self.ctx.getModel(x + 1 == 5)
+        self.ctx.isSat(self.ast.land([x == 1, x == 2]))
+        self.ctx.getModels(self.ast.zx(8, x) + y == 0x1234, 2)
+
+        self.assertEqual(sorted(os.listdir(self.path)), ["query-000000.smt2", "query-000001.smt2", "query-000002.smt2"])
+
+        query = self.read(0)
+        self.assertIn("; triton-status: sat\n", query)
+        self.assertIn("; triton-variable: SymVar_0 8\n", query)
+        self.assertIn("(declare-fun SymVar_0 () (_ BitVec 8))", query)
+        self.assertIn("(assert ", query)
+        self.assertIn("(check-sat)", query)
+
+        self.assertIn("; triton-status: unsat\n", self.read(1))
+        self.assertIn("; triton-variable: y 16\n", self.read(2))
+
+        # Recording is stopped by an empty path
+        self.ctx.setSolverRecordDirectory("")
+        self.ctx.getModel(x == 3)
+        self.assertEqual(len(os.listdir(self.path)), 3)
+
+
+    def test_references(self):
+        self.ctx.setSolverRecordDirectory(self.path)
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        self.ctx.processing(Instruction(b"\x48\x35\x34\x12\x00\x00")) # xor rax, 0x1234
+        rax = self.ctx.getSymbolicRegister(self.ctx.registers.rax)
+        self.ctx.getModel(rax.getAst() == 0xdead)
+
+        # References are defined, so that the query is standalone
+        query = self.read(0)
+        self.assertIn("(define-fun ref!", query)
+        self.assertIn("(define-fun bswap8", query)
+
+
+    def test_cache_hits(self):
+        self.ctx.setMode(MODE.SOLVER_CACHE, True)
+        self.ctx.setSolverRecordDirectory(self.path)
+        x = self.ast.variable(self.ctx.newSymbolicVariable(8))
+        model, status, _ = self.ctx.getModel(x * 3 == 9, status=True)
+        model, status, _ = self.ctx.getModel(x * 3 == 9, status=True)
+        self.assertEqual(status, SOLVER_STATE.SAT)
+
+        # Only the queries sent to the solver are recorded
+        self.assertEqual(len(os.listdir(self.path)), 1)
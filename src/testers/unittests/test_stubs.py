@@ -268,3 +268,167 @@ class TestStubsAArch64(unittest.TestCase):
         self.emulate(0x66600000 + STUBS.AARCH64.LIBC.symbols["strncasecmp"])
         x0 = self.ctx.getConcreteRegisterValue(self.ctx.registers.x0)
         self.assertNotEqual(x0, 0)
+
+
+class TestStubsSummaries(unittest.TestCase):
+    """Testing native summaries of stubs against their emulation."""
+
+    BASE = 0x66600000
+    LIBC = STUBS.X8664.SYSTEMV.LIBC
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setConcreteMemoryAreaValue(self.BASE, self.LIBC.code)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rsp, 0x7ffffff0)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbp, 0x7ffffff0)
+
+    def emulate(self, name):
+        count = 0
+        pc = self.BASE + self.LIBC.symbols[name]
+        while pc:
+            opcode = self.ctx.getConcreteMemoryAreaValue(pc, 16)
+            self.ctx.processing(Instruction(pc, opcode))
+            pc = self.ctx.getConcreteRegisterValue(self.ctx.registers.rip)
+            count += 1
+        return count
+
+    def ast_size(self, reg):
+        node = self.ctx.getSymbolicRegister(reg).getAst()
+        return len(self.ctx.getAstContext().search(node, AST_NODE.ANY))
+
+    def run_both(self, name, setup):
+        results = list()
+        for summary in (False, True):
+            self.setUp()
+            if summary:
+                self.assertEqual(self.ctx.addFunctionSummaries(self.BASE, self.LIBC.symbols, self.LIBC.abi), 9)
+            setup()
+            count = self.emulate(name)
+            results.append((count, self.ctx.getPathPredicateSize(), self.ctx.getConcreteRegisterValue(self.ctx.registers.rax)))
+        return results
+
+    def test_summaries(self):
+        self.assertEqual(self.ctx.addFunctionSummaries(self.BASE, STUBS.X8664.SYSTEMV.LIBC.symbols), 9)
+        self.ctx.addFunctionSummary(0x1000, "strlen")
+        with self.assertRaises(TypeError):
+            self.ctx.addFunctionSummary(0x1000, "strtoul")
+
+    def test_abi(self):
+        self.assertEqual(STUBS.X8664.SYSTEMV.LIBC.abi, SYMBOLIC.SYSTEMV_ABI)
+        self.assertEqual(STUBS.X8664.MS.LIBC.abi, SYMBOLIC.MS_ABI)
+        self.assertEqual(STUBS.I386.SYSTEMV.LIBC.abi, SYMBOLIC.SYSTEMV_ABI)
+        self.assertEqual(STUBS.AARCH64.LIBC.abi, SYMBOLIC.AAPCS64_ABI)
+
+        # Conventions the architecture does not support are rejected when registering
+        ctx = TritonContext(ARCH.AARCH64)
+        with self.assertRaises(TypeError):
+            ctx.addFunctionSummaries(self.BASE, STUBS.X8664.MS.LIBC.symbols, STUBS.X8664.MS.LIBC.abi)
+        with self.assertRaises(TypeError):
+            ctx.addFunctionSummary(0x1000, "strlen", SYMBOLIC.SYSTEMV_ABI)
+        self.assertEqual(ctx.addFunctionSummaries(self.BASE, STUBS.AARCH64.LIBC.symbols, STUBS.AARCH64.LIBC.abi), 9)
+
+        ctx = TritonContext(ARCH.X86)
+        with self.assertRaises(TypeError):
+            ctx.addFunctionSummaries(self.BASE, STUBS.X8664.MS.LIBC.symbols, SYMBOLIC.MS_ABI)
+
+        # Architectures without summaries are rejected as well
+        ctx = TritonContext(ARCH.ARM32)
+        with self.assertRaises(TypeError):
+            ctx.addFunctionSummaries(self.BASE, STUBS.X8664.SYSTEMV.LIBC.symbols)
+        with self.assertRaises(TypeError):
+            ctx.addFunctionSummary(0x1000, "strlen")
+
+    def test_strlen(self):
+        def setup():
+            self.ctx.setConcreteMemoryAreaValue(0x1000, b"triton stubs")
+            self.ctx.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.QWORD))
+            self.ctx.setConcreteRegisterValue(self.ctx.registers.rdi, 0x1000)
+
+        (emu_count, emu_pc, emu_rax), (sum_count, sum_pc, sum_rax) = self.run_both("strlen", setup)
+        self.assertEqual(emu_rax, 12)
+        self.assertEqual(sum_rax, 12)
+        self.assertEqual(sum_count, 1)
+        self.assertLess(sum_count, emu_count)
+        self.assertEqual(sum_pc, 0)
+        self.assertLess(sum_pc, emu_pc)
+        self.assertEqual(self.ctx.getFunctionSummaryHits()["strlen"], 1)
+
+        # The length depends on the symbolic bytes
+        rax = self.ctx.getRegisterAst(self.ctx.registers.rax)
+        model = self.ctx.getModel(rax == 3)
+        self.assertNotEqual(len(model), 0)
+
+    def test_strcmp(self):
+        def setup():
+            self.ctx.setConcreteMemoryAreaValue(0x1000, b"triton stubs")
+            self.ctx.setConcreteMemoryAreaValue(0x2000, b"triton stubs")
+            self.ctx.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.QWORD))
+            self.ctx.setConcreteRegisterValue(self.ctx.registers.rdi, 0x1000)
+            self.ctx.setConcreteRegisterValue(self.ctx.registers.rsi, 0x2000)
+
+        (emu_count, emu_pc, emu_rax), (sum_count, sum_pc, sum_rax) = self.run_both("strcmp", setup)
+        self.assertEqual(emu_rax, 0)
+        self.assertEqual(sum_rax, 0)
+        self.assertLess(sum_count, emu_count)
+        self.assertLess(sum_pc, emu_pc)
+
+        # The ITE chain is bounded
+        full = self.ast_size(self.ctx.registers.rax)
+        self.setUp()
+        self.ctx.addFunctionSummaries(self.BASE, STUBS.X8664.SYSTEMV.LIBC.symbols)
+        self.ctx.setFunctionSummaryBound(2)
+        setup()
+        self.emulate("strcmp")
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.rax), 0)
+        self.assertLess(self.ast_size(self.ctx.registers.rax), full)
+
+    def test_memcpy(self):
+        def setup():
+            self.ctx.setConcreteMemoryAreaValue(0x1000, b"triton stubs")
+            self.ctx.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.DWORD))
+            self.ctx.setConcreteRegisterValue(self.ctx.registers.rdi, 0x2000)
+            self.ctx.setConcreteRegisterValue(self.ctx.registers.rsi, 0x1000)
+            self.ctx.setConcreteRegisterValue(self.ctx.registers.rdx, 12)
+
+        (emu_count, emu_pc, emu_rax), (sum_count, sum_pc, sum_rax) = self.run_both("memcpy", setup)
+        self.assertEqual(emu_rax, 0x2000)
+        self.assertEqual(sum_rax, 0x2000)
+        self.assertLess(sum_count, emu_count)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x2000, 12), b"triton stubs")
+        self.assertTrue(self.ctx.isMemorySymbolized(MemoryAccess(0x2000, CPUSIZE.DWORD)))
+        self.assertFalse(self.ctx.isMemorySymbolized(MemoryAccess(0x2004, CPUSIZE.DWORD)))
+        # Expressions are shared, not rebuilt
+        self.assertEqual(self.ctx.getSymbolicMemory(0x2000).getId(), self.ctx.getSymbolicMemory(0x1000).getId())
+
+    def test_ms_memcpy(self):
+        self.LIBC = STUBS.X8664.MS.LIBC
+
+        def setup():
+            self.ctx.setConcreteMemoryAreaValue(0x1000, b"triton stubs")
+            self.ctx.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.DWORD))
+            self.ctx.setConcreteRegisterValue(self.ctx.registers.rcx, 0x2000)
+            self.ctx.setConcreteRegisterValue(self.ctx.registers.rdx, 0x1000)
+            self.ctx.setConcreteRegisterValue(self.ctx.registers.r8, 12)
+
+        (emu_count, emu_pc, emu_rax), (sum_count, sum_pc, sum_rax) = self.run_both("memcpy", setup)
+        self.assertEqual(emu_rax, 0x2000)
+        self.assertEqual(sum_rax, 0x2000)
+        self.assertLess(sum_count, emu_count)
+        self.assertEqual(self.ctx.getConcreteMemoryAreaValue(0x2000, 12), b"triton stubs")
+        self.assertEqual(self.ctx.getSymbolicMemory(0x2000).getId(), self.ctx.getSymbolicMemory(0x1000).getId())
+
+    def test_ms_strlen(self):
+        self.LIBC = STUBS.X8664.MS.LIBC
+
+        def setup():
+            self.ctx.setConcreteMemoryAreaValue(0x1000, b"triton stubs")
+            self.ctx.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.QWORD))
+            self.ctx.setConcreteRegisterValue(self.ctx.registers.rcx, 0x1000)
+            # System V registers point elsewhere
+            self.ctx.setConcreteRegisterValue(self.ctx.registers.rdi, 0x3000)
+
+        (emu_count, emu_pc, emu_rax), (sum_count, sum_pc, sum_rax) = self.run_both("strlen", setup)
+        self.assertEqual(emu_rax, 12)
+        self.assertEqual(sum_rax, 12)
+        self.assertEqual(sum_count, 1)
+        self.assertEqual(self.ctx.getFunctionSummaryHits()["strlen"], 1)
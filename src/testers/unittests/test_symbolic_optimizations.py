@@ -38,3 +38,195 @@ class TestSymbolicOptimizations(unittest.TestCase):
         self.assertEqual(rcx.getType(), AST_NODE.REFERENCE)
         self.assertEqual(rcx.evaluate(), 1)
         return
+
+
+
+class TestStoreLoadForwarding(unittest.TestCase):
+
+    """Testing STORE_LOAD_FORWARDING."""
+
+    def setUp(self):
+        self.ctx = TritonContext(ARCH.X86_64)
+        self.ctx.setMode(MODE.STORE_LOAD_FORWARDING, True)
+
+
+    def test_partial_load(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 0x1000)
+        self.ctx.symbolizeRegister(self.ctx.registers.rax)
+        self.ctx.setConcreteVariableValue(self.ctx.getSymbolicVariable(0), 0x1122334455667788)
+
+        self.ctx.processing(Instruction(b"\x48\x89\x03"))                 # mov [rbx], rax
+        self.ctx.processing(Instruction(b"\x8b\x4b\x02"))                 # mov ecx, [rbx + 2]
+
+        node = self.ctx.getMemoryAst(MemoryAccess(0x1002, CPUSIZE.DWORD))
+        self.assertEqual(node.getType(), AST_NODE.EXTRACT)
+        self.assertEqual(node.evaluate(), 0x33445566)
+        self.assertEqual(self.ctx.getConcreteRegisterValue(self.ctx.registers.ecx), 0x33445566)
+        return
+
+
+    def test_full_load(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 0x1000)
+        self.ctx.symbolizeMemory(MemoryAccess(0x1000, CPUSIZE.DWORD))
+
+        node = self.ctx.getMemoryAst(MemoryAccess(0x1000, CPUSIZE.DWORD))
+        self.assertEqual(node.getType(), AST_NODE.VARIABLE)
+        return
+
+
+    def test_mixed_stores(self):
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rbx, 0x1000)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rax, 0x1122334455667788)
+        self.ctx.setConcreteRegisterValue(self.ctx.registers.rcx, 0xaabbccdd)
+
+        self.ctx.processing(Instruction(b"\x48\x89\x03"))                 # mov [rbx], rax
+        self.ctx.processing(Instruction(b"\x89\x4b\x04"))                 # mov [rbx + 4], ecx
+
+        node = self.ctx.getMemoryAst(MemoryAccess(0x1002, CPUSIZE.DWORD))
+        self.assertEqual(node.getType(), AST_NODE.CONCAT)
+        self.assertEqual(node.evaluate(), 0xccdd5566)
+
+        node = self.ctx.getMemoryAst(MemoryAccess(0x1004, CPUSIZE.WORD))
+        self.assertEqual(node.getType(), AST_NODE.EXTRACT)
+        self.assertEqual(node.evaluate(), 0xccdd)
+        return
+
+
+
+class TestDeadFlagElimination(unittest.TestCase):
+
+    """Testing the DEAD_FLAG_ELIMINATION mode."""
+
+    def process(self, enabled):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.DEAD_FLAG_ELIMINATION, enabled)
+        ctx.symbolizeRegister(ctx.registers.rax)
+        ctx.symbolizeRegister(ctx.registers.rbx)
+        block = BasicBlock([
+            Instruction(b"\x48\x01\xd8"),   # add rax, rbx
+            Instruction(b"\x48\x11\xc1"),   # adc rcx, rax
+            Instruction(b"\x48\x31\xda"),   # xor rdx, rbx
+            Instruction(b"\x48\x29\xd8"),   # sub rax, rbx
+            Instruction(b"\x48\x39\xc8"),   # cmp rax, rcx
+            Instruction(b"\x74\x10"),       # je +0x10
+        ])
+        ctx.processing(block, 0x1000)
+        return ctx, block
+
+
+    def test_expressions(self):
+        ref, refBlock = self.process(False)
+        ctx, block = self.process(True)
+
+        before = sum(len(i.getSymbolicExpressions()) for i in refBlock.getInstructions())
+        after = sum(len(i.getSymbolicExpressions()) for i in block.getInstructions())
+        self.assertLess(after, before)
+
+        # add: cf is read by adc, the other flags are overwritten by adc and never built
+        flags = sorted(e.getOrigin().getName() for e in block.getInstructions()[0].getSymbolicExpressions() if e.isRegister())
+        self.assertEqual(flags, ["cf", "rax", "rip"])
+        self.assertTrue(all(e.getDisassembly() == "0x1000: add rax, rbx" for e in block.getInstructions()[0].getSymbolicExpressions()))
+
+        # The flags written by cmp are live at the block exit
+        flags = {e.getOrigin().getName() for e in block.getInstructions()[4].getSymbolicExpressions() if e.isRegister()}
+        self.assertTrue({"cf", "of", "pf", "sf", "zf"} <= flags)
+        self.assertTrue(all(w[0].getName() != "of" for w in block.getInstructions()[0].getWrittenRegisters()))
+
+
+    def test_same_state(self):
+        # The blocks keep the expressions of their instructions alive
+        ref, refBlock = self.process(False)
+        ctx, block = self.process(True)
+
+        for reg in [ctx.registers.rax, ctx.registers.rcx, ctx.registers.zf, ctx.registers.cf, ctx.registers.rip]:
+            a = ref.getSymbolicRegister(ref.getRegister(reg.getId()))
+            b = ctx.getSymbolicRegister(reg)
+            self.assertEqual(a.getAst().evaluate(), b.getAst().evaluate())
+            self.assertEqual(str(ref.getAstContext().unroll(a.getAst())), str(ctx.getAstContext().unroll(b.getAst())))
+
+        self.assertEqual(len(ref.getPathConstraints()), len(ctx.getPathConstraints()))
+        self.assertLess(len(ctx.getSymbolicExpressions()), len(ref.getSymbolicExpressions()))
+        for flag in [ctx.registers.af, ctx.registers.of, ctx.registers.pf, ctx.registers.sf]:
+            self.assertEqual(ref.getConcreteRegisterValue(ref.getRegister(flag.getId())), ctx.getConcreteRegisterValue(flag))
+
+
+    def test_block_only(self):
+        # Flags are not deferred across blocks
+        ctx, _ = self.process(True)
+        self.assertIsNotNone(ctx.getSymbolicRegister(ctx.registers.of))
+        inst = Instruction(0x2000, b"\x48\x01\xd8") # add rax, rbx
+        ctx.processing(inst)
+        flags = {e.getOrigin().getName() for e in inst.getSymbolicExpressions() if e.isRegister()}
+        self.assertTrue({"af", "cf", "of", "pf", "sf", "zf"} <= flags)
+
+
+class TestLazyFlags(unittest.TestCase):
+
+    """Testing the LAZY_FLAGS mode."""
+
+    # 0x1000: add rax, rbx
+    # 0x1003: xor rdx, rax
+    # 0x1006: dec rcx
+    # 0x1009: jne 0x1000
+    CODE = b"\x48\x01\xd8\x48\x31\xc2\x48\xff\xc9\x75\xf5"
+
+    def emulate(self, enabled):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.LAZY_FLAGS, enabled)
+        ctx.setConcreteMemoryAreaValue(0x1000, self.CODE)
+        ctx.setConcreteRegisterValue(ctx.registers.rcx, 5)
+        ctx.symbolizeRegister(ctx.registers.rax)
+        ctx.symbolizeRegister(ctx.registers.rcx)
+
+        pc = 0x1000
+        while pc != 0x1000 + len(self.CODE):
+            inst = Instruction(pc, ctx.getConcreteMemoryAreaValue(pc, 16))
+            ctx.processing(inst)
+            pc = ctx.getConcreteRegisterValue(ctx.registers.rip)
+        return ctx
+
+
+    def test_expressions(self):
+        ref = self.emulate(False)
+        ctx = self.emulate(True)
+        self.assertLess(len(ctx.getSymbolicExpressions()), len(ref.getSymbolicExpressions()))
+        self.assertEqual(len(ctx.getPathConstraints()), len(ref.getPathConstraints()))
+
+
+    def test_same_state(self):
+        ref = self.emulate(False)
+        ctx = self.emulate(True)
+
+        for reg in [ctx.registers.rax, ctx.registers.rdx, ctx.registers.zf, ctx.registers.cf, ctx.registers.sf, ctx.registers.pf]:
+            self.assertEqual(ref.getConcreteRegisterValue(ref.getRegister(reg.getId())), ctx.getConcreteRegisterValue(reg))
+            a = ref.getSymbolicRegister(ref.getRegister(reg.getId()))
+            b = ctx.getSymbolicRegister(reg)
+            self.assertEqual(str(ref.getAstContext().unroll(a.getAst())), str(ctx.getAstContext().unroll(b.getAst())))
+            self.assertEqual(a.getComment(), b.getComment())
+            self.assertEqual(a.getDisassembly(), b.getDisassembly())
+            self.assertEqual(a.isTainted(), b.isTainted())
+
+
+    def test_overwrite(self):
+        ctx = TritonContext(ARCH.X86_64)
+        ctx.setMode(MODE.LAZY_FLAGS, True)
+        ctx.symbolizeRegister(ctx.registers.rax)
+        ctx.processing(Instruction(b"\x48\x01\xc0")) # add rax, rax
+        ctx.setConcreteRegisterValue(ctx.registers.zf, 1)
+        self.assertEqual(ctx.getConcreteRegisterValue(ctx.registers.zf), 1)
+        self.assertFalse(ctx.isRegisterSymbolized(ctx.registers.zf))
+        self.assertTrue(ctx.isRegisterSymbolized(ctx.registers.cf))
+
+
+    def test_eflags(self):
+        values = []
+        for enabled in (False, True):
+            ctx = TritonContext(ARCH.X86_64)
+            ctx.setMode(MODE.LAZY_FLAGS, enabled)
+            ctx.setConcreteRegisterValue(ctx.registers.rax, 0xffffffffffffffff)
+            ctx.setConcreteRegisterValue(ctx.registers.rbx, 1)
+            ctx.symbolizeRegister(ctx.registers.rax)
+            ctx.processing(Instruction(b"\x48\x01\xd8")) # add rax, rbx
+            values.append(ctx.getConcreteRegisterValue(ctx.registers.eflags))
+        self.assertEqual(values[0], values[1])
+        self.assertEqual(values[1] & 0x41, 0x41) # cf and zf